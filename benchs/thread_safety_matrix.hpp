@@ -0,0 +1,425 @@
+/**
+ * @file thread_safety_matrix.hpp
+ * @brief Scaling matrix shared by the uint128_t and int128_t thread-safety benchmarks
+ *
+ * Every wrapper x operation x read mix x thread count. Each cell runs for a
+ * fixed time: an operation is a get() with probability read%, otherwise the
+ * cell's write operation. One operation in 16 is timed into a per-thread
+ * log-linear histogram (8 sub-buckets per power of two, ~12% resolution),
+ * so the clock reads barely affect throughput. Fairness is the coefficient
+ * of variation of operations completed per thread (0 = perfectly even).
+ *
+ * Options: --threads N (max, default hardware threads), --ms N (per cell,
+ * default 50), --pin (pthread_setaffinity_np, thread i -> i-th allowed CPU),
+ * --json FILE, --matrix-only, --no-matrix
+ *
+ * Usage:
+ *   matrix::run<uint128_t>(opt, "uint128_thread_safety_matrix",
+ *                          matrix::wrapper<ThreadSafeUint128>{"Mutex"}, ...);
+ */
+
+#ifndef THREAD_SAFETY_MATRIX_HPP
+#define THREAD_SAFETY_MATRIX_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace matrix
+{
+
+enum class op { get, set, add, cas, fetch_add };
+
+inline const char* op_name(op o)
+{
+    switch (o) {
+    case op::get:
+        return "get";
+    case op::set:
+        return "set";
+    case op::add:
+        return "add";
+    case op::cas:
+        return "CAS";
+    case op::fetch_add:
+        return "fetch_add";
+    }
+    return "?";
+}
+
+struct options {
+    unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned duration_ms = 50;
+    bool pin = false;
+    bool run_legacy = true;
+    bool run_matrix = true;
+    std::string json_path;
+};
+
+// Wrapper type W benchmarked under a display name
+template <typename W> struct wrapper {
+    const char* name;
+};
+
+// Uniform get/set/add/CAS/fetch_add over wrappers with different APIs
+template <typename T, typename W> T do_get(W& w)
+{
+    if constexpr (requires { w.get(); }) {
+        return w.get();
+    } else {
+        return w.load();
+    }
+}
+
+template <typename T, typename W> void do_write(W& w, op o, T v)
+{
+    switch (o) {
+    case op::get:
+        break;
+    case op::set:
+        if constexpr (requires { w.set(v); }) {
+            w.set(v);
+        } else {
+            w.store(v);
+        }
+        break;
+    case op::add:
+        if constexpr (requires { w.add(v); }) {
+            w.add(v);
+        } else {
+            (void)w.fetch_add(v);
+        }
+        break;
+    case op::cas: {
+        T expected = do_get<T>(w);
+        if constexpr (requires { w.compare_exchange(expected, v); }) {
+            (void)w.compare_exchange(expected, expected + v);
+        } else if constexpr (requires { w.compare_exchange_strong(expected, v); }) {
+            (void)w.compare_exchange_strong(expected, expected + v);
+        } else {
+            w.update([&](T cur) { return cur == expected ? expected + v : cur; });
+        }
+        break;
+    }
+    case op::fetch_add:
+        (void)w.fetch_add(v);
+        break;
+    }
+}
+
+class latency_histogram
+{
+  public:
+    static constexpr unsigned sub_bits = 3;
+    static constexpr unsigned buckets = 64 << sub_bits;
+
+    void record(uint64_t ns)
+    {
+        ++counts_[index(ns)];
+        ++total_;
+    }
+
+    void merge(const latency_histogram& other)
+    {
+        for (unsigned i = 0; i < buckets; ++i)
+            counts_[i] += other.counts_[i];
+        total_ += other.total_;
+    }
+
+    // Midpoint of the bucket holding the p-quantile, in ns
+    double percentile(double p) const
+    {
+        if (total_ == 0)
+            return 0.0;
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p * total_)));
+        uint64_t seen = 0;
+        for (unsigned i = 0; i < buckets; ++i) {
+            seen += counts_[i];
+            if (seen >= rank)
+                return midpoint(i);
+        }
+        return midpoint(buckets - 1);
+    }
+
+  private:
+    static unsigned index(uint64_t ns)
+    {
+        if (ns < (1u << sub_bits))
+            return static_cast<unsigned>(ns);
+        const unsigned shift = static_cast<unsigned>(std::bit_width(ns)) - 1 - sub_bits;
+        return ((shift + 1) << sub_bits) + static_cast<unsigned>((ns >> shift) - (1u << sub_bits));
+    }
+
+    static double midpoint(unsigned i)
+    {
+        if (i < (1u << sub_bits))
+            return static_cast<double>(i);
+        const unsigned shift = (i >> sub_bits) - 1;
+        const double lo = std::ldexp(static_cast<double>((i & ((1u << sub_bits) - 1)) + (1u << sub_bits)), shift);
+        return lo + std::ldexp(0.5, shift);
+    }
+
+    std::array<uint64_t, buckets> counts_{};
+    uint64_t total_ = 0;
+};
+
+// Pins the calling thread to the index-th CPU of the process affinity mask
+inline void pin_to_cpu(unsigned index)
+{
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+        return;
+    std::vector<int> cpus;
+    for (int c = 0; c < CPU_SETSIZE; ++c)
+        if (CPU_ISSET(c, &allowed))
+            cpus.push_back(c);
+    if (cpus.empty())
+        return;
+    cpu_set_t one;
+    CPU_ZERO(&one);
+    CPU_SET(cpus[index % cpus.size()], &one);
+    pthread_setaffinity_np(pthread_self(), sizeof(one), &one);
+#else
+    (void)index;
+#endif
+}
+
+struct cell_result {
+    std::string wrapper;
+    op operation;
+    unsigned read_pct;
+    unsigned threads;
+    double ops_per_sec;
+    double p50_ns;
+    double p99_ns;
+    double p999_ns;
+    double fairness_cv;
+};
+
+inline std::vector<cell_result> g_cells;
+
+// Cost of the two clock reads around a timed operation, subtracted from samples
+inline uint64_t g_clock_overhead_ns = 0;
+
+inline void calibrate_clock()
+{
+    using clock = std::chrono::steady_clock;
+    std::vector<uint64_t> samples(4096);
+    for (auto& s : samples) {
+        const auto t0 = clock::now();
+        const auto t1 = clock::now();
+        s = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    }
+    std::sort(samples.begin(), samples.end());
+    g_clock_overhead_ns = samples[samples.size() / 2];
+}
+
+template <typename T, typename W>
+cell_result run_cell(const std::string& name, op o, unsigned read_pct, unsigned threads,
+                     const options& opt)
+{
+    using clock = std::chrono::steady_clock;
+    W w(T(0));
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> ops(threads);
+    std::vector<latency_histogram> hist(threads);
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            if (opt.pin)
+                pin_to_cpu(t);
+            uint64_t rng = 0x9E3779B97F4A7C15ull * (t + 1);
+            uint64_t n = 0;
+            uint64_t acc = 0;
+            ready.fetch_add(1);
+            while (!start.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int k = 0; k < 64; ++k, ++n) {
+                    rng ^= rng << 13;
+                    rng ^= rng >> 7;
+                    rng ^= rng << 17;
+                    const bool read = (rng % 100) < read_pct;
+                    if ((n & 15) == 0) {
+                        const auto t0 = clock::now();
+                        if (read)
+                            acc += do_get<T>(w).low();
+                        else
+                            do_write(w, o, T(1));
+                        const auto t1 = clock::now();
+                        const auto ns = static_cast<uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+                        hist[t].record(ns > g_clock_overhead_ns ? ns - g_clock_overhead_ns : 0);
+                    } else if (read) {
+                        acc += do_get<T>(w).low();
+                    } else {
+                        do_write(w, o, T(1));
+                    }
+                }
+            }
+            ops[t] = n;
+            volatile uint64_t sink = acc;
+            (void)sink;
+        });
+    }
+
+    while (ready.load() < threads)
+        std::this_thread::yield();
+    const auto t0 = clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(opt.duration_ms));
+    stop.store(true);
+    for (auto& th : pool)
+        th.join();
+    const double seconds = std::chrono::duration<double>(clock::now() - t0).count();
+
+    latency_histogram all;
+    double total = 0.0;
+    for (unsigned t = 0; t < threads; ++t) {
+        all.merge(hist[t]);
+        total += static_cast<double>(ops[t]);
+    }
+    const double mean = total / threads;
+    double var = 0.0;
+    for (uint64_t n : ops)
+        var += (static_cast<double>(n) - mean) * (static_cast<double>(n) - mean);
+    const double cv = mean > 0.0 ? std::sqrt(var / threads) / mean : 0.0;
+
+    return {name,           o, read_pct, threads, total / seconds, all.percentile(0.50),
+            all.percentile(0.99), all.percentile(0.999), cv};
+}
+
+inline void print_cell(const cell_result& c)
+{
+    std::cout << std::left << std::setw(12) << c.wrapper << std::setw(11) << op_name(c.operation)
+              << std::right << std::setw(6) << c.read_pct << std::setw(5) << c.threads
+              << std::fixed << std::setprecision(2) << std::setw(10) << c.ops_per_sec / 1e6
+              << std::setprecision(0) << std::setw(9) << c.p50_ns << std::setw(9) << c.p99_ns
+              << std::setw(9) << c.p999_ns << std::setprecision(3) << std::setw(10)
+              << c.fairness_cv << std::endl;
+}
+
+template <typename T, typename W>
+void run_wrapper(const std::string& name, const std::vector<unsigned>& sweep, const options& opt)
+{
+    for (unsigned threads : sweep) {
+        g_cells.push_back(run_cell<T, W>(name, op::get, 100, threads, opt));
+        print_cell(g_cells.back());
+        for (op o : {op::set, op::add, op::cas, op::fetch_add}) {
+            for (unsigned read_pct : {0u, 50u, 90u, 99u}) {
+                g_cells.push_back(run_cell<T, W>(name, o, read_pct, threads, opt));
+                print_cell(g_cells.back());
+            }
+        }
+    }
+}
+
+inline void export_json(const std::string& filename, const std::string& benchmark,
+                        const options& opt)
+{
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open " << filename << std::endl;
+        return;
+    }
+
+    file << "{\n";
+    file << "  \"benchmark\": \"" << benchmark << "\",\n";
+    file << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    file << "  \"duration_ms\": " << opt.duration_ms << ",\n";
+    file << "  \"pinned\": " << (opt.pin ? "true" : "false") << ",\n";
+    file << "  \"clock_overhead_ns\": " << g_clock_overhead_ns << ",\n";
+    file << "  \"cells\": [\n";
+    for (size_t i = 0; i < g_cells.size(); ++i) {
+        const auto& c = g_cells[i];
+        file << "    {\"wrapper\": \"" << c.wrapper << "\", \"op\": \"" << op_name(c.operation)
+             << "\", \"read_pct\": " << c.read_pct << ", \"threads\": " << c.threads
+             << std::fixed << std::setprecision(0) << ", \"ops_per_sec\": " << c.ops_per_sec
+             << std::setprecision(1) << ", \"p50_ns\": " << c.p50_ns << ", \"p99_ns\": "
+             << c.p99_ns << ", \"p999_ns\": " << c.p999_ns << std::setprecision(4)
+             << ", \"fairness_cv\": " << c.fairness_cv << "}";
+        if (i < g_cells.size() - 1) {
+            file << ",";
+        }
+        file << "\n";
+    }
+    file << "  ]\n";
+    file << "}\n";
+
+    file.close();
+    std::cout << "Results exported to: " << filename << std::endl;
+}
+
+// Runs the whole matrix over value type T for each wrapper, in order
+template <typename T, typename... Ws>
+void run(const options& opt, const std::string& benchmark, wrapper<Ws>... wrappers)
+{
+    std::vector<unsigned> sweep;
+    for (unsigned t = 1; t < opt.max_threads; t *= 2)
+        sweep.push_back(t);
+    sweep.push_back(opt.max_threads);
+
+    calibrate_clock();
+    std::cout << "\n=== Scaling Matrix ===" << std::endl;
+    std::cout << "Threads: 1-" << opt.max_threads << ", " << opt.duration_ms
+              << " ms per cell, pinning " << (opt.pin ? "on" : "off") << ", clock overhead "
+              << g_clock_overhead_ns << " ns (subtracted)\n" << std::endl;
+    std::cout << std::left << std::setw(12) << "Wrapper" << std::setw(11) << "Op" << std::right
+              << std::setw(6) << "Read%" << std::setw(5) << "Thr" << std::setw(10) << "Mops/s"
+              << std::setw(9) << "p50 ns" << std::setw(9) << "p99 ns" << std::setw(9)
+              << "p999 ns" << std::setw(10) << "fair(cv)" << std::endl;
+    std::cout << std::string(81, '-') << std::endl;
+
+    (run_wrapper<T, Ws>(wrappers.name, sweep, opt), ...);
+
+    if (!opt.json_path.empty())
+        export_json(opt.json_path, benchmark, opt);
+}
+
+inline options parse_options(int argc, char* argv[])
+{
+    options opt;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc)
+            opt.max_threads = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--ms" && i + 1 < argc)
+            opt.duration_ms = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        else if (arg == "--pin")
+            opt.pin = true;
+        else if (arg == "--json" && i + 1 < argc)
+            opt.json_path = argv[++i];
+        else if (arg == "--matrix-only")
+            opt.run_legacy = false;
+        else if (arg == "--no-matrix")
+            opt.run_matrix = false;
+        else
+            std::cerr << "Ignoring unknown option: " << arg << std::endl;
+    }
+    return opt;
+}
+
+} // namespace matrix
+
+#endif // THREAD_SAFETY_MATRIX_HPP
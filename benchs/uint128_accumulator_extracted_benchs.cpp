@@ -0,0 +1,190 @@
+/*
+ * Benchmarks para uint128_accumulator.hpp
+ * Coste de la exactitud: suma módulo 2^128 frente a acumuladores anchos
+ * (iterador, span vectorizado, multihilo), producto escalar y estadísticas
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/uint128/uint128_accumulator.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_elem;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por elemento
+double time_per_elem(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(14) << kernel << std::setw(12) << variant
+              << std::right << std::fixed << std::setprecision(3) << std::setw(10) << ns
+              << " ns/elem" << std::setw(10) << std::setprecision(2) << (1.0 / ns) << " elem/ns\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+const char* level_name(intrinsics::simd_level level)
+{
+    switch (level) {
+    case intrinsics::simd_level::avx512:
+        return "span-avx512";
+    case intrinsics::simd_level::avx2:
+        return "span-avx2";
+    default:
+        return "span-scalar";
+    }
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+void run_benchmarks(std::size_t n)
+{
+    std::mt19937_64 rng(42);
+    std::vector<uint128_t> u(n);
+    std::vector<int128_t> s(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        u[i] = uint128_t(rng(), rng());
+        s[i] = int128_t(rng(), rng());
+    }
+    const std::span<const uint128_t> us(u);
+    const std::span<const int128_t> ss(s);
+    const int reps = 5;
+
+    std::cout << "\n--- " << n << " elementos ---\n";
+
+    // Referencia: suma módulo 2^128 (lo que hace nstd::accumulate)
+    report("sum u128", "wrapping", time_per_elem(n, reps, [&] {
+               uint128_t acc(0);
+               for (const auto& x : u)
+                   acc += x;
+               g_sink = g_sink + acc.low();
+           }));
+    report("sum u128", "iterator", time_per_elem(n, reps, [&] {
+               g_sink = g_sink + accumulate_exact(u.begin(), u.end()).limb(0);
+           }));
+    report("sum i128", "iterator", time_per_elem(n, reps, [&] {
+               g_sink = g_sink + accumulate_exact(s.begin(), s.end()).limb(0);
+           }));
+
+    for (auto level : {intrinsics::simd_level::scalar, intrinsics::simd_level::avx2,
+                       intrinsics::simd_level::avx512}) {
+        if (static_cast<int>(level) > static_cast<int>(intrinsics::best_simd_level())) {
+            continue;
+        }
+        intrinsics::force_simd_level(level);
+        report("sum u128", level_name(level),
+               time_per_elem(n, reps, [&] { g_sink = g_sink + accumulate_exact(us).limb(0); }));
+        report("sum i128", level_name(level),
+               time_per_elem(n, reps, [&] { g_sink = g_sink + accumulate_exact(ss).limb(0); }));
+    }
+    intrinsics::reset_simd_level();
+
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned t : {1u, 2u, 4u, hw}) {
+        report("sum u128", "par x" + std::to_string(t), time_per_elem(n, reps, [&] {
+                   g_sink = g_sink + parallel_accumulate_exact(us, execution::par(t)).limb(0);
+               }));
+    }
+
+    report("dot u128", "wrapping", time_per_elem(n, reps, [&] {
+               uint128_t acc(0);
+               for (std::size_t i = 0; i < n; ++i)
+                   acc += u[i] * u[i];
+               g_sink = g_sink + acc.low();
+           }));
+    report("dot u128", "exact", time_per_elem(n, reps, [&] {
+               g_sink = g_sink + inner_product_exact(u.begin(), u.end(), u.begin()).limb(0);
+           }));
+    report("dot i128", "exact", time_per_elem(n, reps, [&] {
+               g_sink = g_sink + inner_product_exact(s.begin(), s.end(), s.begin()).limb(0);
+           }));
+    report("dot u128", "par x" + std::to_string(hw), time_per_elem(n, reps, [&] {
+               g_sink = g_sink + parallel_inner_product_exact(us, us, execution::par).limb(0);
+           }));
+
+    report("stats u128", "exact", time_per_elem(n, reps, [&] {
+               g_sink = g_sink + calculate_stats_exact(u.begin(), u.end()).count;
+           }));
+    report("stats u128", "par x" + std::to_string(hw), time_per_elem(n, reps, [&] {
+               g_sink = g_sink + parallel_calculate_stats_exact(us, execution::par).count;
+           }));
+    report("variance", "finalize", time_per_elem(1, reps, [&] {
+               static const auto st = calculate_stats_exact(u.begin(), u.begin() + 16);
+               g_sink = g_sink + static_cast<uint64_t>(st.variance() > 0);
+           }));
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Exact Accumulator Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    const auto& cpu = intrinsics::cpu();
+    std::cout << "CPU: avx2=" << cpu.avx2 << " avx512f=" << cpu.avx512f
+              << " threads=" << std::thread::hardware_concurrency() << "\n";
+
+    run_benchmarks(4096);    // En L1/L2
+    run_benchmarks(1 << 22); // Limitado por memoria
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
@@ -0,0 +1,331 @@
+/*
+ * Benchmarks para uint128_atomic.hpp
+ * atomic128 (cmpxchg16b / vmovdqa) frente a std::atomic<uint128_t> (libatomic),
+ * que era la base de ThreadSafeUint128Atomic: operaciones sin contención,
+ * contador CAS compartido con varios hilos, escalado de fetch_add de 1 a 64
+ * hilos con y sin espera exponencial, latencia de wait/notify e histograma
+ * compartido con atomic_ref128 frente a un mutex
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/uint128/uint128_atomic.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(18) << kernel << std::setw(16) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/op\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+template <typename Atomic> void bench_uncontended(const std::string& name)
+{
+    constexpr std::size_t n = 1 << 20;
+    Atomic a(uint128_t(0));
+
+    report("load", name, time_per_op(n, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < n; ++i)
+                   acc += a.load(std::memory_order_acquire).low();
+               g_sink = g_sink + acc;
+           }));
+    report("store seq_cst", name, time_per_op(n, 5, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   a.store(uint128_t(i, i));
+           }));
+    report("store release", name, time_per_op(n, 5, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   a.store(uint128_t(i, i), std::memory_order_release);
+           }));
+    report("exchange", name, time_per_op(n, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < n; ++i)
+                   acc += a.exchange(uint128_t(0, i)).low();
+               g_sink = g_sink + acc;
+           }));
+    report("CAS increment", name, time_per_op(n, 5, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   uint128_t cur = a.load(std::memory_order_relaxed);
+                   while (!a.compare_exchange_weak(cur, cur + uint128_t(1))) {
+                   }
+               }
+           }));
+}
+
+template <typename Atomic> void bench_contended(const std::string& name, unsigned threads)
+{
+    constexpr std::size_t per_thread = 1 << 18;
+    Atomic counter(uint128_t(0));
+
+    const double ns = time_per_op(per_thread * threads, 3, [&] {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&] {
+                for (std::size_t i = 0; i < per_thread; ++i) {
+                    uint128_t cur = counter.load(std::memory_order_relaxed);
+                    while (!counter.compare_exchange_weak(cur, cur + uint128_t(1))) {
+                    }
+                }
+            });
+        }
+        for (auto& th : pool)
+            th.join();
+    });
+    report("CAS contended", name + " x" + std::to_string(threads), ns);
+
+    // Mezcla 90% lecturas / 10% escrituras
+    const double mixed = time_per_op(per_thread * threads, 3, [&] {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                uint64_t acc = 0;
+                for (std::size_t i = 0; i < per_thread; ++i) {
+                    if ((i + t) % 10 == 0)
+                        counter.store(uint128_t(i, t), std::memory_order_release);
+                    else
+                        acc += counter.load(std::memory_order_acquire).low();
+                }
+                g_sink = g_sink + acc;
+            });
+        }
+        for (auto& th : pool)
+            th.join();
+    });
+    report("90% load", name + " x" + std::to_string(threads), mixed);
+}
+
+// Escalado fuerte: 2^20 incrementos repartidos entre `threads` hilos
+template <typename Increment>
+void bench_scaling(const std::string& kernel, unsigned threads, Increment&& increment)
+{
+    constexpr std::size_t total = 1 << 20;
+    const std::size_t per_thread = total / threads;
+    const double ns = time_per_op(per_thread * threads, 3, [&] {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&] {
+                for (std::size_t i = 0; i < per_thread; ++i)
+                    increment();
+            });
+        }
+        for (auto& th : pool)
+            th.join();
+    });
+    std::string variant = "x";
+    variant += std::to_string(threads);
+    report(kernel, variant, ns);
+}
+
+void bench_fetch_add_scaling()
+{
+    std::atomic<uint128_t> std_counter(uint128_t(0));
+    atomic_uint128 counter;
+    uint128_threadsafe::ThreadSafeUint128 mutex_counter(uint128_t(0));
+    const backoff_policy none{0, 0, false};
+
+    for (unsigned t : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+        bench_scaling("std::atomic CAS", t, [&] {
+            uint128_t cur = std_counter.load(std::memory_order_relaxed);
+            while (!std_counter.compare_exchange_weak(cur, cur + uint128_t(1))) {
+            }
+        });
+        bench_scaling("mutex add", t, [&] { mutex_counter.add(uint128_t(1)); });
+        bench_scaling("fetch_add nobkf", t,
+                      [&] { counter.fetch_add(uint128_t(1), std::memory_order_relaxed, none); });
+        bench_scaling("fetch_add", t,
+                      [&] { counter.fetch_add(uint128_t(1), std::memory_order_relaxed); });
+    }
+}
+
+// Ida y vuelta entre dos hilos que se bloquean con wait() y despiertan con notify_one()
+void bench_wait_notify()
+{
+    constexpr int rounds = 20000;
+    atomic_uint128 turn;
+    const double ns = time_per_op(rounds, 3, [&] {
+        turn.store(uint128_t(0));
+        std::thread pong([&] {
+            for (int i = 0; i < rounds; ++i) {
+                turn.wait(uint128_t(2 * i));
+                turn.store(uint128_t(2 * i + 2));
+                turn.notify_one();
+            }
+        });
+        for (int i = 0; i < rounds; ++i) {
+            turn.store(uint128_t(2 * i + 1));
+            turn.notify_one();
+            turn.wait(uint128_t(2 * i + 1));
+        }
+        pong.join();
+    });
+    report("wait/notify", "round trip", ns);
+
+    // notify sin hilos esperando: no debe haber llamada al sistema
+    report("notify_one", "no waiters", time_per_op(1 << 20, 5, [&] {
+               for (int i = 0; i < (1 << 20); ++i)
+                   turn.notify_one();
+           }));
+}
+
+// Histograma de 64 cubetas sobre un array existente: incrementos sueltos con
+// atomic_ref128 frente a un único mutex, y volcado de histogramas locales
+void bench_histogram()
+{
+    constexpr std::size_t buckets = 64;
+    constexpr std::size_t per_thread = 1 << 18;
+    alignas(16) uint128_t table[buckets] = {};
+    std::mutex table_mutex;
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+
+    auto run = [&](const std::string& kernel, unsigned threads, auto&& body) {
+        const double ns = time_per_op(per_thread * threads, 3, [&] {
+            std::vector<std::thread> pool;
+            for (unsigned t = 0; t < threads; ++t) {
+                pool.emplace_back([&, t] { body(t); });
+            }
+            for (auto& th : pool)
+                th.join();
+        });
+        std::string variant = "x";
+        variant += std::to_string(threads);
+        report(kernel, variant, ns);
+    };
+
+    for (unsigned t : {1u, 4u, hw}) {
+        run("hist mutex", t, [&](unsigned id) {
+            for (std::size_t i = 0; i < per_thread; ++i) {
+                std::lock_guard<std::mutex> guard(table_mutex);
+                table[(i * 7 + id) % buckets] += uint128_t(1);
+            }
+        });
+        run("hist atomic_ref", t, [&](unsigned id) {
+            for (std::size_t i = 0; i < per_thread; ++i)
+                atomic_ref128<uint128_t>(table[(i * 7 + id) % buckets])
+                    .fetch_add(uint128_t(1), std::memory_order_relaxed);
+        });
+        run("hist local+merge", t, [&](unsigned id) {
+            uint128_t local[buckets] = {};
+            for (std::size_t i = 0; i < per_thread; ++i)
+                local[(i * 7 + id) % buckets] += uint128_t(1);
+            atomic_add_each(std::span<uint128_t>(table), std::span<const uint128_t>(local));
+        });
+        if (t == hw)
+            break;
+    }
+
+    alignas(16) uint128_t snapshot[buckets];
+    report("atomic_load_all", "64 buckets", time_per_op(buckets * 1024, 5, [&] {
+               for (int r = 0; r < 1024; ++r)
+                   atomic_load_all(std::span<uint128_t>(table), std::span<uint128_t>(snapshot));
+               g_sink = g_sink + snapshot[0].low();
+           }));
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Atomic Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "std::atomic<uint128_t> lock-free: " << std::atomic<uint128_t>().is_lock_free()
+              << "\natomic128 lock-free: " << atomic_uint128().is_lock_free()
+              << " (cx16=" << intrinsics::cpu().cx16
+              << ", vmovdqa16=" << intrinsics::cpu().atomic_vmov16 << ")\n";
+
+    std::cout << "\n--- Sin contención ---\n";
+    bench_uncontended<std::atomic<uint128_t>>("std::atomic");
+    bench_uncontended<atomic_uint128>("atomic128");
+
+    std::cout << "\n--- Con contención ---\n";
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned t : {2u, 4u, hw}) {
+        bench_contended<std::atomic<uint128_t>>("std::atomic", t);
+        bench_contended<atomic_uint128>("atomic128", t);
+        if (t == hw)
+            break;
+    }
+
+    std::cout << "\n--- Escalado fetch_add (1-64 hilos) ---\n";
+    bench_fetch_add_scaling();
+
+    std::cout << "\n--- wait/notify ---\n";
+    bench_wait_notify();
+
+    std::cout << "\n--- Histograma con atomic_ref128 ---\n";
+    bench_histogram();
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
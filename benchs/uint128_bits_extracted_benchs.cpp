@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <iostream>
 #include <random>
+#include <vector>
 
 #ifdef _MSC_VER
 #include <intrin.h>
@@ -217,6 +218,84 @@ void benchmark_rotr()
     });
 }
 
+// Versiones con saltos anteriores, como referencia para desplazamientos aleatorios
+uint128_t branchy_shift_left(const uint128_t& v, int n)
+{
+    if (n <= 0)
+        return v;
+    if (n >= 128)
+        return uint128_t(0, 0);
+    if (n >= 64)
+        return uint128_t(v.low() << (n - 64), 0);
+    return uint128_t((v.high() << n) | (v.low() >> (64 - n)), v.low() << n);
+}
+
+uint128_t branchy_shift_right(const uint128_t& v, int n)
+{
+    if (n <= 0)
+        return v;
+    if (n >= 128)
+        return uint128_t(0, 0);
+    if (n >= 64)
+        return uint128_t(0, v.high() >> (n - 64));
+    return uint128_t(v.high() >> n, (v.low() >> n) | (v.high() << (64 - n)));
+}
+
+uint128_t branchy_rotl(const uint128_t& v, int n)
+{
+    n %= 128;
+    if (n == 0)
+        return v;
+    if (n < 0)
+        n += 128;
+    return branchy_shift_left(v, n) | branchy_shift_right(v, 128 - n);
+}
+
+void benchmark_random_shifts()
+{
+    std::cout << "\n[Benchmark] desplazamientos con cantidad aleatoria (0-127)\n";
+
+    const size_t ITERATIONS = 1 << 20;
+    // Una cantidad distinta por iteración: con una secuencia corta repetida
+    // el predictor de saltos acaba aprendiéndola y oculta el coste
+    std::vector<uint128_t> values(4096);
+    std::vector<uint8_t> amounts(ITERATIONS);
+    for (auto& v : values)
+        v = random_uint128();
+    for (auto& a : amounts)
+        a = static_cast<uint8_t>(std::uniform_int_distribution<int>(0, 127)(rng));
+
+    BENCHMARK("shift_left (branchless)", ITERATIONS, {
+        volatile uint128_t result = values[i & 4095] << amounts[i];
+        (void)result;
+    });
+    BENCHMARK("shift_left (branchy)", ITERATIONS, {
+        volatile uint128_t result = branchy_shift_left(values[i & 4095], amounts[i]);
+        (void)result;
+    });
+    BENCHMARK("shift_right (branchless)", ITERATIONS, {
+        volatile uint128_t result = values[i & 4095] >> amounts[i];
+        (void)result;
+    });
+    BENCHMARK("shift_right (branchy)", ITERATIONS, {
+        volatile uint128_t result = branchy_shift_right(values[i & 4095], amounts[i]);
+        (void)result;
+    });
+    BENCHMARK("rotl (branchless)", ITERATIONS, {
+        volatile uint128_t result = rotl(values[i & 4095], amounts[i]);
+        (void)result;
+    });
+    BENCHMARK("rotl (branchy)", ITERATIONS, {
+        volatile uint128_t result = branchy_rotl(values[i & 4095], amounts[i]);
+        (void)result;
+    });
+    BENCHMARK("funnel_shift_left", ITERATIONS, {
+        volatile uint128_t result =
+            funnel_shift_left(values[i & 4095], values[(i + 1) & 4095], amounts[i]);
+        (void)result;
+    });
+}
+
 void benchmark_reverse_bits()
 {
     std::cout << "\n[Benchmark] reverse_bits\n";
@@ -274,16 +353,67 @@ void benchmark_insert_bits()
     });
 }
 
+// Bucle bit a bit sobre las 128 posiciones (implementación anterior)
+uint128_t loop_deposit(const uint128_t& value, const uint128_t& mask)
+{
+    uint128_t result(0);
+    uint128_t src_bit(1);
+    for (int i = 0; i < 128; ++i) {
+        if ((mask & (uint128_t(1) << i)) != uint128_t(0)) {
+            if ((value & src_bit) != uint128_t(0))
+                result |= (uint128_t(1) << i);
+            src_bit <<= 1;
+        }
+    }
+    return result;
+}
+
+uint128_t loop_extract(const uint128_t& value, const uint128_t& mask)
+{
+    uint128_t result(0);
+    uint128_t dst_bit(1);
+    for (int i = 0; i < 128; ++i) {
+        if ((mask & (uint128_t(1) << i)) != uint128_t(0)) {
+            if ((value & (uint128_t(1) << i)) != uint128_t(0))
+                result |= dst_bit;
+            dst_bit <<= 1;
+        }
+    }
+    return result;
+}
+
 void benchmark_parallel_deposit()
 {
-    std::cout << "\n[Benchmark] parallel_deposit\n";
+    std::cout << "\n[Benchmark] parallel_deposit (fast_pdep=" << intrinsics::cpu().fast_pdep
+              << ")\n";
 
-    const size_t ITERATIONS = 100000;
-    uint128_t value = random_uint128();
-    uint128_t mask = random_uint128();
+    const size_t ITERATIONS = 1000000;
+    const size_t LOOP_ITERATIONS = 100000;
+    // Entradas variables para que el compilador no saque la llamada del bucle
+    uint128_t values[256], masks[256];
+    for (int k = 0; k < 256; ++k) {
+        values[k] = random_uint128();
+        masks[k] = random_uint128();
+    }
 
     BENCHMARK("parallel_deposit", ITERATIONS, {
-        volatile uint128_t result = parallel_deposit(value, mask);
+        volatile uint128_t result = parallel_deposit(values[i & 255], masks[i & 255]);
+        (void)result;
+    });
+    BENCHMARK("parallel_deposit (software)", ITERATIONS, {
+        volatile uint128_t result = uint128_bits::detail::pdep128_soft(values[i & 255], masks[i & 255]);
+        (void)result;
+    });
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (intrinsics::cpu().bmi2) {
+        BENCHMARK("parallel_deposit (BMI2)", ITERATIONS, {
+            volatile uint128_t result = uint128_bits::detail::pdep128_bmi2(values[i & 255], masks[i & 255]);
+            (void)result;
+        });
+    }
+#endif
+    BENCHMARK("parallel_deposit (bit loop)", LOOP_ITERATIONS, {
+        volatile uint128_t result = loop_deposit(values[i & 255], masks[i & 255]);
         (void)result;
     });
 }
@@ -292,12 +422,33 @@ void benchmark_parallel_extract()
 {
     std::cout << "\n[Benchmark] parallel_extract\n";
 
-    const size_t ITERATIONS = 100000;
-    uint128_t value = random_uint128();
-    uint128_t mask = random_uint128();
+    const size_t ITERATIONS = 1000000;
+    const size_t LOOP_ITERATIONS = 100000;
+    // Entradas variables para que el compilador no saque la llamada del bucle
+    uint128_t values[256], masks[256];
+    for (int k = 0; k < 256; ++k) {
+        values[k] = random_uint128();
+        masks[k] = random_uint128();
+    }
 
     BENCHMARK("parallel_extract", ITERATIONS, {
-        volatile uint128_t result = parallel_extract(value, mask);
+        volatile uint128_t result = parallel_extract(values[i & 255], masks[i & 255]);
+        (void)result;
+    });
+    BENCHMARK("parallel_extract (software)", ITERATIONS, {
+        volatile uint128_t result = uint128_bits::detail::pext128_soft(values[i & 255], masks[i & 255]);
+        (void)result;
+    });
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (intrinsics::cpu().bmi2) {
+        BENCHMARK("parallel_extract (BMI2)", ITERATIONS, {
+            volatile uint128_t result = uint128_bits::detail::pext128_bmi2(values[i & 255], masks[i & 255]);
+            (void)result;
+        });
+    }
+#endif
+    BENCHMARK("parallel_extract (bit loop)", LOOP_ITERATIONS, {
+        volatile uint128_t result = loop_extract(values[i & 255], masks[i & 255]);
         (void)result;
     });
 }
@@ -396,6 +547,7 @@ int main()
     std::cout << "\n--- uint128_bits namespace ---\n";
     benchmark_rotl();
     benchmark_rotr();
+    benchmark_random_shifts();
     benchmark_reverse_bits();
     benchmark_byteswap();
     benchmark_extract_bits();
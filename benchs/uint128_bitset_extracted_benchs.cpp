@@ -0,0 +1,241 @@
+/*
+ * Benchmarks para uint128_bitset.hpp
+ * bitset128_vector frente a std::vector<bool>: AND / ANDNOT, count,
+ * and_popcount fusionado frente a AND + count, recorrido de bits a 1 con
+ * densidad baja y alta, y to_bitset/from_bitset palabra a palabra frente al
+ * bucle bit a bit anterior
+ */
+
+#include "../include/uint128/uint128_bitset.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(18) << kernel << std::setw(16) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/op\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+std::vector<bool> random_bits(std::size_t n, unsigned per_mille, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<bool> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = rng() % 1000 < per_mille;
+    }
+    return v;
+}
+
+// Operaciones masivas: ns por palabra de 128 bits
+void bench_bulk(std::size_t n)
+{
+    const auto ra = random_bits(n, 500, 1);
+    const auto rb = random_bits(n, 500, 2);
+    const bitset128_vector a(ra), b(rb);
+    const std::size_t words = n / 128;
+    std::cout << "\n--- " << n << " bits: ns por palabra de 128 bits ---\n";
+
+    report("and", "vector<bool>", time_per_op(words, 5, [&] {
+               std::vector<bool> r(ra);
+               for (std::size_t i = 0; i < n; ++i)
+                   r[i] = r[i] && rb[i];
+               g_sink = g_sink + r[n / 2];
+           }));
+    report("and", "bitset128", time_per_op(words, 5, [&] {
+               bitset128_vector r(a);
+               r &= b;
+               g_sink = g_sink + r[n / 2];
+           }));
+    report("and_not", "bitset128", time_per_op(words, 5, [&] {
+               bitset128_vector r(a);
+               r.and_not(b);
+               g_sink = g_sink + r[n / 2];
+           }));
+    report("count", "vector<bool>", time_per_op(words, 5, [&] {
+               g_sink = g_sink + static_cast<uint64_t>(std::count(ra.begin(), ra.end(), true));
+           }));
+    report("count", "bitset128", time_per_op(words, 5, [&] { g_sink = g_sink + a.count(); }));
+    report("and+count", "bitset128", time_per_op(words, 5, [&] { g_sink = g_sink + (a & b).count(); }));
+    report("and_popcount", "bitset128", time_per_op(words, 5, [&] { g_sink = g_sink + and_popcount(a, b); }));
+}
+
+// Recorrido de bits a 1: ns por bit a 1 encontrado
+void bench_iteration(std::size_t n, unsigned per_mille)
+{
+    const auto ref = random_bits(n, per_mille, 3);
+    const bitset128_vector bs(ref);
+    const std::size_t ones = bs.count();
+    const std::string density = std::to_string(per_mille / 10.0).substr(0, 4) + "%";
+    std::cout << "\n--- Recorrido de unos, " << n << " bits al " << density << " ---\n";
+
+    report("scan", "vector<bool>", time_per_op(ones, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < n; ++i)
+                   if (ref[i])
+                       acc += i;
+               g_sink = g_sink + acc;
+           }));
+    report("scan test(i)", "bitset128", time_per_op(ones, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < n; ++i)
+                   if (bs[i])
+                       acc += i;
+               g_sink = g_sink + acc;
+           }));
+    report("ones()", "bitset128", time_per_op(ones, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i : bs.ones())
+                   acc += i;
+               g_sink = g_sink + acc;
+           }));
+    report("for_each_set", "bitset128", time_per_op(ones, 5, [&] {
+               uint64_t acc = 0;
+               bs.for_each_set([&](std::size_t i) { acc += i; });
+               g_sink = g_sink + acc;
+           }));
+    report("find_next", "bitset128", time_per_op(ones, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = bs.find_first(); i != bitset128_vector::npos; i = bs.find_next(i))
+                   acc += i;
+               g_sink = g_sink + acc;
+           }));
+}
+
+// Conversión con std::bitset<128>: ns por valor
+void bench_bitset_conversion()
+{
+    constexpr std::size_t n = 1 << 16;
+    std::mt19937_64 rng(4);
+    std::vector<uint128_t> values(n);
+    for (auto& v : values)
+        v = uint128_t(rng(), rng());
+    std::vector<std::bitset<128>> bitsets(n);
+    std::cout << "\n--- std::bitset<128> ---\n";
+
+    // Bucles bit a bit de la versión anterior
+    report("to_bitset", "bit loop", time_per_op(n, 5, [&] {
+               for (std::size_t k = 0; k < n; ++k) {
+                   std::bitset<128> r;
+                   for (int i = 0; i < 64; ++i) {
+                       if ((values[k].low() & (1ULL << i)) != 0)
+                           r.set(i);
+                       if ((values[k].high() & (1ULL << i)) != 0)
+                           r.set(64 + i);
+                   }
+                   bitsets[k] = r;
+               }
+           }));
+    report("to_bitset", "word", time_per_op(n, 5, [&] {
+               for (std::size_t k = 0; k < n; ++k)
+                   bitsets[k] = to_bitset(values[k]);
+           }));
+    report("from_bitset", "bit loop", time_per_op(n, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t k = 0; k < n; ++k) {
+                   uint64_t lo = 0, hi = 0;
+                   for (int i = 0; i < 64; ++i) {
+                       lo |= uint64_t(bitsets[k][i]) << i;
+                       hi |= uint64_t(bitsets[k][64 + i]) << i;
+                   }
+                   acc += lo ^ hi;
+               }
+               g_sink = g_sink + acc;
+           }));
+    report("from_bitset", "word", time_per_op(n, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t k = 0; k < n; ++k) {
+                   const uint128_t v = from_bitset(bitsets[k]);
+                   acc += v.low() ^ v.high();
+               }
+               g_sink = g_sink + acc;
+           }));
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Bitset Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+
+    bench_bulk(1 << 15); // 4 KiB: en L1
+    bench_bulk(1 << 26); // 8 MiB
+
+    bench_iteration(1 << 22, 10);
+    bench_iteration(1 << 22, 500);
+
+    bench_bitset_conversion();
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
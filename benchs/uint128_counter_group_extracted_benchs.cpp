@@ -0,0 +1,227 @@
+/*
+ * Benchmarks para uint128_counter_group.hpp
+ * Latencia de snapshot() (p50/p99/máx.) con escritores saturando un grupo de
+ * 16 contadores, frente a leer 16 ThreadSafeUint128 uno a uno (incoherente)
+ * y a un único mutex sobre el array; coste de los incrementos sin lecturas
+ */
+
+#include "../include/uint128/uint128_counter_group.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+using namespace nstd::uint128_threadsafe;
+
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(20) << kernel << std::setw(10) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/op\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+constexpr std::size_t counters = 16;
+
+// Mutex único sobre un array: instantánea consistente, pero bloquea escritores
+struct locked_group {
+    std::mutex mutex;
+    std::array<uint128_t, counters> values{};
+
+    void add(std::size_t i, uint128_t delta)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        values[i] += delta;
+    }
+
+    std::array<uint128_t, counters> snapshot()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return values;
+    }
+};
+
+// N contadores independientes leídos uno a uno: sin coherencia entre ellos
+struct independent_group {
+    std::array<ThreadSafeUint128, counters> values;
+
+    void add(std::size_t i, uint128_t delta)
+    {
+        values[i].add(delta);
+    }
+
+    std::array<uint128_t, counters> snapshot()
+    {
+        std::array<uint128_t, counters> out;
+        for (std::size_t i = 0; i < counters; ++i)
+            out[i] = values[i].get();
+        return out;
+    }
+};
+
+// `writers` hilos incrementan sin parar mientras el hilo principal toma
+// instantáneas durante ~200 ms; informa p50, p99 y máximo de snapshot()
+template <typename Group> void bench_snapshot_latency(const std::string& name, unsigned writers)
+{
+    using clock = std::chrono::steady_clock;
+    Group group;
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> writes{0};
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < writers; ++t) {
+        pool.emplace_back([&, t] {
+            uint64_t n = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int k = 0; k < 64; ++k, ++n)
+                    group.add((n * 7 + t) % counters, uint128_t(n));
+            }
+            writes.fetch_add(n);
+        });
+    }
+
+    std::vector<double> latencies;
+    const auto deadline = clock::now() + std::chrono::milliseconds(200);
+    const auto t0 = clock::now();
+    while (clock::now() < deadline) {
+        const auto a = clock::now();
+        const auto s = group.snapshot();
+        const auto b = clock::now();
+        g_sink = g_sink + s[0].low();
+        latencies.push_back(
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count()));
+    }
+    stop.store(true);
+    for (auto& th : pool)
+        th.join();
+    const double elapsed = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - t0).count());
+
+    std::sort(latencies.begin(), latencies.end());
+    auto pct = [&](double p) {
+        return latencies[std::min(latencies.size() - 1,
+                                  static_cast<std::size_t>(p * static_cast<double>(latencies.size())))];
+    };
+    std::string variant = "x";
+    variant += std::to_string(writers);
+    report(name + " p50", variant, pct(0.50));
+    report(name + " p99", variant, pct(0.99));
+    report(name + " max", variant, latencies.back());
+    report(name + " write", variant, writers ? elapsed / static_cast<double>(writes.load()) : 0.0);
+}
+
+// Incrementos sin lectores: coste del anuncio de época frente a los demás
+void bench_add()
+{
+    constexpr std::size_t n = 1 << 20;
+    counter_group128<counters> group;
+    locked_group locked;
+    independent_group independent;
+    report("add", "counter_group", time_per_op(n, 5, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   group.add(i % counters, uint128_t(i));
+           }));
+    report("add 4 at once", "counter_group", time_per_op(n, 5, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   group.add({{0, uint128_t(1)}, {1, uint128_t(i)}, {2, uint128_t(1)},
+                              {3, uint128_t(i)}});
+           }));
+    report("add", "single mutex", time_per_op(n, 5, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   locked.add(i % counters, uint128_t(i));
+           }));
+    report("add", "16 x Mutex", time_per_op(n, 5, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   independent.add(i % counters, uint128_t(i));
+           }));
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Counter Group Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    std::cout << "\n--- Incrementos sin lectores ---\n";
+    bench_add();
+
+    std::cout << "\n--- Latencia de instantánea con escritores (ns) ---\n";
+    for (unsigned w : {0u, 1u, 4u, 16u}) {
+        bench_snapshot_latency<counter_group128<counters>>("group", w);
+        bench_snapshot_latency<locked_group>("mutex", w);
+        bench_snapshot_latency<independent_group>("16xMutex", w);
+    }
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
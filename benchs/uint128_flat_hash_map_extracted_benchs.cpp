@@ -0,0 +1,210 @@
+/*
+ * Benchmarks para uint128_flat_hash_map.hpp
+ * Compara nstd::flat_hash_map con std::unordered_map (hash XOR antiguo y hash128)
+ * sobre claves secuenciales, con stride y aleatorias
+ */
+
+#include "../include/uint128/uint128_flat_hash_map.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_traits.hpp"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string name;
+    std::string keys;
+    double insert_ns;
+    double find_hit_ns;
+    double find_miss_ns;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+// Evita que el compilador elimine resultados
+volatile uint64_t g_sink = 0;
+
+// Hash anterior de nstd::hash<uint128_t>: high ^ low (referencia)
+struct xor_hash {
+    size_t operator()(const uint128_t& value) const noexcept
+    {
+        return static_cast<size_t>(value.high() ^ value.low());
+    }
+};
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// =============================================================================
+// GENERADORES DE CLAVES
+// =============================================================================
+
+std::vector<uint128_t> make_sequential(size_t n, uint64_t base)
+{
+    std::vector<uint128_t> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys.emplace_back(base, static_cast<uint64_t>(i)); // p.ej. IPv6 dentro de un /64
+    }
+    return keys;
+}
+
+std::vector<uint128_t> make_strided(size_t n, uint64_t base)
+{
+    std::vector<uint128_t> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        // Stride 2^64: sólo varía la parte alta, baja fija
+        keys.emplace_back(base + static_cast<uint64_t>(i), 0x1000);
+    }
+    return keys;
+}
+
+std::vector<uint128_t> make_diagonal(size_t n, uint64_t base)
+{
+    std::vector<uint128_t> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        // Stride 2^64 + 1: high == low, todas colisionan con el hash XOR
+        const uint64_t v = base + static_cast<uint64_t>(i);
+        keys.emplace_back(v, v);
+    }
+    return keys;
+}
+
+std::vector<uint128_t> make_random(size_t n, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<uint128_t> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys.emplace_back(rng(), rng());
+    }
+    return keys;
+}
+
+// =============================================================================
+// MEDICIÓN
+// =============================================================================
+
+template <typename Map>
+BenchmarkResult run_map(const std::string& name, const std::string& key_kind,
+                        const std::vector<uint128_t>& keys, const std::vector<uint128_t>& misses)
+{
+    using clock = std::chrono::high_resolution_clock;
+    Map map;
+
+    auto t0 = clock::now();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        map[keys[i]] = i;
+    }
+    auto t1 = clock::now();
+
+    uint64_t acc = 0;
+    for (const auto& k : keys) {
+        auto it = map.find(k);
+        acc += (it != map.end()) ? static_cast<uint64_t>(it->second) : 0;
+    }
+    auto t2 = clock::now();
+
+    for (const auto& k : misses) {
+        acc += (map.find(k) != map.end()) ? 1 : 0;
+    }
+    auto t3 = clock::now();
+    g_sink = g_sink + acc;
+
+    auto ns = [](auto a, auto b, size_t n) {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count()) /
+               static_cast<double>(n);
+    };
+    return {name, key_kind, ns(t0, t1, keys.size()), ns(t1, t2, keys.size()),
+            ns(t2, t3, misses.size())};
+}
+
+void print_header()
+{
+    std::cout << std::left << std::setw(44) << "Container" << std::setw(12) << "Keys" << std::right
+              << std::setw(12) << "insert ns" << std::setw(12) << "hit ns" << std::setw(12)
+              << "miss ns" << "\n";
+    std::cout << std::string(92, '-') << "\n";
+}
+
+void print_result(const BenchmarkResult& r)
+{
+    std::cout << std::left << std::setw(44) << r.name << std::setw(12) << r.keys << std::right
+              << std::fixed << std::setprecision(2) << std::setw(12) << r.insert_ns
+              << std::setw(12) << r.find_hit_ns << std::setw(12) << r.find_miss_ns << "\n";
+    g_results.push_back(r);
+}
+
+void benchmark_key_set(const std::string& kind, const std::vector<uint128_t>& keys,
+                       const std::vector<uint128_t>& misses)
+{
+    print_result(run_map<std::unordered_map<uint128_t, uint64_t, xor_hash>>(
+        "std::unordered_map (xor hash)", kind, keys, misses));
+    print_result(run_map<std::unordered_map<uint128_t, uint64_t>>("std::unordered_map (hash128)",
+                                                                  kind, keys, misses));
+    print_result(run_map<flat_hash_map<uint128_t, uint64_t>>("nstd::flat_hash_map (hash128)",
+                                                             kind, keys, misses));
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t flat_hash_map Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+#if UINT128_FLAT_HASH_MAP_SSE2
+    std::cout << "Control groups: SSE2 (16 bytes)\n";
+#else
+    std::cout << "Control groups: SWAR (8 bytes)\n";
+#endif
+
+    for (size_t n : {size_t(10000), size_t(200000), size_t(1000000)}) {
+        std::cout << "\n--- " << n << " claves ---\n";
+        print_header();
+        benchmark_key_set("sequential", make_sequential(n, 0x20010db800000000ULL),
+                          make_sequential(n, 0x20010db800000001ULL));
+        benchmark_key_set("strided", make_strided(n, 0), make_strided(n, 1ULL << 40));
+        benchmark_key_set("random", make_random(n, 42), make_random(n, 4242));
+    }
+
+    // Caso patológico del hash XOR: todas las claves van al mismo cubo y
+    // std::unordered_map degenera a O(n^2); se limita a pocas claves
+    const size_t n_diag = 10000;
+    std::cout << "\n--- " << n_diag << " claves (high == low) ---\n";
+    print_header();
+    benchmark_key_set("diagonal", make_diagonal(n_diag, 1), make_diagonal(n_diag, 1ULL << 40));
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * Benchmarks para uint128_id_allocator.hpp
+ * Identificadores por segundo de 1 a 64 hilos: id_allocator128 con bloques
+ * de 1, 64, 1024 y 16384 frente a ThreadSafeUint128::fetch_add(1) (mutex)
+ * y atomic128::fetch_add(1) por identificador
+ */
+
+#include "../include/uint128/uint128_atomic.hpp"
+#include "../include/uint128/uint128_id_allocator.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+using namespace nstd::uint128_threadsafe;
+
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(18) << kernel << std::setw(8) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/id" << std::setw(12) << 1e3 / ns << " M ids/s\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+// 2^20 identificadores repartidos entre `threads` hilos
+template <typename Next> void bench_ids(const std::string& kernel, unsigned threads, Next&& next)
+{
+    constexpr std::size_t total = 1 << 20;
+    const std::size_t per_thread = total / threads;
+    const double ns = time_per_op(per_thread * threads, 3, [&] {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&] {
+                uint64_t acc = 0;
+                for (std::size_t i = 0; i < per_thread; ++i)
+                    acc ^= next().low();
+                g_sink = g_sink + acc;
+            });
+        }
+        for (auto& th : pool)
+            th.join();
+    });
+    std::string variant = "x";
+    variant += std::to_string(threads);
+    report(kernel, variant, ns);
+}
+
+void bench_scaling()
+{
+    const uint128_t one(1);
+    for (unsigned t : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+        ThreadSafeUint128 mutex_counter(uint128_t(0));
+        atomic_uint128 atomic_counter;
+        id_allocator128 block1({.block_size = 1});
+        id_allocator128 block64({.block_size = 64});
+        id_allocator128 block1k({.block_size = 1024});
+        id_allocator128 block16k({.block_size = 16384, .sequence_bits = 96, .node_id = 7});
+
+        bench_ids("Mutex fetch_add", t, [&] { return mutex_counter.fetch_add(one); });
+        bench_ids("atomic fetch_add", t,
+                  [&] { return atomic_counter.fetch_add(one, std::memory_order_relaxed); });
+        bench_ids("block 1", t, [&] { return block1.next(); });
+        bench_ids("block 64", t, [&] { return block64.next(); });
+        bench_ids("block 1024", t, [&] { return block1k.next(); });
+        bench_ids("block 16384 node", t, [&] { return block16k.next(); });
+    }
+}
+
+// Reserva explícita de bloques, sin ranura por hilo
+void bench_reserve()
+{
+    constexpr std::size_t n = 1 << 16;
+    id_allocator128 ids;
+    for (uint64_t size : {1u, 64u, 1024u}) {
+        report("reserve()", std::to_string(size), time_per_op(n, 5, [&] {
+                   uint64_t acc = 0;
+                   for (std::size_t i = 0; i < n; ++i)
+                       acc += ids.reserve(size).count;
+                   g_sink = g_sink + acc;
+               }));
+    }
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t ID Allocator Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    std::cout << "\n--- Identificadores por segundo (1-64 hilos) ---\n";
+    bench_scaling();
+
+    std::cout << "\n--- Reserva de bloques ---\n";
+    bench_reserve();
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
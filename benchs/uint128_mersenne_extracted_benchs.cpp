@@ -0,0 +1,233 @@
+/*
+ * Benchmarks para uint128_mersenne.hpp
+ * Reducción módulo 2^61 - 1 y 2^127 - 1 por plegado frente a `%`, productos
+ * modulares, lucas_lehmer frente al bucle con `%` del ejemplo de Mersenne y
+ * rendimiento de polynomial_hash / rolling_hash, en millones de
+ * operaciones por segundo
+ */
+
+#include "../include/uint128/uint128_mersenne.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+volatile unsigned g_exponent = 61; // Evita que lucas_lehmer(p) se evalúe al compilar
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+// ns por operación y millones de operaciones por segundo
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(20) << kernel << std::setw(14) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/op" << std::setw(10) << std::setprecision(1) << (1000.0 / ns) << " Mop/s\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+constexpr std::size_t count = 1 << 16;
+
+std::vector<uint128_t> random_words(uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<uint128_t> v(count);
+    for (auto& x : v)
+        x = uint128_t(rng(), rng());
+    return v;
+}
+
+// Reducción de valores de 128 bits arbitrarios
+template <unsigned P> void bench_reduce(const std::vector<uint128_t>& input)
+{
+    const std::string name = "reduce u128 M" + std::to_string(P);
+    const uint128_t m = mersenne_mod<P>::modulus();
+    report(name, "%", time_per_op(count, 5, [&] {
+               uint64_t acc = 0;
+               for (const auto& x : input)
+                   acc += (x % m).low();
+               g_sink = g_sink + acc;
+           }));
+    report(name, "mersenne_mod", time_per_op(count, 5, [&] {
+               uint64_t acc = 0;
+               for (const auto& x : input)
+                   acc += mersenne_mod<P>(x).value().low();
+               g_sink = g_sink + acc;
+           }));
+}
+
+// Productos independientes a * b mod M
+void bench_mul(const std::vector<uint128_t>& a, const std::vector<uint128_t>& b)
+{
+    const uint128_t m61 = mersenne61::modulus();
+    std::vector<uint128_t> a61(count), b61(count);
+    std::vector<mersenne61> fa61(count), fb61(count);
+    std::vector<mersenne127> fa127(count), fb127(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        a61[i] = a[i] % m61;
+        b61[i] = b[i] % m61;
+        fa61[i] = mersenne61(a[i]);
+        fb61[i] = mersenne61(b[i]);
+        fa127[i] = mersenne127(a[i]);
+        fb127[i] = mersenne127(b[i]);
+    }
+
+    report("mulmod M61", "%", time_per_op(count, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < count; ++i)
+                   acc += ((a61[i] * b61[i]) % m61).low();
+               g_sink = g_sink + acc;
+           }));
+    report("mulmod M61", "mersenne_mod", time_per_op(count, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < count; ++i)
+                   acc += (fa61[i] * fb61[i]).value().low();
+               g_sink = g_sink + acc;
+           }));
+    report("mulmod M127", "mersenne_mod", time_per_op(count, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < count; ++i)
+                   acc += (fa127[i] * fb127[i]).value().low();
+               g_sink = g_sink + acc;
+           }));
+    report("square M127", "mersenne_mod", time_per_op(count, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < count; ++i)
+                   acc += fa127[i].square().value().low();
+               g_sink = g_sink + acc;
+           }));
+}
+
+// Lucas-Lehmer: ns por iteración. El bucle con `%` del ejemplo sólo es
+// correcto mientras s * s cabe en 128 bits (p <= 64)
+void bench_lucas_lehmer()
+{
+    const unsigned p = g_exponent;
+    const uint128_t mp = mersenne61::modulus();
+    report("lucas_lehmer p=61", "%", time_per_op(p - 2, 5, [&] {
+               uint128_t s(4);
+               for (unsigned i = 0; i < p - 2; ++i)
+                   s = (s * s - uint128_t(2)) % mp;
+               g_sink = g_sink + s.low();
+           }));
+    report("lucas_lehmer p=61", "mersenne_mod", time_per_op(p - 2, 5, [&] {
+               g_sink = g_sink + static_cast<uint64_t>(lucas_lehmer(p));
+           }));
+    g_exponent = 127;
+    report("lucas_lehmer p=127", "mersenne_mod", time_per_op(125, 5, [&] {
+               g_sink = g_sink + static_cast<uint64_t>(lucas_lehmer(g_exponent));
+           }));
+}
+
+// Hash de 1 MiB: ns por byte
+template <unsigned P> void bench_hash(const std::vector<uint8_t>& data)
+{
+    const std::string name = "hash M" + std::to_string(P);
+    const mersenne_mod<P> base(uint128_t(0x9E3779B97F4A7C15ULL, 0xBF58476D1CE4E5B9ULL));
+    report(name, "polynomial", time_per_op(data.size(), 5, [&] {
+               g_sink = g_sink + polynomial_hash(std::span<const uint8_t>(data), base).value().low();
+           }));
+    report(name, "rolling w=64", time_per_op(data.size() - 64, 5, [&] {
+               rolling_hash<P> roller(base, 64);
+               for (std::size_t i = 0; i < 64; ++i)
+                   roller.push(data[i]);
+               uint64_t acc = 0;
+               for (std::size_t i = 64; i < data.size(); ++i) {
+                   roller.roll(data[i - 64], data[i]);
+                   acc += roller.value().value().low();
+               }
+               g_sink = g_sink + acc;
+           }));
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Mersenne Modulus Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+
+    const std::vector<uint128_t> a = random_words(1);
+    const std::vector<uint128_t> b = random_words(2);
+
+    std::cout << "\n--- Reducción de 128 bits ---\n";
+    bench_reduce<61>(a);
+    bench_reduce<127>(a);
+
+    std::cout << "\n--- Producto modular ---\n";
+    bench_mul(a, b);
+
+    std::cout << "\n--- Lucas-Lehmer (ns por iteración) ---\n";
+    bench_lucas_lehmer();
+
+    std::cout << "\n--- Hash polinómico (ns por byte) ---\n";
+    std::vector<uint8_t> data(1 << 20);
+    std::mt19937_64 rng(3);
+    for (auto& c : data)
+        c = static_cast<uint8_t>(rng());
+    bench_hash<61>(data);
+    bench_hash<127>(data);
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
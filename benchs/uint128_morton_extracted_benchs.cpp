@@ -0,0 +1,238 @@
+/*
+ * Benchmarks para uint128_morton.hpp
+ * Morton 2D/3D/4D por PDEP/PEXT frente a máscaras mágicas y un bucle bit a
+ * bit, Hilbert 2D por tablas frente al xy2d clásico, y versiones por lotes
+ * sobre 2^16 puntos
+ */
+
+#include "../include/uint128/uint128_morton.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(18) << kernel << std::setw(16) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/op\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+
+// =============================================================================
+// REFERENCIAS
+// =============================================================================
+
+uint128_t morton2_bit_loop(uint64_t x, uint64_t y)
+{
+    uint128_t key(0);
+    for (int i = 0; i < 64; ++i) {
+        key |= uint128_t((x >> i) & 1) << (2 * i);
+        key |= uint128_t((y >> i) & 1) << (2 * i + 1);
+    }
+    return key;
+}
+
+uint128_t hilbert_xy2d(uint64_t x, uint64_t y)
+{
+    uint128_t d(0);
+    for (int b = 63; b >= 0; --b) {
+        const uint64_t rx = (x >> b) & 1;
+        const uint64_t ry = (y >> b) & 1;
+        d |= uint128_t((3 * rx) ^ ry) << (2 * b);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = ~x;
+                y = ~y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+constexpr std::size_t N = 1 << 16;
+
+std::vector<uint64_t> g_x, g_y, g_z;
+std::vector<uint128_t> g_keys;
+
+void make_inputs()
+{
+    std::mt19937_64 gen(44);
+    g_x.resize(N);
+    g_y.resize(N);
+    g_z.resize(N);
+    g_keys.resize(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        g_x[i] = gen();
+        g_y[i] = gen();
+        g_z[i] = gen();
+        g_keys[i] = uint128_t(gen(), gen());
+    }
+}
+
+template <typename F> void bench_encode(const std::string& kernel, const std::string& variant, F f)
+{
+    report(kernel, variant, time_per_op(N, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < N; ++i)
+                   acc += f(i).low();
+               g_sink = g_sink + acc;
+           }));
+}
+
+template <typename F> void bench_decode(const std::string& kernel, const std::string& variant, F f)
+{
+    report(kernel, variant, time_per_op(N, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < N; ++i)
+                   acc += f(g_keys[i])[0];
+               g_sink = g_sink + acc;
+           }));
+}
+
+void bench_morton()
+{
+    bench_encode("morton2_encode", "dispatch", [](std::size_t i) { return morton2_encode(g_x[i], g_y[i]); });
+    bench_encode("morton2_encode", "magic bits",
+                 [](std::size_t i) { return detail::morton2_soft(g_x[i], g_y[i]); });
+    bench_encode("morton2_encode", "bit loop", [](std::size_t i) { return morton2_bit_loop(g_x[i], g_y[i]); });
+    bench_decode("morton2_decode", "dispatch", [](const uint128_t& k) { return morton2_decode(k); });
+    bench_decode("morton2_decode", "magic bits",
+                 [](const uint128_t& k) { return detail::morton2_decode_soft(k); });
+
+    bench_encode("morton3_encode", "dispatch",
+                 [](std::size_t i) { return morton3_encode(g_x[i], g_y[i], g_z[i]); });
+    bench_encode("morton3_encode", "magic bits",
+                 [](std::size_t i) { return detail::morton3_soft(g_x[i], g_y[i], g_z[i]); });
+    bench_decode("morton3_decode", "dispatch", [](const uint128_t& k) { return morton3_decode(k); });
+    bench_decode("morton3_decode", "magic bits",
+                 [](const uint128_t& k) { return detail::morton3_decode_soft(k); });
+
+    bench_encode("morton4_encode", "dispatch", [](std::size_t i) {
+        return morton4_encode(uint32_t(g_x[i]), uint32_t(g_y[i]), uint32_t(g_z[i]), uint32_t(g_x[i] >> 32));
+    });
+    bench_encode("morton4_encode", "magic bits", [](std::size_t i) {
+        return detail::morton4_soft(uint32_t(g_x[i]), uint32_t(g_y[i]), uint32_t(g_z[i]),
+                                    uint32_t(g_x[i] >> 32));
+    });
+    bench_decode("morton4_decode", "dispatch", [](const uint128_t& k) { return morton4_decode(k); });
+    bench_decode("morton4_decode", "magic bits",
+                 [](const uint128_t& k) { return detail::morton4_decode_soft(k); });
+}
+
+void bench_hilbert()
+{
+    bench_encode("hilbert2_encode", "tables", [](std::size_t i) { return hilbert2_encode(g_x[i], g_y[i]); });
+    bench_encode("hilbert2_encode", "xy2d loop", [](std::size_t i) { return hilbert_xy2d(g_x[i], g_y[i]); });
+    bench_decode("hilbert2_decode", "tables", [](const uint128_t& k) { return hilbert2_decode(k); });
+}
+
+void bench_batch()
+{
+    std::vector<uint128_t> out(N);
+    std::vector<uint64_t> x(N), y(N), z(N);
+    const std::span<const uint64_t> cx(g_x), cy(g_y), cz(g_z);
+    const std::span<const uint128_t> keys(g_keys);
+
+    report("morton2 batch", "encode", time_per_op(N, 5, [&] { morton2_encode(cx, cy, std::span(out)); }));
+    report("morton2 batch", "decode", time_per_op(N, 5, [&] { morton2_decode(keys, std::span(x), std::span(y)); }));
+    report("morton3 batch", "encode",
+           time_per_op(N, 5, [&] { morton3_encode(cx, cy, cz, std::span(out)); }));
+    report("morton3 batch", "decode", time_per_op(N, 5, [&] {
+               morton3_decode(keys, std::span(x), std::span(y), std::span(z));
+           }));
+    report("hilbert2 batch", "encode", time_per_op(N, 5, [&] { hilbert2_encode(cx, cy, std::span(out)); }));
+    report("hilbert2 batch", "decode", time_per_op(N, 5, [&] { hilbert2_decode(keys, std::span(x), std::span(y)); }));
+    g_sink = g_sink + out[N / 2].low() + x[N / 3];
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Morton / Hilbert Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "fast_pdep: " << detail::morton_use_pdep() << "\n";
+
+    make_inputs();
+
+    std::cout << "\n--- Morton ---\n";
+    bench_morton();
+
+    std::cout << "\n--- Hilbert ---\n";
+    bench_hilbert();
+
+    std::cout << "\n--- Lotes (2^16 puntos) ---\n";
+    bench_batch();
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
@@ -0,0 +1,244 @@
+/*
+ * Benchmarks para uint128_mpmc_ring.hpp
+ * Mensajes por segundo con distintos números de productores y consumidores:
+ * mpmc_ring128 (suelto y por lotes), spsc_ring128 (suelto y por lotes) y
+ * std::mutex + std::deque como referencia
+ */
+
+#include "../include/uint128/uint128_mpmc_ring.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(18) << kernel << std::setw(8) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/msg" << std::setw(10) << 1e3 / ns << " M msg/s\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+constexpr uint64_t total_messages = 1 << 20;
+constexpr std::size_t batch_size = 16;
+
+// Cola de referencia: mutex + deque acotada a la misma capacidad
+class locked_queue
+{
+  public:
+    explicit locked_queue(std::size_t capacity) : capacity_(capacity) {}
+
+    bool try_push(uint128_t v)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (q_.size() == capacity_)
+            return false;
+        q_.push_back(v);
+        return true;
+    }
+
+    bool try_pop(uint128_t& v)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (q_.empty())
+            return false;
+        v = q_.front();
+        q_.pop_front();
+        return true;
+    }
+
+  private:
+    std::size_t capacity_;
+    std::mutex mutex_;
+    std::deque<uint128_t> q_;
+};
+
+// `producers` hilos reparten total_messages; `consumers` hilos los reciben todos
+template <typename Queue, typename Push, typename Pop>
+void bench_queue(const std::string& kernel, unsigned producers, unsigned consumers, Push push,
+                 Pop pop)
+{
+    const double ns = time_per_op(total_messages, 3, [&] {
+        Queue q(1024);
+        std::atomic<uint64_t> received{0};
+        std::vector<std::thread> pool;
+        for (unsigned p = 0; p < producers; ++p) {
+            pool.emplace_back([&, p] {
+                const uint64_t begin = total_messages * p / producers;
+                const uint64_t end = total_messages * (p + 1) / producers;
+                push(q, begin, end);
+            });
+        }
+        for (unsigned c = 0; c < consumers; ++c) {
+            pool.emplace_back([&] {
+                uint64_t acc = 0;
+                while (received.load(std::memory_order_relaxed) < total_messages) {
+                    const uint64_t n = pop(q, acc);
+                    if (n != 0)
+                        received.fetch_add(n, std::memory_order_relaxed);
+                    else
+                        std::this_thread::yield();
+                }
+                g_sink = g_sink + acc;
+            });
+        }
+        for (auto& th : pool)
+            th.join();
+    });
+    std::string variant = std::to_string(producers);
+    variant += "P/";
+    variant += std::to_string(consumers);
+    variant += "C";
+    report(kernel, variant, ns);
+}
+
+// Envío y recepción de uno en uno
+template <typename Queue> void push_single(Queue& q, uint64_t begin, uint64_t end)
+{
+    for (uint64_t i = begin; i < end; ++i)
+        while (!q.try_push(uint128_t(i, i)))
+            std::this_thread::yield();
+}
+
+template <typename Queue> uint64_t pop_single(Queue& q, uint64_t& acc)
+{
+    uint128_t v;
+    if (!q.try_pop(v))
+        return 0;
+    acc += v.low();
+    return 1;
+}
+
+// Envío y recepción por lotes de batch_size
+template <typename Queue> void push_batch(Queue& q, uint64_t begin, uint64_t end)
+{
+    std::array<uint128_t, batch_size> batch;
+    uint64_t i = begin;
+    while (i < end) {
+        const std::size_t n = static_cast<std::size_t>(std::min<uint64_t>(batch_size, end - i));
+        for (std::size_t k = 0; k < n; ++k)
+            batch[k] = uint128_t(i + k, i + k);
+        const std::size_t pushed = q.try_push(std::span<const uint128_t>(batch.data(), n));
+        if (pushed == 0)
+            std::this_thread::yield();
+        i += pushed;
+    }
+}
+
+template <typename Queue> uint64_t pop_batch(Queue& q, uint64_t& acc)
+{
+    std::array<uint128_t, batch_size> batch;
+    const std::size_t n = q.try_pop(std::span<uint128_t>(batch));
+    for (std::size_t k = 0; k < n; ++k)
+        acc += batch[k].low();
+    return n;
+}
+
+void bench_mpmc()
+{
+    const std::pair<unsigned, unsigned> shapes[] = {{1, 1}, {1, 4}, {4, 1}, {2, 2}, {4, 4}, {8, 8}};
+    for (const auto& [p, c] : shapes) {
+        bench_queue<locked_queue>("mutex+deque", p, c, push_single<locked_queue>,
+                                  pop_single<locked_queue>);
+        bench_queue<mpmc_ring_uint128>("mpmc_ring128", p, c, push_single<mpmc_ring_uint128>,
+                                       pop_single<mpmc_ring_uint128>);
+        bench_queue<mpmc_ring_uint128>("mpmc_ring128 x16", p, c, push_batch<mpmc_ring_uint128>,
+                                       pop_batch<mpmc_ring_uint128>);
+    }
+}
+
+void bench_spsc()
+{
+    bench_queue<spsc_ring_uint128>("spsc_ring128", 1, 1, push_single<spsc_ring_uint128>,
+                                   pop_single<spsc_ring_uint128>);
+    bench_queue<spsc_ring_uint128>("spsc_ring128 x16", 1, 1, push_batch<spsc_ring_uint128>,
+                                   pop_batch<spsc_ring_uint128>);
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t MPMC Ring Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    std::cout << "\n--- MPMC (capacidad 1024) ---\n";
+    bench_mpmc();
+
+    std::cout << "\n--- SPSC (capacidad 1024) ---\n";
+    bench_spsc();
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+/*
+ * Benchmarks para uint128_parallel.hpp
+ * Sobrecargas paralelas de uint128_algorithm / int128_algorithm frente a las
+ * secuenciales con 1M, 10M y 100M elementos (argv[1] limita el tamaño máximo)
+ */
+
+#include "../include/int128/int128_algorithm.hpp"
+#include "../include/uint128/uint128_algorithm.hpp"
+#include "../include/uint128/uint128_parallel.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_elem;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por elemento
+double time_per_elem(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(14) << kernel << std::setw(12) << variant
+              << std::right << std::fixed << std::setprecision(3) << std::setw(10) << ns
+              << " ns/elem" << std::setw(10) << std::setprecision(2) << (1.0 / ns) << " elem/ns\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// Secuencial y después paralelo con 1, 2, 4 y hardware_concurrency hilos
+template <typename Seq, typename Par>
+void compare(const std::string& kernel, std::size_t n, int reps, Seq seq, Par par)
+{
+    report(kernel, "seq", time_per_elem(n, reps, seq));
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts = {1u, 2u, 4u};
+    if (hw > 4) {
+        counts.push_back(hw);
+    }
+    for (unsigned t : counts) {
+        if (t > hw) {
+            break;
+        }
+        report(kernel, "par x" + std::to_string(t),
+               time_per_elem(n, reps, [&] { par(execution::par(t)); }));
+    }
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+void run_benchmarks(std::size_t n)
+{
+    using namespace uint128_algorithm;
+
+    std::vector<uint128_t> u;
+    try {
+        u.resize(n);
+    } catch (const std::bad_alloc&) {
+        std::cout << "\n--- " << n << " elementos: sin memoria, omitido ---\n";
+        return;
+    }
+    std::mt19937_64 rng(42);
+    for (auto& v : u) {
+        v = uint128_t(rng(), rng() | 1); // Impares: el producto no se anula
+    }
+    const int reps = n > 10'000'000 ? 2 : 4;
+    const auto b = u.begin();
+    const auto e = u.end();
+
+    std::cout << "\n--- " << n << " elementos ---\n";
+
+    compare(
+        "sum u128", n, reps, [&] { g_sink = g_sink + sum_uint128(b, e).low(); },
+        [&](auto p) { g_sink = g_sink + sum_uint128(p, b, e).low(); });
+    compare(
+        "product u128", n, reps, [&] { g_sink = g_sink + product_uint128(b, e).low(); },
+        [&](auto p) { g_sink = g_sink + product_uint128(p, b, e).low(); });
+    compare(
+        "count_if u128", n, reps,
+        [&] {
+            g_sink = g_sink + count_if_uint128(b, e, [](const uint128_t& x) { return x.high() & 1; });
+        },
+        [&](auto p) {
+            g_sink = g_sink +
+                     count_if_uint128(p, b, e, [](const uint128_t& x) { return x.high() & 1; });
+        });
+    compare(
+        "stats u128", n, reps, [&] { g_sink = g_sink + calculate_stats(b, e).count; },
+        [&](auto p) { g_sink = g_sink + calculate_stats(p, b, e).count; });
+
+    // GCD sin parada temprana: todos los valores son múltiplos de 6. El GCD
+    // binario de 128 bits cuesta ~1 us por elemento, así que se limita a 1M
+    const std::size_t gn = std::min<std::size_t>(n, 1'000'000);
+    const auto ge = b + static_cast<std::ptrdiff_t>(gn);
+    for (auto& v : u) {
+        v = (v >> 3) * uint128_t(6);
+    }
+    compare(
+        "gcd (x6)", gn, reps, [&] { g_sink = g_sink + gcd_range(b, ge).low(); },
+        [&](auto p) { g_sink = g_sink + gcd_range(p, b, ge).low(); });
+
+    // Con parada temprana: un 1 en el último cuarto; el hilo que lo ve detiene al resto
+    u[gn - gn / 4] = uint128_t(1);
+    compare(
+        "gcd (early)", gn, reps, [&] { g_sink = g_sink + gcd_range(b, ge).low(); },
+        [&](auto p) { g_sink = g_sink + gcd_range(p, b, ge).low(); });
+
+    // LCM de divisores pequeños (no desborda)
+    for (std::size_t i = 0; i < n; ++i) {
+        u[i] = uint128_t(1 + i % 16);
+    }
+    compare(
+        "lcm u128", n, reps, [&] { g_sink = g_sink + lcm_range(b, e).low(); },
+        [&](auto p) { g_sink = g_sink + lcm_range(p, b, e).low(); });
+
+    u.clear();
+    u.shrink_to_fit();
+
+    std::vector<int128_t> s(n);
+    for (auto& v : s) {
+        v = int128_t(rng(), rng());
+    }
+    compare(
+        "sum i128", n, reps,
+        [&] { g_sink = g_sink + int128_algorithm::sum_int128(s.begin(), s.end()).low(); },
+        [&](auto p) {
+            g_sink = g_sink + int128_algorithm::sum_int128(p, s.begin(), s.end()).low();
+        });
+    compare(
+        "stats i128", n, reps,
+        [&] { g_sink = g_sink + int128_algorithm::calculate_stats(s.begin(), s.end()).count; },
+        [&](auto p) {
+            g_sink = g_sink + int128_algorithm::calculate_stats(p, s.begin(), s.end()).count;
+        });
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main(int argc, char** argv)
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Parallel Reduction Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "Threads: " << std::thread::hardware_concurrency()
+              << " (pool: " << fork_join_pool::instance().size() << ")\n";
+
+    // 100M elementos ocupan 1.6 GB por vector
+    const std::size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100'000'000;
+    for (std::size_t n : {std::size_t{1'000'000}, std::size_t{10'000'000}, std::size_t{100'000'000}}) {
+        if (n <= max_n) {
+            run_benchmarks(n);
+        }
+    }
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * Benchmarks para uint128_random.hpp
+ * pcg64, lehmer128 y xoshiro256++ frente a std::mt19937_64: llamadas sueltas
+ * a operator(), fill() en bloques en L1 y coste de advance(), en GB/s de
+ * salida generada; enteros acotados con el método de Lemire frente al
+ * rechazo clásico con dos módulos de 128 bits
+ */
+
+#include "../include/uint128/uint128_random.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+
+// ns por número de 64 bits y GB/s de salida
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(14) << kernel << std::setw(14) << variant
+              << std::right << std::fixed << std::setprecision(3) << std::setw(10) << ns
+              << " ns/u64" << std::setw(10) << std::setprecision(2) << (8.0 / ns) << " GB/s\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+constexpr std::size_t calls = 1 << 22;
+
+template <typename Engine> void bench_engine(const std::string& name, Engine rng)
+{
+    report(name, "operator()", time_per_op(calls, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < calls; ++i)
+                   acc += rng();
+               g_sink = g_sink + acc;
+           }));
+
+    // Bloques de 16 KiB: en L1, mide el generador y no la memoria
+    std::vector<uint64_t> block(2048);
+    report(name, "fill", time_per_op(calls, 5, [&] {
+               for (std::size_t i = 0; i < calls; i += block.size()) {
+                   if constexpr (requires { rng.fill(std::span<uint64_t>(block)); }) {
+                       rng.fill(block);
+                   } else {
+                       for (auto& x : block)
+                           x = rng();
+                   }
+                   g_sink = g_sink + block[i % block.size()];
+               }
+           }));
+}
+
+// Coste de un salto arbitrario: ns por llamada a advance
+template <typename Engine> void bench_advance(const std::string& name, Engine rng)
+{
+    constexpr std::size_t jumps = 256;
+    const uint128_t n(0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL);
+    const double ns = time_per_op(jumps, 3, [&] {
+        for (std::size_t i = 0; i < jumps; ++i)
+            rng.advance(n);
+        g_sink = g_sink + rng();
+    });
+    std::cout << "  " << std::left << std::setw(14) << name << std::setw(14) << "advance"
+              << std::right << std::fixed << std::setprecision(1) << std::setw(10) << ns << " ns/salto\n";
+    g_results.push_back({name, "advance", ns});
+}
+
+// Rechazo clásico (como el de libstdc++): umbral y reducción con módulos de 128 bits
+template <typename Engine> uint128_t modulo_bounded(Engine& rng, const uint128_t& n)
+{
+    const uint128_t threshold = (uint128_t(0) - n) % n;
+    for (;;) {
+        const uint64_t hi = rng();
+        const uint128_t x(hi, rng());
+        if (x >= threshold)
+            return x % n;
+    }
+}
+
+// ns por entero acotado en [0, n)
+void bench_bounded(const std::string& label, const uint128_t& n)
+{
+    constexpr std::size_t values = 1 << 20;
+    pcg64 rng(42);
+    auto print = [&](const std::string& variant, double ns) {
+        std::cout << "  " << std::left << std::setw(14) << label << std::setw(14) << variant
+                  << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+                  << " ns/valor\n";
+        g_results.push_back({label, variant, ns});
+    };
+
+    print("modulo", time_per_op(values, 5, [&] {
+              uint64_t acc = 0;
+              for (std::size_t i = 0; i < values; ++i)
+                  acc += modulo_bounded(rng, n).low();
+              g_sink = g_sink + acc;
+          }));
+    uniform_uint128_distribution dist(uint128_t(0), n - uint128_t(1));
+    print("lemire", time_per_op(values, 5, [&] {
+              uint64_t acc = 0;
+              for (std::size_t i = 0; i < values; ++i)
+                  acc += dist(rng).low();
+              g_sink = g_sink + acc;
+          }));
+    std::vector<uint128_t> block(1024);
+    print("generate", time_per_op(values, 5, [&] {
+              for (std::size_t i = 0; i < values; i += block.size()) {
+                  generate(block, n, rng);
+                  g_sink = g_sink + block[i % block.size()].low();
+              }
+          }));
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Random Engine Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+
+    std::cout << "\n--- Generación de 64 bits ---\n";
+    bench_engine("mt19937_64", std::mt19937_64(42));
+    bench_engine("pcg64", pcg64(42));
+    bench_engine("lehmer128", lehmer128(42));
+    bench_engine("xoshiro256++", xoshiro256pp(42));
+
+    std::cout << "\n--- Salto advance(n) con n ~ 2^120 ---\n";
+    bench_advance("pcg64", pcg64(42));
+    bench_advance("lehmer128", lehmer128(42));
+    bench_advance("xoshiro256++", xoshiro256pp(42));
+
+    std::cout << "\n--- Enteros uniformes en [0, n) ---\n";
+    bench_bounded("n = 10", uint128_t(10));
+    bench_bounded("n = 2^64+13", uint128_t(1, 13));
+    bench_bounded("n = 2^127+1", (uint128_t(1) << 127) + uint128_t(1));
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * Benchmarks para uint128_seqlock.hpp
+ * Rendimiento de lectura con 1 escritor + N lectores: seqlock128 frente a
+ * ThreadSafeUint128RW (std::shared_mutex) y ThreadSafeUint128Atomic
+ */
+
+#include "../include/uint128/uint128_seqlock.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+using namespace nstd::uint128_threadsafe;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double mreads_per_s;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+void report(const std::string& kernel, const std::string& variant, double mreads, double writes)
+{
+    std::cout << "  " << std::left << std::setw(16) << kernel << std::setw(14) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << mreads
+              << " Mreads/s" << std::setw(10) << writes << " Mwrites/s\n";
+    g_results.push_back({kernel, variant, mreads});
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+/**
+ * 1 escritor que actualiza el valor con una pausa corta entre escrituras
+ * (tipo de cambio, configuración) y N lectores durante un tiempo fijo.
+ */
+template <typename Read, typename Write>
+void bench_readers(const std::string& kernel, unsigned readers, Read&& read, Write&& write)
+{
+    using clock = std::chrono::steady_clock;
+    const auto duration = std::chrono::milliseconds(200);
+
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> total_reads{0};
+    uint64_t writes = 0;
+    const auto t0 = clock::now();
+    std::vector<std::thread> pool;
+    for (unsigned r = 0; r < readers; ++r) {
+        pool.emplace_back([&] {
+            uint64_t local = 0;
+            uint64_t acc = 0;
+            // Los lectores también miran el reloj: con un cerrojo que favorece a
+            // los lectores el escritor podría no volver a entrar
+            while (!done.load(std::memory_order_relaxed)) {
+                acc += read().low();
+                if ((++local & 1023) == 0 && clock::now() - t0 >= duration)
+                    break;
+            }
+            g_sink = g_sink + acc;
+            total_reads.fetch_add(local);
+        });
+    }
+    while (clock::now() - t0 < duration) {
+        write(uint128_t(writes, ~writes));
+        ++writes;
+        for (int i = 0; i < 64; ++i) {
+            intrinsics::cpu_relax();
+        }
+    }
+    done.store(true);
+    for (auto& th : pool)
+        th.join();
+    const double us = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - t0).count());
+
+    std::string variant = "1w + ";
+    variant += std::to_string(readers);
+    variant += "r";
+    report(kernel, variant, static_cast<double>(total_reads.load()) / us,
+           static_cast<double>(writes) / us);
+}
+
+void bench_read_mostly()
+{
+    for (unsigned n : {1u, 2u, 4u, 8u, 16u}) {
+        seqlock_uint128 seq;
+        ThreadSafeUint128RW rw(uint128_t(0));
+        ThreadSafeUint128Atomic atomic_cell(uint128_t(0));
+
+        bench_readers("seqlock128", n, [&] { return seq.load(); },
+                      [&](uint128_t v) { seq.store(v); });
+        bench_readers("RW (shared_mtx)", n, [&] { return rw.get(); },
+                      [&](uint128_t v) { rw.set(v); });
+        bench_readers("Atomic", n, [&] { return atomic_cell.load(std::memory_order_acquire); },
+                      [&](uint128_t v) { atomic_cell.store(v, std::memory_order_release); });
+    }
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Seqlock Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    std::cout << "\n--- 1 escritor + N lectores ---\n";
+    bench_read_mostly();
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
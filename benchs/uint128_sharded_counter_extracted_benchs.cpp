@@ -0,0 +1,172 @@
+/*
+ * Benchmarks para uint128_sharded_counter.hpp
+ * Incrementos desde 1 a 128 hilos: sharded_counter128 (por hilo, por CPU y
+ * con traslados) frente a los cuatro envoltorios ThreadSafeUint128*, y coste
+ * de read() según el número de fragmentos
+ */
+
+#include "../include/uint128/uint128_sharded_counter.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+using namespace nstd::uint128_threadsafe;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(20) << kernel << std::setw(10) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/op\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+// Escalado fuerte: 2^20 incrementos repartidos entre `threads` hilos
+template <typename Increment>
+void bench_scaling(const std::string& kernel, unsigned threads, Increment&& increment)
+{
+    constexpr std::size_t total = 1 << 20;
+    const std::size_t per_thread = total / threads;
+    const double ns = time_per_op(per_thread * threads, 3, [&] {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&] {
+                for (std::size_t i = 0; i < per_thread; ++i)
+                    increment();
+            });
+        }
+        for (auto& th : pool)
+            th.join();
+    });
+    std::string variant = "x";
+    variant += std::to_string(threads);
+    report(kernel, variant, ns);
+}
+
+void bench_add_scaling()
+{
+    const uint128_t one(1);
+    for (unsigned t : {1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u}) {
+        ThreadSafeUint128 mutex_counter(uint128_t(0));
+        ThreadSafeUint128RW rw_counter(uint128_t(0));
+        ThreadSafeUint128Atomic atomic_counter(uint128_t(0));
+        ThreadSafeUint128SpinLock spin_counter(uint128_t(0));
+        sharded_uint128_counter by_thread(shard_selection::thread);
+        sharded_uint128_counter by_cpu(shard_selection::cpu);
+        sharded_uint128_counter folded(shard_selection::thread, 0, 1024);
+
+        bench_scaling("Mutex add", t, [&] { mutex_counter.add(one); });
+        bench_scaling("RW add", t, [&] { rw_counter.add(one); });
+        bench_scaling("Atomic fetch_add", t,
+                      [&] { atomic_counter.fetch_add(one, std::memory_order_relaxed); });
+        bench_scaling("SpinLock add", t, [&] { spin_counter.add(one); });
+        bench_scaling("sharded thread", t, [&] { by_thread.add(one); });
+        bench_scaling("sharded cpu", t, [&] { by_cpu.add(one); });
+        bench_scaling("sharded fold/1024", t, [&] { folded.add(one); });
+        g_sink = g_sink + by_thread.read().low() + by_cpu.read().low() + folded.read().low();
+    }
+}
+
+void bench_read()
+{
+    constexpr std::size_t n = 1 << 16;
+    for (std::size_t shards : {1u, 8u, 64u, 256u}) {
+        sharded_uint128_counter c(shard_selection::thread, shards);
+        c.add(uint128_t(1));
+        report("read()", std::to_string(shards) + " sh", time_per_op(n, 5, [&] {
+                   uint64_t acc = 0;
+                   for (std::size_t i = 0; i < n; ++i)
+                       acc += c.read().low();
+                   g_sink = g_sink + acc;
+               }));
+    }
+    ThreadSafeUint128 mutex_counter(uint128_t(1));
+    report("Mutex get()", "-", time_per_op(n, 5, [&] {
+               uint64_t acc = 0;
+               for (std::size_t i = 0; i < n; ++i)
+                   acc += mutex_counter.get().low();
+               g_sink = g_sink + acc;
+           }));
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t Sharded Counter Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    std::cout << "\n--- Incrementos (1-128 hilos) ---\n";
+    bench_add_scaling();
+
+    std::cout << "\n--- Lectura ---\n";
+    bench_read();
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
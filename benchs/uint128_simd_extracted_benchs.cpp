@@ -0,0 +1,253 @@
+/*
+ * Benchmarks para uint128_simd.hpp
+ * Kernels sobre std::span<uint128_t> (escalar / AVX2 / AVX-512) frente al
+ * bucle escalar equivalente, en elementos por ns; las estadísticas de bits
+ * (popcount, countl_zero, histograma de bit_width) se dan además en GB/s
+ */
+
+#include "../include/uint128/uint128_simd.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_elem;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por elemento
+double time_per_elem(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(14) << kernel << std::setw(12) << variant
+              << std::right << std::fixed << std::setprecision(3) << std::setw(10) << ns
+              << " ns/elem" << std::setw(10) << std::setprecision(2) << (1.0 / ns) << " elem/ns\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// Igual que report() pero en GB/s de entrada (16 bytes por elemento)
+void report_bandwidth(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(14) << kernel << std::setw(12) << variant
+              << std::right << std::fixed << std::setprecision(3) << std::setw(10) << ns
+              << " ns/elem" << std::setw(10) << std::setprecision(2) << (16.0 / ns) << " GB/s\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+const char* level_name(intrinsics::simd_level level)
+{
+    switch (level) {
+    case intrinsics::simd_level::avx512:
+        return "avx512";
+    case intrinsics::simd_level::avx2:
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+void run_benchmarks(std::size_t n)
+{
+    std::mt19937_64 rng(42);
+    std::vector<uint128_t> a(n), b(n), out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = uint128_t(rng(), rng());
+        b[i] = uint128_t(rng(), rng());
+    }
+    const uint64_t k = 0x9E3779B97F4A7C15ULL;
+    const int reps = 10;
+
+    std::cout << "\n--- " << n << " elementos ---\n";
+
+    // Referencia: bucle escalar sobre uint128_t
+    report("add", "loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   out[i] = a[i] + b[i];
+           }));
+    report("sub", "loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   out[i] = a[i] - b[i];
+           }));
+    report("mul_lo", "loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   out[i] = a[i] * b[i];
+           }));
+    report("mul u64", "loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   out[i] = a[i] * uint128_t(k);
+           }));
+    report("xor", "loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   out[i] = a[i] ^ b[i];
+           }));
+    report("shl 37", "loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   out[i] = a[i] << 37;
+           }));
+    report("compare lt", "loop", time_per_elem(n, reps, [&] {
+               std::vector<uint64_t> m((n + 63) / 64, 0);
+               for (std::size_t i = 0; i < n; ++i)
+                   m[i / 64] |= uint64_t(a[i] < b[i]) << (i % 64);
+               g_sink = g_sink + m[0];
+           }));
+
+    for (auto level : {intrinsics::simd_level::scalar, intrinsics::simd_level::avx2,
+                       intrinsics::simd_level::avx512}) {
+        if (static_cast<int>(level) > static_cast<int>(intrinsics::best_simd_level())) {
+            continue;
+        }
+        intrinsics::force_simd_level(level);
+        const std::string v = level_name(level);
+        report("add", v, time_per_elem(n, reps, [&] { simd::add(a, b, out); }));
+        report("sub", v, time_per_elem(n, reps, [&] { simd::sub(a, b, out); }));
+        report("mul_lo", v, time_per_elem(n, reps, [&] { simd::mul_lo(a, b, out); }));
+        report("mul u64", v, time_per_elem(n, reps, [&] { simd::mul(a, k, out); }));
+        report("xor", v, time_per_elem(n, reps, [&] { simd::bit_xor(a, b, out); }));
+        report("shl 37", v, time_per_elem(n, reps, [&] { simd::shift_left(a, 37, out); }));
+        report("compare lt", v, time_per_elem(n, reps, [&] {
+                   g_sink = g_sink + simd::compare(a, b, simd::cmp_op::lt)[0];
+               }));
+    }
+    intrinsics::reset_simd_level();
+    g_sink = g_sink + out[n / 3].low();
+}
+
+void run_bit_statistics(std::size_t n)
+{
+    std::mt19937_64 rng(7);
+    std::vector<uint128_t> a(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        // bit_width repartido por todo 0..128
+        a[i] = uint128_t(rng(), rng()) >> static_cast<int>(rng() % 129);
+    }
+    std::vector<uint8_t> counts(n);
+    const int reps = 10;
+
+    std::cout << "\n--- Estadísticas de bits, " << n << " elementos (" << (n * 16 >> 10) << " KiB) ---\n";
+
+    // Referencia: bucles escalares con ramas, como nstd::popcount antes
+    report_bandwidth("popcount_sum", "loop", time_per_elem(n, reps, [&] {
+                         uint64_t sum = 0;
+                         for (const auto& x : a) {
+                             if (x.high() != 0)
+                                 sum += std::popcount(x.high());
+                             if (x.low() != 0)
+                                 sum += std::popcount(x.low());
+                         }
+                         g_sink = g_sink + sum;
+                     }));
+    report_bandwidth("countl_zero", "loop", time_per_elem(n, reps, [&] {
+                         for (std::size_t i = 0; i < n; ++i)
+                             counts[i] = static_cast<uint8_t>(
+                                 a[i].high() != 0 ? std::countl_zero(a[i].high())
+                                                  : 64 + std::countl_zero(a[i].low()));
+                     }));
+    report_bandwidth("histogram", "loop", time_per_elem(n, reps, [&] {
+                         std::array<std::size_t, 129> hist{};
+                         for (const auto& x : a)
+                             ++hist[x.high() != 0 ? 128 - std::countl_zero(x.high())
+                                                  : 64 - std::countl_zero(x.low())];
+                         g_sink = g_sink + hist[64];
+                     }));
+
+    for (auto level : {intrinsics::simd_level::scalar, intrinsics::simd_level::avx2,
+                       intrinsics::simd_level::avx512}) {
+        if (static_cast<int>(level) > static_cast<int>(intrinsics::best_simd_level())) {
+            continue;
+        }
+        intrinsics::force_simd_level(level);
+        const std::string v = level_name(level);
+        report_bandwidth("popcount_sum", v, time_per_elem(n, reps, [&] {
+                             g_sink = g_sink + simd::popcount_sum(a);
+                         }));
+        report_bandwidth("popcount_each", v,
+                         time_per_elem(n, reps, [&] { simd::popcount_each(a, counts); }));
+        report_bandwidth("countl_zero", v,
+                         time_per_elem(n, reps, [&] { simd::countl_zero_each(a, counts); }));
+        report_bandwidth("histogram", v, time_per_elem(n, reps, [&] {
+                             g_sink = g_sink + simd::bit_width_histogram(a)[64];
+                         }));
+    }
+    intrinsics::reset_simd_level();
+    g_sink = g_sink + counts[n / 3];
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t SIMD (AoS) Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    const auto& cpu = intrinsics::cpu();
+    std::cout << "CPU: avx2=" << cpu.avx2 << " avx512f=" << cpu.avx512f
+              << " vpopcntdq=" << cpu.avx512_vpopcntdq << " avx512cd=" << cpu.avx512cd
+              << " lzcnt=" << cpu.lzcnt << "\n";
+
+    run_benchmarks(4096);    // En L1/L2
+    run_benchmarks(1 << 20); // Limitado por memoria
+
+    run_bit_statistics(2048);    // 32 KiB: en L1
+    run_bit_statistics(1 << 22); // 64 MiB: limitado por memoria
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
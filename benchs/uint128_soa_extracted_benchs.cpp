@@ -0,0 +1,186 @@
+/*
+ * Benchmarks para uint128_soa.hpp
+ * Kernels SoA (escalar / AVX2 / AVX-512) frente al bucle escalar sobre
+ * std::vector<uint128_t> (AoS)
+ */
+
+#include "../include/uint128/uint128_soa.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_elem;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por elemento
+double time_per_elem(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(14) << kernel << std::setw(12) << variant
+              << std::right << std::fixed << std::setprecision(3) << std::setw(10) << ns
+              << " ns/elem" << std::setw(10) << std::setprecision(2) << (1.0 / ns) << " elem/ns\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+const char* level_name(intrinsics::simd_level level)
+{
+    switch (level) {
+    case intrinsics::simd_level::avx512:
+        return "soa-avx512";
+    case intrinsics::simd_level::avx2:
+        return "soa-avx2";
+    default:
+        return "soa-scalar";
+    }
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+void run_benchmarks(std::size_t n)
+{
+    std::mt19937_64 rng(42);
+    std::vector<uint128_t> av(n), bv(n), outv(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        av[i] = uint128_t(rng(), rng());
+        bv[i] = uint128_t(rng(), rng());
+    }
+    const uint128_soa_vector a(av), b(bv);
+    uint128_soa_vector out(n);
+    std::vector<uint8_t> counts(n);
+    const int reps = 10;
+
+    std::cout << "\n--- " << n << " elementos ---\n";
+
+    // Referencia AoS: bucle escalar sobre uint128_t
+    report("add", "aos-loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   outv[i] = av[i] + bv[i];
+           }));
+    report("sub", "aos-loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   outv[i] = av[i] - bv[i];
+           }));
+    report("xor", "aos-loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   outv[i] = av[i] ^ bv[i];
+           }));
+    report("shl 37", "aos-loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   outv[i] = av[i] << 37;
+           }));
+    report("compare lt", "aos-loop", time_per_elem(n, reps, [&] {
+               std::vector<uint64_t> m((n + 63) / 64, 0);
+               for (std::size_t i = 0; i < n; ++i)
+                   m[i / 64] |= uint64_t(av[i] < bv[i]) << (i % 64);
+               g_sink = g_sink + m[0];
+           }));
+    report("min", "aos-loop", time_per_elem(n, reps, [&] {
+               for (std::size_t i = 0; i < n; ++i)
+                   outv[i] = av[i] < bv[i] ? av[i] : bv[i];
+           }));
+    report("popcount_sum", "aos-loop", time_per_elem(n, reps, [&] {
+               uint64_t total = 0;
+               for (std::size_t i = 0; i < n; ++i)
+                   total += static_cast<uint64_t>(intrinsics::popcount64(av[i].high()) +
+                                                  intrinsics::popcount64(av[i].low()));
+               g_sink = g_sink + total;
+           }));
+
+    for (auto level : {intrinsics::simd_level::scalar, intrinsics::simd_level::avx2,
+                       intrinsics::simd_level::avx512}) {
+        if (static_cast<int>(level) > static_cast<int>(intrinsics::best_simd_level())) {
+            continue;
+        }
+        intrinsics::force_simd_level(level);
+        const std::string v = level_name(level);
+        report("add", v, time_per_elem(n, reps, [&] { soa::add(a, b, out); }));
+        report("sub", v, time_per_elem(n, reps, [&] { soa::sub(a, b, out); }));
+        report("xor", v, time_per_elem(n, reps, [&] { soa::bit_xor(a, b, out); }));
+        report("shl 37", v, time_per_elem(n, reps, [&] { soa::shift_left(a, 37, out); }));
+        report("compare lt", v, time_per_elem(n, reps, [&] {
+                   g_sink = g_sink + soa::compare(a, b, soa::cmp_op::lt)[0];
+               }));
+        report("min", v, time_per_elem(n, reps, [&] { soa::min(a, b, out); }));
+        report("popcount", v, time_per_elem(n, reps, [&] { soa::popcount(a, counts); }));
+        report("popcount_sum", v,
+               time_per_elem(n, reps, [&] { g_sink = g_sink + soa::popcount_sum(a); }));
+        report("from AoS", v, time_per_elem(n, reps, [&] { out.assign(av); }));
+        report("to AoS", v, time_per_elem(n, reps, [&] { a.copy_to(outv); }));
+    }
+    intrinsics::reset_simd_level();
+    g_sink = g_sink + out.get(n / 2).low() + outv[n / 3].low();
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t SoA Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    const auto& cpu = intrinsics::cpu();
+    std::cout << "CPU: avx2=" << cpu.avx2 << " avx512f=" << cpu.avx512f
+              << " avx512_vpopcntdq=" << cpu.avx512_vpopcntdq << "\n";
+
+    run_benchmarks(4096);    // En L1/L2
+    run_benchmarks(1 << 20); // Limitado por memoria
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
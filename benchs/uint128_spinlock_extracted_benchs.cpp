@@ -0,0 +1,236 @@
+/*
+ * Benchmarks para uint128_spinlock.hpp
+ * ThreadSafeUint128SpinLock anterior (test_and_set en cada vuelta, una pausa,
+ * sin relleno) frente a TTAS con espera exponencial, ticket y TTAS con
+ * alignas(64): contador compartido, arrays de contadores por hilo (falso
+ * compartimiento) y reparto de adquisiciones entre hilos
+ */
+
+#include "../include/uint128/uint128_spinlock.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+using namespace nstd::uint128_threadsafe;
+
+// Implementación anterior de ThreadSafeUint128SpinLock, como referencia
+class LegacySpinLockUint128
+{
+  private:
+    uint128_t value_;
+    mutable std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+
+    void acquire() const
+    {
+        while (lock_.test_and_set(std::memory_order_acquire)) {
+#if defined(__x86_64__) || defined(_M_X64)
+            __builtin_ia32_pause();
+#endif
+        }
+    }
+
+    void release() const
+    {
+        lock_.clear(std::memory_order_release);
+    }
+
+  public:
+    explicit LegacySpinLockUint128(uint128_t val = uint128_t(0)) : value_(val) {}
+
+    uint128_t get() const
+    {
+        acquire();
+        uint128_t result = value_;
+        release();
+        return result;
+    }
+
+    void add(uint128_t val)
+    {
+        acquire();
+        value_ += val;
+        release();
+    }
+};
+
+// =============================================================================
+// UTILIDADES DE BENCHMARK
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string kernel;
+    std::string variant;
+    double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+volatile uint64_t g_sink = 0;
+
+std::string get_compiler()
+{
+#if defined(__clang__)
+    return "Clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "GCC-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "MSVC-" + std::to_string(_MSC_VER);
+#else
+    return "Unknown";
+#endif
+}
+
+// Mejor de varias repeticiones, en ns por operación
+double time_per_op(std::size_t n, int reps, const std::function<void()>& f)
+{
+    using clock = std::chrono::high_resolution_clock;
+    double best = 1e30;
+    f(); // Calentamiento
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = clock::now();
+        f();
+        auto t1 = clock::now();
+        const double ns =
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void report(const std::string& kernel, const std::string& variant, double ns)
+{
+    std::cout << "  " << std::left << std::setw(20) << kernel << std::setw(10) << variant
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ns
+              << " ns/op\n";
+    g_results.push_back({kernel, variant, ns});
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+template <typename F> double run_threads(unsigned threads, std::size_t per_thread, F&& body)
+{
+    return time_per_op(per_thread * threads, 3, [&] {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                for (std::size_t i = 0; i < per_thread; ++i)
+                    body(t);
+            });
+        }
+        for (auto& th : pool)
+            th.join();
+    });
+}
+
+std::string threads_label(unsigned t)
+{
+    std::string label = "x";
+    label += std::to_string(t);
+    return label;
+}
+
+// Todos los hilos sobre un único contador
+template <typename Counter> void bench_shared(const std::string& name, unsigned threads)
+{
+    Counter counter(uint128_t(0));
+    const std::size_t per_thread = (1 << 20) / threads;
+    report(name + " shared", threads_label(threads),
+           run_threads(threads, per_thread, [&](unsigned) { counter.add(uint128_t(1)); }));
+    g_sink = g_sink + counter.get().low();
+}
+
+// Cada hilo con su contador, contiguos en un array: sólo hay falso compartimiento
+template <typename Counter> void bench_array(const std::string& name, unsigned threads)
+{
+    std::unique_ptr<Counter[]> counters(new Counter[threads]);
+    const std::size_t per_thread = 1 << 18;
+    report(name + " array", threads_label(threads),
+           run_threads(threads, per_thread, [&](unsigned t) { counters[t].add(uint128_t(1)); }));
+    g_sink = g_sink + counters[0].get().low();
+}
+
+// Adquisiciones por hilo en 100 ms: mínimo / máximo (1.00 = reparto perfecto)
+template <typename Counter> void bench_fairness(const std::string& name, unsigned threads)
+{
+    Counter counter(uint128_t(0));
+    std::vector<uint64_t> per_thread(threads, 0);
+    std::atomic<bool> go{false};
+    std::atomic<bool> done{false};
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            while (!go.load())
+                std::this_thread::yield();
+            uint64_t n = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                counter.add(uint128_t(1));
+                ++n;
+            }
+            per_thread[t] = n;
+        });
+    }
+    go.store(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    done.store(true);
+    for (auto& th : pool)
+        th.join();
+    const auto [lo, hi] = std::minmax_element(per_thread.begin(), per_thread.end());
+    const double ratio = *hi ? static_cast<double>(*lo) / static_cast<double>(*hi) : 0.0;
+    std::cout << "  " << std::left << std::setw(20) << (name + " fairness") << std::setw(10)
+              << threads_label(threads) << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << ratio << " min/max\n";
+}
+
+template <typename Counter> void bench_all(const std::string& name)
+{
+    for (unsigned t : {1u, 2u, 4u, 8u, 16u})
+        bench_shared<Counter>(name, t);
+    for (unsigned t : {2u, 4u, 8u})
+        bench_array<Counter>(name, t);
+    bench_fairness<Counter>(name, 4);
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+int main()
+{
+    std::cout << "========================================\n";
+    std::cout << "uint128_t SpinLock Benchmarks\n";
+    std::cout << "========================================\n";
+    std::cout << "Compiler: " << get_compiler() << "\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "sizeof: legacy " << sizeof(LegacySpinLockUint128) << ", TTAS "
+              << sizeof(ThreadSafeUint128SpinLock) << ", padded "
+              << sizeof(ThreadSafeUint128SpinLockPadded) << "\n";
+
+    std::cout << "\n--- Anterior (test_and_set) ---\n";
+    bench_all<LegacySpinLockUint128>("legacy");
+    std::cout << "\n--- TTAS + espera exponencial ---\n";
+    bench_all<ThreadSafeUint128SpinLock>("ttas");
+    std::cout << "\n--- Ticket (FIFO) ---\n";
+    bench_all<ThreadSafeUint128TicketLock>("ticket");
+    std::cout << "\n--- TTAS alignas(64) ---\n";
+    bench_all<ThreadSafeUint128SpinLockPadded>("ttas pad");
+
+    std::cout << "\n========================================\n";
+    std::cout << "Total benchmarks: " << g_results.size() << "\n";
+    std::cout << "========================================\n";
+    std::cout << "\nBenchmarks completed successfully!\n";
+
+    return 0;
+}
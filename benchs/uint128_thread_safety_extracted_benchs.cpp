@@ -9,21 +9,34 @@
  * - Spin-lock wrapper
  * - std::atomic wrapper
  *
+ * Then a scaling matrix (1 to N threads, 0/50/90/99% reads, get/set/add/CAS/
+ * fetch_add) over every wrapper plus atomic128 and seqlock128, with ops/sec,
+ * p50/p99/p999 latency, per-thread fairness and optional JSON output and
+ * thread pinning. Flags: --threads N --ms N --pin --json FILE --matrix-only
+ * --no-matrix
+ *
  * Compile:
  *   g++ -std=c++20 -O2 -pthread -I../include \
  *       benchmarks/uint128_thread_safety_benchmarks.cpp -o uint128_thread_safety_bench -latomic
  */
 
+#include "../include/uint128/uint128_atomic.hpp"
+#include "../include/uint128/uint128_seqlock.hpp"
 #include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
 #include <shared_mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
+#include "thread_safety_matrix.hpp"
+
 using namespace nstd;
 #ifdef _MSC_VER
 #include <intrin.h>
@@ -513,10 +526,34 @@ void run_contention_analysis()
     }
 }
 
+// ========================= SCALING MATRIX =========================
+//
+// Every wrapper x operation x read mix x thread count; see
+// thread_safety_matrix.hpp for the cell layout and the options.
+
+void run_matrix(const matrix::options& opt)
+{
+    using namespace nstd::uint128_threadsafe;
+    matrix::run<uint128_t>(opt, "uint128_thread_safety_matrix",
+                           matrix::wrapper<ThreadSafeUint128>{"Mutex"},
+                           matrix::wrapper<ThreadSafeUint128RW>{"RW"},
+                           matrix::wrapper<ThreadSafeUint128Atomic>{"Atomic"},
+                           matrix::wrapper<ThreadSafeUint128SpinLock>{"SpinLock"},
+                           matrix::wrapper<ThreadSafeUint128TicketLock>{"TicketLock"},
+                           matrix::wrapper<nstd::atomic_uint128>{"atomic128"},
+                           matrix::wrapper<nstd::seqlock_uint128>{"seqlock128"});
+}
+
 // ========================= MAIN =========================
 
-int main()
+int main(int argc, char* argv[])
 {
+    const matrix::options opt = matrix::parse_options(argc, argv);
+    if (!opt.run_legacy) {
+        run_matrix(opt);
+        return 0;
+    }
+
     std::cout << "╔=============================================================╗" << std::endl;
     std::cout << "║  Thread Safety Benchmarks for uint128_t                   ║" << std::endl;
     std::cout << "╚=============================================================╝" << std::endl;
@@ -574,5 +611,9 @@ int main()
     std::cout << "  * Use RW-lock for read-heavy workloads (>90% reads)" << std::endl;
     std::cout << "  * Use Spin-lock for low-contention scenarios" << std::endl;
 
+    if (opt.run_matrix) {
+        run_matrix(opt);
+    }
+
     return 0;
 }
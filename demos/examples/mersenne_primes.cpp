@@ -8,7 +8,8 @@
  *
  * Este ejemplo:
  * - Genera números de Mersenne
- * - Implementa test de primalidad Lucas-Lehmer simplificado
+ * - Aplica el test de Lucas-Lehmer (nstd::lucas_lehmer, aritmética módulo
+ *   2^p - 1 sin divisiones) a todos los exponentes hasta 127
  * - Muestra los primeros primos de Mersenne conocidos
  * - Demuestra el crecimiento exponencial de estos números
  */
@@ -17,6 +18,7 @@
 #include <iomanip>
 #include <iostream>
 #include <uint128/uint128_iostreams.hpp>
+#include <uint128/uint128_mersenne.hpp>
 #include <uint128/uint128_t.hpp>
 #include <vector>
 
@@ -47,20 +49,12 @@ uint128_t mersenne(int p)
     return (uint128_t(1) << p) - 1;
 }
 
-// Test de Lucas-Lehmer simplificado para números pequeños
-bool lucas_lehmer_test(int p, const uint128_t& mp)
+// Test de Lucas-Lehmer: s = s^2 - 2 mod M_p, p - 2 veces. El cuadrado de
+// 256 bits y la reducción por plegado de nstd::lucas_lehmer valen hasta
+// p = 127; con (s * s - 2) % mp el producto se truncaba a 128 bits para p > 64
+bool lucas_lehmer_test(int p)
 {
-    if (p == 2)
-        return true; // M_2 = 3 es primo
-
-    uint128_t s = 4_u128;
-
-    // Ejecutar p-2 iteraciones: s = (s^2 - 2) mod mp
-    for (int i = 0; i < p - 2; ++i) {
-        s = (s * s - 2) % mp;
-    }
-
-    return s == 0;
+    return lucas_lehmer(static_cast<unsigned>(p));
 }
 
 // Verificar divisibilidad por factores pequeños
@@ -102,13 +96,7 @@ void demo_mersenne_numbers()
                   << (str.length() > 25 ? str.substr(0, 22) + "..." : str) << std::setw(12)
                   << str.length();
 
-        // Test de primalidad (solo para p <= 31 por eficiencia)
-        if (p <= 31) {
-            bool is_prime = lucas_lehmer_test(p, mp);
-            std::cout << (is_prime ? "✓ SÍ" : "✗ NO");
-        } else {
-            std::cout << "✓ SÍ (conocido)";
-        }
+        std::cout << (lucas_lehmer_test(p) ? "✓ SÍ" : "✗ NO");
 
         std::cout << "\n";
     }
@@ -221,23 +209,18 @@ void demo_search_simulation()
 {
     std::cout << "\n=== Simulación de Búsqueda ===\n\n";
 
-    std::cout << "Buscando primos de Mersenne hasta p = 31...\n\n";
+    std::cout << "Buscando primos de Mersenne hasta p = 127...\n\n";
 
     int found = 0;
     std::cout << "Primos encontrados:\n";
 
-    for (int p = 2; p <= 31; ++p) {
+    for (int p = 2; p <= 127; ++p) {
         if (!is_prime_simple(p))
             continue;
 
-        uint128_t mp = mersenne(p);
-
-        // Test simplificado
-        bool is_probably_prime = lucas_lehmer_test(p, mp);
-
-        if (is_probably_prime) {
+        if (lucas_lehmer_test(p)) {
             found++;
-            std::cout << "  ✓ M_" << std::setw(2) << p << " = " << mp << "\n";
+            std::cout << "  ✓ M_" << std::setw(3) << p << " = " << mersenne(p) << "\n";
         }
     }
 
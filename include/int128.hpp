@@ -140,6 +140,24 @@ static_assert(std::is_signed_v<int128_t>, "int128_t debe ser reconocido como sig
  * #include "uint128/uint128_ranges.hpp"     // std::iota, accumulate especializados
  * #include "uint128/uint128_concepts.hpp"   // C++20 concepts
  * #include "uint128/uint128_safe.hpp"       // Operaciones con verificación de overflow
+ * #include "uint128/uint128_flat_hash_map.hpp" // nstd::flat_hash_map (Swiss table)
+ * #include "uint128/uint128_soa.hpp"        // uint128_soa_vector + kernels AVX2/AVX-512
+ * #include "uint128/uint128_simd.hpp"       // Kernels SIMD sobre std::span<uint128_t>
+ * #include "uint128/uint128_accumulator.hpp" // Sumas, medias y varianzas exactas (192/320 bits)
+ * #include "uint128/uint128_parallel.hpp"    // Pool fork-join y política execution::par
+ * #include "uint128/uint128_atomic.hpp"      // atomic128 / atomic_ref128: CAS de 128 bits sin cerrojos
+ * #include "uint128/uint128_sharded_counter.hpp" // Contador fragmentado para escrituras masivas
+ * #include "uint128/uint128_seqlock.hpp"     // seqlock128: lecturas optimistas sin escrituras
+ * #include "uint128/uint128_spinlock.hpp"    // ttas_spinlock / ticket_spinlock
+ * #include "uint128/uint128_id_allocator.hpp" // id_allocator128: IDs únicos por bloques
+ * #include "uint128/uint128_counter_group.hpp" // counter_group128<N>: instantáneas consistentes
+ * #include "uint128/uint128_mpmc_ring.hpp"   // mpmc_ring128 / spsc_ring128: colas sin cerrojos
+ * #include "uint128/uint128_succinct.hpp"   // succinct_bitvector: rank O(1) y select
+ * #include "uint128/uint128_clmul.hpp"      // clmul / clmul_wide, gf2_128 y crc64 (PCLMULQDQ)
+ * #include "uint128/uint128_morton.hpp"     // morton2/3/4_encode/decode, hilbert2_encode/decode
+ * #include "uint128/uint128_bitset.hpp"     // bitset128_vector: AND/OR/ANDNOT, and_popcount
+ * #include "uint128/uint128_random.hpp"     // pcg64, lehmer128, xoshiro256pp; uniform_uint128_distribution
+ * #include "uint128/uint128_mersenne.hpp"   // mersenne_mod<P>, lucas_lehmer(p), polynomial_hash / rolling_hash
  *
  * Y equivalentes para int128:
  * #include "int128/int128_*.hpp"
@@ -27,6 +27,7 @@
 #ifndef INT128_ALGORITHM_HPP
 #define INT128_ALGORITHM_HPP
 
+#include "../uint128/uint128_wide.hpp"
 #include "int128_cmath.hpp"
 #include "int128_concepts.hpp"
 #include "int128_t.hpp"
@@ -111,6 +112,31 @@ ForwardIt find_if_int128(ForwardIt first, ForwardIt last,
     return std::find_if(first, last, pred);
 }
 
+/**
+ * @brief Cuenta los elementos que satisfacen el predicado
+ *
+ * @tparam InputIt Tipo de iterador
+ * @param first Iterador al inicio del rango
+ * @param last Iterador al final del rango
+ * @param pred Predicado a aplicar
+ * @return Numero de elementos para los que pred devuelve true
+ *
+ * @test test_count_if_int128
+ * @code{.cpp}
+ * // Cuenta los negativos
+ * std::vector<int128_t> vec = {int128_t(-1), int128_t(2), int128_t(-3)};
+ * auto n = count_if_int128(vec.begin(), vec.end(),
+ *     [](const int128_t& x) { return x < int128_t(0); });
+ * assert(n == 2);
+ * @endcode
+ */
+template <std::input_iterator InputIt>
+std::size_t count_if_int128(InputIt first, InputIt last, int128_concepts::int128_predicate auto pred)
+    requires std::same_as<typename std::iterator_traits<InputIt>::value_type, int128_t>
+{
+    return static_cast<std::size_t>(std::count_if(first, last, pred));
+}
+
 // ===============================================================================
 // ALGORITMOS DE TRANSFORMACIoN
 // ===============================================================================
@@ -370,7 +396,7 @@ int128_t lcm_range(InputIt first, InputIt last)
 
     int128_t result = (*first++).abs();
     while (first != last && result != int128_t(0)) {
-        result = nstd::gcd(result, (*first++).abs());
+        result = nstd::lcm(result, (*first++).abs());
     }
     return result;
 }
@@ -492,6 +518,9 @@ int128_t max_abs_value(InputIt first, InputIt last)
 
 /**
  * @brief Estadisticas basicas de un rango de int128_t
+ *
+ * @note `sum` es modulo 2^128; para sumas que puedan desbordar usar
+ *       calculate_stats_exact() (uint128_accumulator.hpp)
  */
 struct int128_stats {
     int128_t min_value;
@@ -502,16 +531,14 @@ struct int128_stats {
     std::size_t positive_count;
     std::size_t zero_count;
 
+    /// sum / count correctamente redondeado (los 128 bits de sum)
     double mean() const
     {
         if (count == 0)
             return 0.0;
-        // Conversion simple evitando problemas de casting
-        bool is_negative = sum < int128_t(0);
-        int128_t abs_sum = is_negative ? -sum : sum;
-        // Usar conversion a double directamente
-        double sum_as_double = static_cast<double>(abs_sum.low());
-        double result = sum_as_double / count;
+        namespace w = nstd::detail::wide;
+        const bool is_negative = sum < int128_t(0);
+        const double result = w::ratio_to_double(w::magnitude(sum), w::limbs<1>{count});
         return is_negative ? -result : result;
     }
 
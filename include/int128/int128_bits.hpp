@@ -3,6 +3,7 @@
 #define INT128_BITS_HPP
 
 #include "int128_t.hpp"
+#include "../uint128/uint128_bits.hpp"
 #include <bitset>
 #include <type_traits>
 
@@ -224,16 +225,8 @@ using int128_t = nstd::int128_t;
  */
 constexpr int128_t rotl(const int128_t& value, int shift) noexcept
 {
-    shift %= 128;
-    if (shift == 0)
-        return value;
-    if (shift < 0)
-        shift += 128;
-
     // Trabajar con representación unsigned para rotación
-    uint128_t uval = value.to_uint128();
-    uint128_t result = (uval << shift) | (uval >> (128 - shift));
-    return int128_t(result);
+    return int128_t(uint128_bits::rotl(value.to_uint128(), shift));
 }
 
 /**
@@ -241,16 +234,8 @@ constexpr int128_t rotl(const int128_t& value, int shift) noexcept
  */
 constexpr int128_t rotr(const int128_t& value, int shift) noexcept
 {
-    shift %= 128;
-    if (shift == 0)
-        return value;
-    if (shift < 0)
-        shift += 128;
-
     // Trabajar con representación unsigned para rotación
-    uint128_t uval = value.to_uint128();
-    uint128_t result = (uval >> shift) | (uval << (128 - shift));
-    return int128_t(result);
+    return int128_t(uint128_bits::rotr(value.to_uint128(), shift));
 }
 
 /**
@@ -0,0 +1,187 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef INT128_RANDOM_HPP
+#define INT128_RANDOM_HPP
+
+/**
+ * @file int128_random.hpp
+ * @brief Distribución uniforme de int128_t sobre los generadores de uint128_random.hpp
+ *
+ * [a, b] se traslada a [0, b - a] en aritmética sin signo (módulo 2^128, así
+ * que vale para cualquier a <= b, incluido el rango completo) y se resuelve
+ * con el mismo método de Lemire que uniform_uint128_distribution.
+ */
+
+#include "../uint128/uint128_random.hpp"
+#include "../uint128/uint128_t.hpp"
+#include "int128_limits.hpp"
+#include "int128_t.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+
+namespace nstd
+{
+
+/**
+ * @brief Distribución uniforme de enteros en [a, b] para int128_t
+ *
+ * Misma interfaz que std::uniform_int_distribution.
+ */
+class uniform_int128_distribution
+{
+  public:
+    using result_type = int128_t;
+
+    class param_type
+    {
+      public:
+        using distribution_type = uniform_int128_distribution;
+
+        param_type() noexcept
+            : a_(nstd::numeric_limits<int128_t>::min()), b_(nstd::numeric_limits<int128_t>::max())
+        {
+        }
+
+        /// @throws std::invalid_argument si a > b
+        explicit param_type(const int128_t& a,
+                            const int128_t& b = nstd::numeric_limits<int128_t>::max())
+            : a_(a), b_(b)
+        {
+            if (a > b) {
+                throw std::invalid_argument("uniform_int128_distribution: a > b");
+            }
+        }
+
+        const int128_t& a() const noexcept
+        {
+            return a_;
+        }
+
+        const int128_t& b() const noexcept
+        {
+            return b_;
+        }
+
+        friend bool operator==(const param_type& x, const param_type& y) noexcept
+        {
+            return x.a_ == y.a_ && x.b_ == y.b_;
+        }
+
+      private:
+        int128_t a_;
+        int128_t b_;
+    };
+
+    uniform_int128_distribution() noexcept = default;
+
+    /// @throws std::invalid_argument si a > b
+    explicit uniform_int128_distribution(const int128_t& a,
+                                         const int128_t& b = nstd::numeric_limits<int128_t>::max())
+        : p_(a, b)
+    {
+    }
+
+    explicit uniform_int128_distribution(const param_type& p) noexcept : p_(p) {}
+
+    void reset() noexcept {}
+
+    template <std::uniform_random_bit_generator G> result_type operator()(G& g)
+    {
+        return (*this)(g, p_);
+    }
+
+    template <std::uniform_random_bit_generator G> result_type operator()(G& g, const param_type& p)
+    {
+        const uint128_t a = p.a().to_uint128();
+        return int128_t(detail::uniform_in(g, a, p.b().to_uint128() - a));
+    }
+
+    /// out[i] = (*this)(g) en bloque, por tramos sobre un buffer sin signo;
+    /// los tramos comparten el umbral de rechazo
+    template <std::uniform_random_bit_generator G> void generate(std::span<int128_t> out, G& g)
+    {
+        constexpr std::size_t chunk = 256;
+        uint128_t buffer[chunk];
+        const uint128_t a = p_.a().to_uint128();
+        const uint128_t span = p_.b().to_uint128() - a;
+        std::optional<uint128_t> threshold;
+        for (std::size_t base = 0; base < out.size(); base += chunk) {
+            const std::size_t k = std::min(chunk, out.size() - base);
+            detail::generate_uniform(std::span<uint128_t>(buffer, k), a, span, g, threshold);
+            for (std::size_t i = 0; i < k; ++i) {
+                out[base + i] = int128_t(buffer[i]);
+            }
+        }
+    }
+
+    const int128_t& a() const noexcept
+    {
+        return p_.a();
+    }
+
+    const int128_t& b() const noexcept
+    {
+        return p_.b();
+    }
+
+    param_type param() const noexcept
+    {
+        return p_;
+    }
+
+    void param(const param_type& p) noexcept
+    {
+        p_ = p;
+    }
+
+    result_type min() const noexcept
+    {
+        return p_.a();
+    }
+
+    result_type max() const noexcept
+    {
+        return p_.b();
+    }
+
+    friend bool operator==(const uniform_int128_distribution& x,
+                           const uniform_int128_distribution& y) noexcept
+    {
+        return x.p_ == y.p_;
+    }
+
+  private:
+    param_type p_;
+};
+
+} // namespace nstd
+
+#endif // INT128_RANDOM_HPP
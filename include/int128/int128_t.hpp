@@ -698,18 +698,8 @@ class int128_t
      */
     constexpr int128_t operator<<(int shift) const noexcept
     {
-        if (shift <= 0)
-            return *this;
-        if (shift >= 128)
-            return int128_t(0);
-
-        if (shift >= 64) {
-            return int128_t(data[0] << (shift - 64), 0);
-        } else {
-            uint64_t high_shifted = (data[1] << shift) | (data[0] >> (64 - shift));
-            uint64_t low_shifted = data[0] << shift;
-            return int128_t(high_shifted, low_shifted);
-        }
+        const uint128_t shifted = to_uint128().shift_left(shift);
+        return int128_t(shifted.high(), shifted.low());
     }
 
     /**
@@ -717,24 +707,15 @@ class int128_t
      */
     constexpr int128_t operator>>(int shift) const noexcept
     {
-        if (shift <= 0)
-            return *this;
-        if (shift >= 128) {
-            // Extensión de signo completa
-            return is_negative() ? int128_t(-1) : int128_t(0);
-        }
-
-        uint64_t sign_extension = is_negative() ? UINT64_MAX : 0;
-
-        if (shift >= 64) {
-            uint64_t low_shifted =
-                static_cast<uint64_t>(static_cast<int64_t>(data[1]) >> (shift - 64));
-            return int128_t(sign_extension, low_shifted);
-        } else {
-            uint64_t low_shifted = (data[0] >> shift) | (data[1] << (64 - shift));
-            uint64_t high_shifted = static_cast<uint64_t>(static_cast<int64_t>(data[1]) >> shift);
-            return int128_t(high_shifted, low_shifted);
-        }
+        // Sin saltos: desplazar 127 ya deja solo la extensión de signo, así
+        // que basta con saturar `shift` a [0, 127]
+        unsigned n = static_cast<unsigned>(shift) & ~static_cast<unsigned>(shift >> 31); // max(s, 0)
+        n |= (0u - static_cast<unsigned>((n >> 7) != 0)) & 127u; // n >= 128 actúa como 127
+        const uint64_t sign_extension = static_cast<uint64_t>(static_cast<int64_t>(data[1]) >> 63);
+        const uint64_t wide = uint64_t(0) - static_cast<uint64_t>((n >> 6) & 1);
+        const uint64_t high = static_cast<uint64_t>(static_cast<int64_t>(data[1]) >> (n & 63));
+        const uint64_t low = intrinsics::funnel_shr64(data[1], data[0], n);
+        return int128_t((sign_extension & wide) | (high & ~wide), (high & wide) | (low & ~wide));
     }
 
     int128_t& operator<<=(int shift) noexcept
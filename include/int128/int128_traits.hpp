@@ -112,11 +112,16 @@ template <> struct common_type<uint128_t, int128_t> {
 // HASH
 // ===============================================================================
 
+/**
+ * @brief Especialización de nstd::hash para int128_t
+ *
+ * Comparte el mezclador hash128() de uint128_traits.hpp: un valor con signo
+ * y su reinterpretación sin signo producen el mismo hash.
+ */
 template <> struct hash<int128_t> {
-    size_t operator()(const int128_t& value) const noexcept
+    constexpr size_t operator()(const int128_t& value) const noexcept
     {
-        std::hash<uint64_t> hasher;
-        return hasher(value.high()) ^ (hasher(value.low()) << 1);
+        return static_cast<size_t>(hash128(value.high(), value.low()));
     }
 };
 
@@ -133,4 +138,19 @@ template <> struct make_unsigned<int128_t> {
 };
 
 } // namespace nstd
+
+// ===============================================================================
+// STD::HASH - ESPECIALIZACIÓN PARA INT128_T
+// ===============================================================================
+
+namespace std
+{
+template <> struct hash<nstd::int128_t> {
+    constexpr size_t operator()(const nstd::int128_t& value) const noexcept
+    {
+        return nstd::hash<nstd::int128_t>{}(value);
+    }
+};
+} // namespace std
+
 #endif // INT128_TRAITS_HPP
\ No newline at end of file
@@ -0,0 +1,333 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ */
+
+/**
+ * @file atomic_operations.hpp
+ * @brief Operaciones atómicas de 128 bits sobre dos uint64_t alineados a 16 bytes
+ *
+ * Primitivas independientes del tipo (las usan atomic128<uint128_t> y
+ * atomic128<int128_t>). El bloque es `uint64_t p[2]` con p[0] = parte baja,
+ * alineado a 16 bytes.
+ *
+ * | Plataforma             | CAS                        | load / store                   |
+ * |------------------------|----------------------------|--------------------------------|
+ * | x86-64 GCC/Clang/Intel | lock cmpxchg16b (si cx16)  | vmovdqa si AVX en Intel/AMD    |
+ * | x86-64 MSVC            | _InterlockedCompareExchange128 | CAS                        |
+ * | AArch64 + LSE          | caspal                     | CAS                            |
+ * | AArch64 sin LSE        | ldaxp / stlxp              | CAS                            |
+ * | Resto (o x86 sin cx16) | Fallback con cerrojos      | Fallback con cerrojos          |
+ *
+ * Fallback: tabla global de 64 spin-locks (uno por línea de caché) indexada por
+ * la dirección. Es correcto entre todos los accesos que pasen por estas
+ * funciones, pero no es lock-free: cas128_is_lock_free() devuelve false.
+ *
+ * Órdenes de memoria: en x86 toda instrucción con prefijo lock es una barrera
+ * completa, así que cualquier orden se cumple; en AArch64 se usa siempre la
+ * forma acquire-release. Los órdenes más débiles se aceptan pero no abaratan
+ * la operación.
+ */
+
+#ifndef INTRINSICS_ATOMIC_OPERATIONS_HPP
+#define INTRINSICS_ATOMIC_OPERATIONS_HPP
+
+#include "compiler_detection.hpp"
+#include "cpu_features.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if INTRINSICS_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+// ============================================================================
+// SELECCIÓN DE IMPLEMENTACIÓN
+// ============================================================================
+
+#if INTRINSICS_ARCH_X86_64 && !INTRINSICS_COMPILER_MSVC && defined(__GNUC__)
+#define INTRINSICS_CAS128_X86_ASM 1
+#elif INTRINSICS_ARCH_X86_64 && INTRINSICS_COMPILER_MSVC
+#define INTRINSICS_CAS128_MSVC 1
+#elif INTRINSICS_ARCH_ARM64 && defined(__GNUC__)
+#define INTRINSICS_CAS128_ARM64 1
+#endif
+
+/**
+ * @def INTRINSICS_CAS128_ALWAYS_NATIVE
+ * @brief 1 si el CAS de 128 bits es nativo sin comprobación en runtime
+ *
+ * En x86-64 sólo si se compila con -mcx16 (o un -march que lo implique);
+ * si no, se consulta cpu().cx16 la primera vez.
+ */
+#if defined(INTRINSICS_CAS128_X86_ASM) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+#define INTRINSICS_CAS128_ALWAYS_NATIVE 1
+#elif defined(INTRINSICS_CAS128_MSVC) || defined(INTRINSICS_CAS128_ARM64)
+#define INTRINSICS_CAS128_ALWAYS_NATIVE 1
+#else
+#define INTRINSICS_CAS128_ALWAYS_NATIVE 0
+#endif
+
+namespace intrinsics
+{
+
+/// Alineación exigida al bloque de 128 bits
+inline constexpr std::size_t cas128_alignment = 16;
+
+/**
+ * @brief Pista de espera activa para el núcleo (pause en x86, yield en AArch64)
+ */
+inline void cpu_relax() noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD
+    _mm_pause();
+#elif INTRINSICS_ARCH_ARM64 && defined(__GNUC__)
+    __asm__ __volatile__("yield");
+#elif INTRINSICS_ARCH_ARM64 && INTRINSICS_COMPILER_MSVC
+    __yield();
+#endif
+}
+
+namespace detail
+{
+
+// ----------------------------------------------------------------------------
+// Fallback: spin-locks repartidos por dirección
+// ----------------------------------------------------------------------------
+
+struct alignas(64) cas128_spin {
+    std::atomic<bool> locked{false};
+};
+
+inline cas128_spin& cas128_lock_for(const void* p) noexcept
+{
+    static cas128_spin table[64];
+    return table[(reinterpret_cast<std::uintptr_t>(p) >> 4) % 64];
+}
+
+class cas128_guard
+{
+  public:
+    explicit cas128_guard(const void* p) noexcept : spin_(cas128_lock_for(p))
+    {
+        while (spin_.locked.exchange(true, std::memory_order_acquire)) {
+            while (spin_.locked.load(std::memory_order_relaxed)) {
+                cpu_relax();
+            }
+        }
+    }
+
+    ~cas128_guard()
+    {
+        spin_.locked.store(false, std::memory_order_release);
+    }
+
+    cas128_guard(const cas128_guard&) = delete;
+    cas128_guard& operator=(const cas128_guard&) = delete;
+
+  private:
+    cas128_spin& spin_;
+};
+
+inline bool cas128_locked(uint64_t* p, uint64_t& expected_lo, uint64_t& expected_hi,
+                          uint64_t desired_lo, uint64_t desired_hi) noexcept
+{
+    cas128_guard guard(p);
+    if (p[0] == expected_lo && p[1] == expected_hi) {
+        p[0] = desired_lo;
+        p[1] = desired_hi;
+        return true;
+    }
+    expected_lo = p[0];
+    expected_hi = p[1];
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Rutas nativas
+// ----------------------------------------------------------------------------
+
+#if defined(INTRINSICS_CAS128_X86_ASM)
+
+inline bool cas128_native(uint64_t* p, uint64_t& expected_lo, uint64_t& expected_hi,
+                          uint64_t desired_lo, uint64_t desired_hi) noexcept
+{
+    bool ok;
+    __asm__ __volatile__("lock cmpxchg16b %1"
+                         : "=@ccz"(ok), "+m"(*p), "+a"(expected_lo), "+d"(expected_hi)
+                         : "b"(desired_lo), "c"(desired_hi)
+                         : "memory");
+    return ok;
+}
+
+// Accesos de 16 bytes con una sola instrucción (sólo si cpu().atomic_vmov16)
+INTRINSICS_TARGET("avx") inline void load128_vmov(const uint64_t* p, uint64_t& lo, uint64_t& hi) noexcept
+{
+    __m128i v;
+    __asm__ __volatile__("vmovdqa %1, %0" : "=x"(v) : "m"(*reinterpret_cast<const __m128i*>(p)) : "memory");
+    lo = static_cast<uint64_t>(_mm_cvtsi128_si64(v));
+    hi = static_cast<uint64_t>(_mm_extract_epi64(v, 1));
+}
+
+INTRINSICS_TARGET("avx") inline void store128_vmov(uint64_t* p, uint64_t lo, uint64_t hi, bool fence) noexcept
+{
+    const __m128i v = _mm_set_epi64x(static_cast<long long>(hi), static_cast<long long>(lo));
+    __asm__ __volatile__("vmovdqa %1, %0" : "=m"(*reinterpret_cast<__m128i*>(p)) : "x"(v) : "memory");
+    if (fence) {
+        __asm__ __volatile__("mfence" ::: "memory");
+    }
+}
+
+#elif defined(INTRINSICS_CAS128_MSVC)
+
+inline bool cas128_native(uint64_t* p, uint64_t& expected_lo, uint64_t& expected_hi,
+                          uint64_t desired_lo, uint64_t desired_hi) noexcept
+{
+    __int64 comparand[2] = {static_cast<__int64>(expected_lo), static_cast<__int64>(expected_hi)};
+    const bool ok = _InterlockedCompareExchange128(reinterpret_cast<volatile __int64*>(p),
+                                                   static_cast<__int64>(desired_hi),
+                                                   static_cast<__int64>(desired_lo), comparand) != 0;
+    expected_lo = static_cast<uint64_t>(comparand[0]);
+    expected_hi = static_cast<uint64_t>(comparand[1]);
+    return ok;
+}
+
+#elif defined(INTRINSICS_CAS128_ARM64)
+
+inline bool cas128_native(uint64_t* p, uint64_t& expected_lo, uint64_t& expected_hi,
+                          uint64_t desired_lo, uint64_t desired_hi) noexcept
+{
+#if defined(__ARM_FEATURE_ATOMICS)
+    // CASP exige pares de registros consecutivos empezando en uno par
+    register uint64_t x0 __asm__("x0") = expected_lo;
+    register uint64_t x1 __asm__("x1") = expected_hi;
+    register uint64_t x2 __asm__("x2") = desired_lo;
+    register uint64_t x3 __asm__("x3") = desired_hi;
+    __asm__ __volatile__("caspal %0, %1, %2, %3, %4"
+                         : "+r"(x0), "+r"(x1)
+                         : "r"(x2), "r"(x3), "Q"(*p)
+                         : "memory");
+    const bool ok = x0 == expected_lo && x1 == expected_hi;
+    expected_lo = x0;
+    expected_hi = x1;
+    return ok;
+#else
+    uint64_t lo, hi;
+    uint32_t failed;
+    // Si no coincide se reescribe lo leído: sólo así ldaxp garantiza una lectura atómica del par
+    __asm__ __volatile__("1: ldaxp %0, %1, %3\n"
+                         "   cmp %0, %4\n"
+                         "   ccmp %1, %5, #0, eq\n"
+                         "   b.ne 2f\n"
+                         "   stlxp %w2, %6, %7, %3\n"
+                         "   cbnz %w2, 1b\n"
+                         "   b 3f\n"
+                         "2: stlxp %w2, %0, %1, %3\n"
+                         "   cbnz %w2, 1b\n"
+                         "3:"
+                         : "=&r"(lo), "=&r"(hi), "=&r"(failed), "+Q"(*p)
+                         : "r"(expected_lo), "r"(expected_hi), "r"(desired_lo), "r"(desired_hi)
+                         : "cc", "memory");
+    const bool ok = lo == expected_lo && hi == expected_hi;
+    expected_lo = lo;
+    expected_hi = hi;
+    return ok;
+#endif
+}
+
+#endif
+
+} // namespace detail
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * @brief true si cas128/load128/store128 usan instrucciones nativas (sin cerrojos)
+ */
+inline bool cas128_is_lock_free() noexcept
+{
+#if INTRINSICS_CAS128_ALWAYS_NATIVE
+    return true;
+#elif defined(INTRINSICS_CAS128_X86_ASM)
+    return cpu().cx16;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Compare-and-swap de 128 bits
+ *
+ * Si {p[0], p[1]} == {expected_lo, expected_hi} escribe {desired_lo, desired_hi}
+ * y devuelve true; si no, carga el valor actual en expected_* y devuelve false.
+ *
+ * @pre p alineado a 16 bytes
+ */
+inline bool cas128(uint64_t* p, uint64_t& expected_lo, uint64_t& expected_hi, uint64_t desired_lo,
+                   uint64_t desired_hi) noexcept
+{
+#if INTRINSICS_CAS128_ALWAYS_NATIVE
+    return detail::cas128_native(p, expected_lo, expected_hi, desired_lo, desired_hi);
+#elif defined(INTRINSICS_CAS128_X86_ASM)
+    if (cpu().cx16) {
+        return detail::cas128_native(p, expected_lo, expected_hi, desired_lo, desired_hi);
+    }
+    return detail::cas128_locked(p, expected_lo, expected_hi, desired_lo, desired_hi);
+#else
+    return detail::cas128_locked(p, expected_lo, expected_hi, desired_lo, desired_hi);
+#endif
+}
+
+/**
+ * @brief Carga atómica de 128 bits
+ *
+ * Sin acceso de 16 bytes nativo se hace con un CAS {0,0} -> {0,0}, que escribe
+ * en la línea de caché: el bloque no puede estar en memoria de sólo lectura.
+ */
+inline void load128(const uint64_t* p, uint64_t& lo, uint64_t& hi) noexcept
+{
+#if defined(INTRINSICS_CAS128_X86_ASM)
+    if (cpu().atomic_vmov16) {
+        detail::load128_vmov(p, lo, hi);
+        return;
+    }
+#endif
+    lo = 0;
+    hi = 0;
+    cas128(const_cast<uint64_t*>(p), lo, hi, 0, 0);
+}
+
+/**
+ * @brief Almacenamiento atómico de 128 bits
+ */
+inline void store128(uint64_t* p, uint64_t lo, uint64_t hi,
+                     std::memory_order order = std::memory_order_seq_cst) noexcept
+{
+#if defined(INTRINSICS_CAS128_X86_ASM)
+    if (cpu().atomic_vmov16) {
+        detail::store128_vmov(p, lo, hi, order == std::memory_order_seq_cst);
+        return;
+    }
+#else
+    (void)order;
+#endif
+    uint64_t cur_lo = 0, cur_hi = 0; // Si falla, el primer CAS trae el valor actual
+    while (!cas128(p, cur_lo, cur_hi, lo, hi)) {
+    }
+}
+
+/**
+ * @brief Intercambio atómico de 128 bits; devuelve el valor anterior en old_*
+ */
+inline void exchange128(uint64_t* p, uint64_t lo, uint64_t hi, uint64_t& old_lo, uint64_t& old_hi) noexcept
+{
+    load128(p, old_lo, old_hi);
+    while (!cas128(p, old_lo, old_hi, lo, hi)) {
+    }
+}
+
+} // namespace intrinsics
+
+#endif // INTRINSICS_ATOMIC_OPERATIONS_HPP
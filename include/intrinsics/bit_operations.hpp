@@ -4,7 +4,7 @@
 
 /**
  * @file bit_operations.hpp
- * @brief Operaciones de bits multiplataforma (popcount, clz, ctz)
+ * @brief Operaciones de bits multiplataforma (popcount, clz, ctz, pext/pdep, funnel shift, select)
  *
  * Proporciona implementaciones optimizadas para cada compilador/arquitectura:
  * - GCC/Clang/Intel: __builtin_*
@@ -177,6 +177,162 @@ inline constexpr int parity64(uint64_t x) noexcept
 #endif
 }
 
+// ============================================================================
+// PEXT / PDEP - Compresión y expansión de bits por máscara (software)
+// ============================================================================
+
+/**
+ * @brief Extrae los bits de x seleccionados por m y los compacta a la derecha
+ *
+ * Método de máscaras mágicas de Hacker's Delight (7-4, "compress"): seis
+ * pasadas de prefijo paralelo, sin bucle por bit. Coste fijo de unas 60
+ * operaciones, independiente de la máscara; es la alternativa a PEXT en CPUs
+ * sin BMI2 o con PEXT en microcódigo (AMD anterior a Zen 3).
+ *
+ * @param x Valor fuente
+ * @param m Máscara de bits a extraer
+ * @return Bits de x en las posiciones de m, contiguos desde el bit 0
+ */
+inline constexpr uint64_t pext64_soft(uint64_t x, uint64_t m) noexcept
+{
+    x &= m;
+    uint64_t mk = ~m << 1; // Ceros a la derecha de cada bit de m que hay que contar
+    for (int i = 0; i < 6; ++i) {
+        uint64_t mp = mk ^ (mk << 1); // Prefijo XOR paralelo
+        mp ^= mp << 2;
+        mp ^= mp << 4;
+        mp ^= mp << 8;
+        mp ^= mp << 16;
+        mp ^= mp << 32;
+        const uint64_t mv = mp & m; // Bits que se desplazan 2^i posiciones
+        m = (m ^ mv) | (mv >> (1 << i));
+        const uint64_t t = x & mv;
+        x = (x ^ t) | (t >> (1 << i));
+        mk &= ~mp;
+    }
+    return x;
+}
+
+/**
+ * @brief Deposita los bits bajos de x en las posiciones marcadas por m
+ *
+ * Inversa de pext64_soft (Hacker's Delight 7-5, "expand"): calcula las mismas
+ * seis máscaras de movimiento y las aplica en orden inverso.
+ *
+ * @param x Valor fuente (se consumen popcount64(m) bits bajos)
+ * @param m Máscara de posiciones destino
+ * @return Valor con los bits de x repartidos en las posiciones de m
+ */
+inline constexpr uint64_t pdep64_soft(uint64_t x, uint64_t m) noexcept
+{
+    const uint64_t m0 = m;
+    uint64_t moves[6] = {};
+    uint64_t mk = ~m << 1;
+    for (int i = 0; i < 6; ++i) {
+        uint64_t mp = mk ^ (mk << 1);
+        mp ^= mp << 2;
+        mp ^= mp << 4;
+        mp ^= mp << 8;
+        mp ^= mp << 16;
+        mp ^= mp << 32;
+        const uint64_t mv = mp & m;
+        moves[i] = mv;
+        m = (m ^ mv) | (mv >> (1 << i));
+        mk &= ~mp;
+    }
+    for (int i = 5; i >= 0; --i) {
+        const uint64_t mv = moves[i];
+        const uint64_t t = x << (1 << i);
+        x = (x & ~mv) | (t & mv);
+    }
+    return x & m0;
+}
+
+// ============================================================================
+// FUNNEL SHIFT - Desplazamiento de un par de palabras (SHLD / SHRD)
+// ============================================================================
+
+/**
+ * @brief Mitad alta de (hi:lo) << n
+ *
+ * Con `__int128` GCC y Clang emiten SHLD; el fallback portable usa
+ * `(lo >> 1) >> (63 - n)`, que evita el desplazamiento de 64 bits
+ * (indefinido) cuando n == 0 sin introducir ramas.
+ *
+ * @param hi Palabra alta
+ * @param lo Palabra baja
+ * @param n Posiciones (se toma módulo 64)
+ * @return Los 64 bits altos del par desplazado
+ */
+inline constexpr uint64_t funnel_shl64(uint64_t hi, uint64_t lo, unsigned n) noexcept
+{
+    n &= 63;
+#if INTRINSICS_COMPILER_MSVC && INTRINSICS_ARCH_X86_64
+    if (!INTRINSICS_IS_CONSTANT_EVALUATED()) {
+        return __shiftleft128(lo, hi, static_cast<unsigned char>(n));
+    }
+#elif defined(__SIZEOF_INT128__)
+    return static_cast<uint64_t>((((static_cast<unsigned __int128>(hi) << 64) | lo) << n) >> 64);
+#endif
+    return (hi << n) | ((lo >> 1) >> (63 - n));
+}
+
+/**
+ * @brief Mitad baja de (hi:lo) >> n
+ *
+ * @param hi Palabra alta
+ * @param lo Palabra baja
+ * @param n Posiciones (se toma módulo 64)
+ * @return Los 64 bits bajos del par desplazado (SHRD)
+ */
+inline constexpr uint64_t funnel_shr64(uint64_t hi, uint64_t lo, unsigned n) noexcept
+{
+    n &= 63;
+#if INTRINSICS_COMPILER_MSVC && INTRINSICS_ARCH_X86_64
+    if (!INTRINSICS_IS_CONSTANT_EVALUATED()) {
+        return __shiftright128(lo, hi, static_cast<unsigned char>(n));
+    }
+#elif defined(__SIZEOF_INT128__)
+    return static_cast<uint64_t>(((static_cast<unsigned __int128>(hi) << 64) | lo) >> n);
+#endif
+    return (lo >> n) | ((hi << 1) << (63 - n));
+}
+
+// ============================================================================
+// SELECT - Posición del k-ésimo bit establecido (software)
+// ============================================================================
+
+/**
+ * @brief Posición del k-ésimo bit establecido de x (k empieza en 0)
+ *
+ * Broadword: sumas de población por byte acumuladas con una multiplicación,
+ * comparación SWAR para localizar el byte y, dentro de él, como mucho siete
+ * borrados del bit más bajo. Sin saltos dependientes de los datos salvo el
+ * bucle final. Alternativa a `tzcnt(pdep(1 << k, x))` sin BMI2 rápido.
+ *
+ * @param x Valor a examinar
+ * @param k Índice del bit establecido buscado
+ * @return Posición (0-63), o 64 si x tiene k o menos bits establecidos
+ */
+inline constexpr int select64_soft(uint64_t x, int k) noexcept
+{
+    if (k < 0 || k >= popcount64(x))
+        return 64;
+    constexpr uint64_t ones = 0x0101010101010101ULL;
+    constexpr uint64_t highs = 0x8080808080808080ULL;
+    uint64_t s = x - ((x >> 1) & 0x5555555555555555ULL);
+    s = (s & 0x3333333333333333ULL) + ((s >> 2) & 0x3333333333333333ULL);
+    s = ((s + (s >> 4)) & 0x0F0F0F0F0F0F0F0FULL) * ones; // Byte j: bits en bytes 0..j
+    // Bit alto de cada byte cuya suma acumulada supera k
+    const uint64_t above = ((s | highs) - static_cast<uint64_t>(k + 1) * ones) & highs;
+    const int byte = ctz64(above) >> 3;
+    const int before = static_cast<int>(((s << 8) >> (byte * 8)) & 0xFF);
+    uint64_t b = (x >> (byte * 8)) & 0xFF;
+    for (int r = k - before; r > 0; --r)
+        b &= b - 1;
+    return byte * 8 + ctz64(b);
+}
+
 } // namespace intrinsics
 
 // ============================================================================
@@ -191,6 +347,11 @@ inline constexpr int parity64(uint64_t x) noexcept
  * - LZCNT: Instruction disponible desde ABM/Haswell (2013)
  * - TZCNT: Instruction disponible desde BMI1/Haswell (2013)
  * - Fallback x86: BSR (bit scan reverse) para CLZ, BSF para CTZ
+ * - PDEP/PEXT: BMI2 (Haswell, 2013). En AMD Zen 1/Zen 2 son microcódigo con
+ *   latencia dependiente de la máscara (hasta ~300 ciclos); pext64_soft y
+ *   pdep64_soft son más rápidas ahí
+ * - SHLD/SHRD: desplazamiento de un par de registros; con CMOV permiten
+ *   desplazar 128 bits sin saltos dependientes del número de posiciones
  *
  * ## ARM64 (AArch64)
  * - CLZ: Instruction nativa (Count Leading Zeros)
@@ -0,0 +1,273 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ */
+
+/**
+ * @file cpu_features.hpp
+ * @brief Detección en tiempo de ejecución de extensiones SIMD/ISA
+ *
+ * Las rutas vectoriales (AVX2, AVX-512, ...) se compilan siempre con
+ * atributos `target` por función, sin exigir `-march=native`, y se
+ * seleccionan en tiempo de ejecución según lo que reporta CPUID:
+ * - GCC/Clang/Intel en x86: `__get_cpuid_count` + XGETBV
+ * - MSVC en x86: `__cpuidex` + `_xgetbv`
+ * - Resto de arquitecturas: todas las extensiones x86 a `false`
+ *
+ * La detección se hace una única vez (static local, thread-safe en C++11).
+ */
+
+#ifndef INTRINSICS_CPU_FEATURES_HPP
+#define INTRINSICS_CPU_FEATURES_HPP
+
+#include "compiler_detection.hpp"
+#include <atomic>
+#include <cstdint>
+
+#if (INTRINSICS_ARCH_X86_64 || INTRINSICS_ARCH_X86_32)
+#if INTRINSICS_COMPILER_MSVC
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+#define INTRINSICS_HAS_X86_SIMD 1
+#else
+#define INTRINSICS_HAS_X86_SIMD 0
+#endif
+
+// ============================================================================
+// ATRIBUTO TARGET POR FUNCIÓN
+// ============================================================================
+
+/**
+ * @def INTRINSICS_TARGET(isa)
+ * @brief Habilita un conjunto de instrucciones sólo para una función
+ *
+ * En MSVC los intrínsecos AVX están siempre disponibles y la macro es vacía.
+ *
+ * @code
+ * INTRINSICS_TARGET("avx2") void kernel_avx2(...);
+ * @endcode
+ */
+#if INTRINSICS_HAS_X86_SIMD && !INTRINSICS_COMPILER_MSVC
+#define INTRINSICS_TARGET(isa) __attribute__((target(isa)))
+#else
+#define INTRINSICS_TARGET(isa)
+#endif
+
+namespace intrinsics
+{
+
+/**
+ * @brief Extensiones de la CPU relevantes para las rutas optimizadas
+ */
+struct cpu_features {
+    bool sse2 = false;
+    bool sse41 = false; ///< PEXTRQ/PINSRQ (_mm_extract_epi64) de los kernels PCLMULQDQ
+    bool sse42 = false;
+    bool popcnt = false;
+    bool lzcnt = false; ///< LZCNT (ABM); lzcnt(0) = 64, a diferencia de BSR
+    bool pclmul = false;
+    bool cx16 = false;   ///< cmpxchg16b
+    bool atomic_vmov16 = false; ///< Carga/almacenamiento alineado de 16 bytes atómico (AVX en Intel/AMD)
+    bool avx2 = false;   ///< Incluye soporte del SO para registros YMM
+    bool bmi2 = false;
+    bool fast_pdep = false; ///< BMI2 con PDEP/PEXT en hardware (no microcódigo, AMD anterior a Zen 3)
+    bool avx512f = false;  ///< Incluye soporte del SO para registros ZMM
+    bool avx512bw = false;
+    bool avx512vl = false;
+    bool avx512cd = false; ///< VPLZCNTQ
+    bool avx512_vpopcntdq = false;
+    bool vpclmulqdq = false;
+};
+
+/**
+ * @brief Nivel de vectorización elegido para kernels sobre arrays
+ */
+enum class simd_level : int {
+    scalar = 0,
+    avx2 = 1,
+    avx512 = 2,
+};
+
+namespace detail
+{
+
+#if INTRINSICS_HAS_X86_SIMD
+
+inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) noexcept
+{
+#if INTRINSICS_COMPILER_MSVC
+    int r[4];
+    __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = static_cast<uint32_t>(r[i]);
+    }
+#else
+    unsigned a = 0, b = 0, c = 0, d = 0;
+    if (!__get_cpuid_count(leaf, subleaf, &a, &b, &c, &d)) {
+        a = b = c = d = 0;
+    }
+    regs[0] = a;
+    regs[1] = b;
+    regs[2] = c;
+    regs[3] = d;
+#endif
+}
+
+inline uint64_t xgetbv0() noexcept
+{
+#if INTRINSICS_COMPILER_MSVC
+    return _xgetbv(0);
+#else
+    uint32_t eax = 0, edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+inline cpu_features detect_cpu_features() noexcept
+{
+    cpu_features f;
+    uint32_t r[4] = {0, 0, 0, 0};
+
+    cpuid(0, 0, r);
+    const uint32_t max_leaf = r[0];
+    // "GenuineIntel" / "AuthenticAMD" (ebx, edx, ecx)
+    const bool intel = r[1] == 0x756E6547u && r[3] == 0x49656E69u && r[2] == 0x6C65746Eu;
+    const bool amd = r[1] == 0x68747541u && r[3] == 0x69746E65u && r[2] == 0x444D4163u;
+    // "HygonGenuine": núcleos derivados de Zen 1
+    const bool hygon = r[1] == 0x6F677948u && r[3] == 0x6E65476Eu && r[2] == 0x656E6975u;
+    if (max_leaf < 1) {
+        return f;
+    }
+
+    cpuid(1, 0, r);
+    const uint32_t eax1 = r[0];
+    const uint32_t ecx1 = r[2];
+    const uint32_t edx1 = r[3];
+    f.sse2 = (edx1 >> 26) & 1;
+    f.sse41 = (ecx1 >> 19) & 1;
+    f.sse42 = (ecx1 >> 20) & 1;
+    f.popcnt = (ecx1 >> 23) & 1;
+    f.pclmul = (ecx1 >> 1) & 1;
+    f.cx16 = (ecx1 >> 13) & 1;
+
+    // AVX/AVX-512 requieren que el SO guarde el estado extendido (OSXSAVE + XCR0)
+    const bool osxsave = (ecx1 >> 27) & 1;
+    const uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+    const bool os_ymm = (xcr0 & 0x6) == 0x6;    // XMM + YMM
+    const bool os_zmm = (xcr0 & 0xE6) == 0xE6;  // + opmask + ZMM
+
+    // Intel y AMD documentan como atómicos los accesos alineados de 16 bytes
+    // (VMOVDQA y similares) en procesadores con AVX
+    f.atomic_vmov16 = (intel || amd) && os_ymm && ((ecx1 >> 28) & 1);
+
+    if (max_leaf >= 7) {
+        cpuid(7, 0, r);
+        const uint32_t ebx7 = r[1];
+        const uint32_t ecx7 = r[2];
+        f.avx2 = os_ymm && ((ebx7 >> 5) & 1);
+        f.bmi2 = (ebx7 >> 8) & 1;
+        // Familia efectiva: base + extendida cuando la base es 0xF. Zen 3 es 0x19;
+        // hasta Zen 2 (0x17) PDEP/PEXT son microcódigo (~250 ciclos según la máscara)
+        const uint32_t base_family = (eax1 >> 8) & 0xF;
+        const uint32_t family =
+            base_family == 0xF ? base_family + ((eax1 >> 20) & 0xFF) : base_family;
+        f.fast_pdep = f.bmi2 && !hygon && !(amd && family < 0x19);
+        f.avx512f = os_zmm && ((ebx7 >> 16) & 1);
+        f.avx512bw = f.avx512f && ((ebx7 >> 30) & 1);
+        f.avx512vl = f.avx512f && ((ebx7 >> 31) & 1);
+        f.avx512cd = f.avx512f && ((ebx7 >> 28) & 1);
+        f.avx512_vpopcntdq = f.avx512f && ((ecx7 >> 14) & 1);
+        f.vpclmulqdq = os_ymm && ((ecx7 >> 10) & 1);
+    }
+
+    cpuid(0x80000000u, 0, r);
+    if (r[0] >= 0x80000001u) {
+        cpuid(0x80000001u, 0, r);
+        f.lzcnt = (r[2] >> 5) & 1;
+    }
+    return f;
+}
+
+#else
+
+inline cpu_features detect_cpu_features() noexcept
+{
+    return cpu_features{};
+}
+
+#endif // INTRINSICS_HAS_X86_SIMD
+
+} // namespace detail
+
+/**
+ * @brief Extensiones de la CPU actual (detectadas una sola vez)
+ */
+inline const cpu_features& cpu() noexcept
+{
+    static const cpu_features features = detail::detect_cpu_features();
+    return features;
+}
+
+/**
+ * @brief Mejor nivel SIMD disponible para kernels de 64 bits por carril
+ */
+inline simd_level best_simd_level() noexcept
+{
+    const cpu_features& f = cpu();
+    if (f.avx512f) {
+        return simd_level::avx512;
+    }
+    if (f.avx2) {
+        return simd_level::avx2;
+    }
+    return simd_level::scalar;
+}
+
+namespace detail
+{
+
+inline std::atomic<int>& forced_simd_level() noexcept
+{
+    static std::atomic<int> level{-1};
+    return level;
+}
+
+} // namespace detail
+
+/**
+ * @brief Nivel SIMD que usan los kernels con despacho en runtime
+ *
+ * Es best_simd_level() salvo que se haya forzado otro con force_simd_level().
+ */
+inline simd_level active_simd_level() noexcept
+{
+    const int forced = detail::forced_simd_level().load(std::memory_order_relaxed);
+    return forced >= 0 ? static_cast<simd_level>(forced) : best_simd_level();
+}
+
+/**
+ * @brief Fuerza un nivel SIMD (pruebas y benchmarks); se limita a lo que soporta la CPU
+ * @note Es global para todo el proceso
+ */
+inline void force_simd_level(simd_level level) noexcept
+{
+    const int best = static_cast<int>(best_simd_level());
+    const int wanted = static_cast<int>(level);
+    detail::forced_simd_level().store(wanted < best ? wanted : best, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Vuelve a la selección automática del nivel SIMD
+ */
+inline void reset_simd_level() noexcept
+{
+    detail::forced_simd_level().store(-1, std::memory_order_relaxed);
+}
+
+} // namespace intrinsics
+
+#endif // INTRINSICS_CPU_FEATURES_HPP
@@ -0,0 +1,449 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ */
+
+/**
+ * @file simd_operations.hpp
+ * @brief Operaciones de 128 bits por carril sobre registros AVX2 / AVX-512
+ *
+ * Un valor de 128 bits se representa como dos registros paralelos: uno con
+ * las mitades altas y otro con las bajas (4 valores por par AVX2, 8 por par
+ * AVX-512). Estas primitivas son agnósticas al tipo y las comparten los
+ * kernels SoA (uint128_soa.hpp) y AoS (uint128_simd.hpp).
+ *
+ * Cada función lleva su propio atributo target (ver cpu_features.hpp); sólo
+ * deben llamarse desde funciones con el mismo target o superior y tras
+ * comprobar intrinsics::cpu() en tiempo de ejecución.
+ */
+
+#ifndef INTRINSICS_SIMD_OPERATIONS_HPP
+#define INTRINSICS_SIMD_OPERATIONS_HPP
+
+#include "compiler_detection.hpp"
+#include "cpu_features.hpp"
+#include <cstdint>
+
+#if INTRINSICS_ARCH_X86_64 && INTRINSICS_HAS_X86_SIMD
+#define INTRINSICS_HAS_SIMD_128_LANES 1
+#else
+#define INTRINSICS_HAS_SIMD_128_LANES 0
+#endif
+
+#if INTRINSICS_HAS_SIMD_128_LANES
+
+namespace intrinsics
+{
+namespace simd
+{
+
+// ============================================================================
+// AVX2 - 4 valores de 128 bits por par de registros
+// ============================================================================
+
+namespace avx2
+{
+
+/**
+ * @brief Comparación sin signo a < b por carril de 64 bits (AVX2 sólo tiene cmpgt con signo)
+ * @return Carril a todo unos donde a < b
+ */
+INTRINSICS_TARGET("avx2") inline __m256i lt_epu64(__m256i a, __m256i b) noexcept
+{
+    const __m256i sign = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+}
+
+/**
+ * @brief (rhi:rlo) = (ahi:alo) + (bhi:blo) con acarreo de la mitad baja a la alta
+ */
+INTRINSICS_TARGET("avx2")
+inline void add128(__m256i ahi, __m256i alo, __m256i bhi, __m256i blo, __m256i& rhi,
+                   __m256i& rlo) noexcept
+{
+    rlo = _mm256_add_epi64(alo, blo);
+    const __m256i carry = lt_epu64(rlo, alo); // -1 donde hubo acarreo
+    rhi = _mm256_sub_epi64(_mm256_add_epi64(ahi, bhi), carry);
+}
+
+/**
+ * @brief (rhi:rlo) = (ahi:alo) - (bhi:blo) con préstamo de la mitad baja a la alta
+ */
+INTRINSICS_TARGET("avx2")
+inline void sub128(__m256i ahi, __m256i alo, __m256i bhi, __m256i blo, __m256i& rhi,
+                   __m256i& rlo) noexcept
+{
+    const __m256i borrow = lt_epu64(alo, blo); // -1 donde hubo préstamo
+    rlo = _mm256_sub_epi64(alo, blo);
+    rhi = _mm256_add_epi64(_mm256_sub_epi64(ahi, bhi), borrow);
+}
+
+/**
+ * @brief Máscara (todo unos por carril) de a < b en 128 bits sin signo
+ */
+INTRINSICS_TARGET("avx2")
+inline __m256i lt128(__m256i ahi, __m256i alo, __m256i bhi, __m256i blo) noexcept
+{
+    const __m256i hi_lt = lt_epu64(ahi, bhi);
+    const __m256i hi_eq = _mm256_cmpeq_epi64(ahi, bhi);
+    return _mm256_or_si256(hi_lt, _mm256_and_si256(hi_eq, lt_epu64(alo, blo)));
+}
+
+/**
+ * @brief Máscara (todo unos por carril) de a == b en 128 bits
+ */
+INTRINSICS_TARGET("avx2")
+inline __m256i eq128(__m256i ahi, __m256i alo, __m256i bhi, __m256i blo) noexcept
+{
+    return _mm256_and_si256(_mm256_cmpeq_epi64(ahi, bhi), _mm256_cmpeq_epi64(alo, blo));
+}
+
+/**
+ * @brief Desplazamiento lógico a la izquierda de 128 bits por carril
+ * @param n Desplazamiento común, 0 <= n < 128
+ *
+ * vpsllq/vpsrlq devuelven 0 para desplazamientos >= 64, así que n == 0 no
+ * necesita caso especial.
+ */
+INTRINSICS_TARGET("avx2")
+inline void shl128(__m256i hi, __m256i lo, unsigned n, __m256i& rhi, __m256i& rlo) noexcept
+{
+    if (n < 64) {
+        const __m128i s = _mm_cvtsi64_si128(static_cast<long long>(n));
+        const __m128i r = _mm_cvtsi64_si128(static_cast<long long>(64 - n));
+        rhi = _mm256_or_si256(_mm256_sll_epi64(hi, s), _mm256_srl_epi64(lo, r));
+        rlo = _mm256_sll_epi64(lo, s);
+    } else {
+        rhi = _mm256_sll_epi64(lo, _mm_cvtsi64_si128(static_cast<long long>(n - 64)));
+        rlo = _mm256_setzero_si256();
+    }
+}
+
+/**
+ * @brief Desplazamiento lógico a la derecha de 128 bits por carril
+ * @param n Desplazamiento común, 0 <= n < 128
+ */
+INTRINSICS_TARGET("avx2")
+inline void shr128(__m256i hi, __m256i lo, unsigned n, __m256i& rhi, __m256i& rlo) noexcept
+{
+    if (n < 64) {
+        const __m128i s = _mm_cvtsi64_si128(static_cast<long long>(n));
+        const __m128i l = _mm_cvtsi64_si128(static_cast<long long>(64 - n));
+        rlo = _mm256_or_si256(_mm256_srl_epi64(lo, s), _mm256_sll_epi64(hi, l));
+        rhi = _mm256_srl_epi64(hi, s);
+    } else {
+        rlo = _mm256_srl_epi64(hi, _mm_cvtsi64_si128(static_cast<long long>(n - 64)));
+        rhi = _mm256_setzero_si256();
+    }
+}
+
+/**
+ * @brief Producto completo 64x64 -> 128 bits por carril (a partir de vpmuludq 32x32)
+ */
+INTRINSICS_TARGET("avx2")
+inline void mul64x64(__m256i a, __m256i b, __m256i& hi, __m256i& lo) noexcept
+{
+    const __m256i mask32 = _mm256_set1_epi64x(0xffffffffLL);
+    const __m256i a1 = _mm256_srli_epi64(a, 32);
+    const __m256i b1 = _mm256_srli_epi64(b, 32);
+    const __m256i p00 = _mm256_mul_epu32(a, b);
+    const __m256i p01 = _mm256_mul_epu32(a, b1);
+    const __m256i p10 = _mm256_mul_epu32(a1, b);
+    const __m256i p11 = _mm256_mul_epu32(a1, b1);
+    // Columna media: cabe en 34 bits, su acarreo pasa a la parte alta
+    const __m256i mid = _mm256_add_epi64(_mm256_add_epi64(_mm256_srli_epi64(p00, 32),
+                                                          _mm256_and_si256(p01, mask32)),
+                                         _mm256_and_si256(p10, mask32));
+    lo = _mm256_or_si256(_mm256_slli_epi64(mid, 32), _mm256_and_si256(p00, mask32));
+    hi = _mm256_add_epi64(_mm256_add_epi64(p11, _mm256_srli_epi64(p01, 32)),
+                          _mm256_add_epi64(_mm256_srli_epi64(p10, 32), _mm256_srli_epi64(mid, 32)));
+}
+
+/**
+ * @brief 64 bits bajos de a * b por carril (AVX2 no tiene vpmullq)
+ */
+INTRINSICS_TARGET("avx2") inline __m256i mullo64(__m256i a, __m256i b) noexcept
+{
+    const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)),
+                                           _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b));
+    return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+}
+
+/**
+ * @brief (rhi:rlo) = 128 bits bajos de (ahi:alo) * (bhi:blo)
+ */
+INTRINSICS_TARGET("avx2")
+inline void mul128_lo(__m256i ahi, __m256i alo, __m256i bhi, __m256i blo, __m256i& rhi,
+                      __m256i& rlo) noexcept
+{
+    __m256i h;
+    mul64x64(alo, blo, h, rlo);
+    rhi = _mm256_add_epi64(h, _mm256_add_epi64(mullo64(ahi, blo), mullo64(alo, bhi)));
+}
+
+/**
+ * @brief popcount por carril de 64 bits (tabla de nibbles con vpshufb + vpsadbw)
+ */
+INTRINSICS_TARGET("avx2") inline __m256i popcount_epi64(__m256i v) noexcept
+{
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1,
+                                         2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    const __m256i lo = _mm256_and_si256(v, low_mask);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    const __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo), _mm256_shuffle_epi8(lut, hi));
+    return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+}
+
+/**
+ * @brief Sumador con acarreo guardado bit a bit: a + b + c = 2 * h + l
+ */
+INTRINSICS_TARGET("avx2")
+inline void csa(__m256i& h, __m256i& l, __m256i a, __m256i b, __m256i c) noexcept
+{
+    const __m256i u = _mm256_xor_si256(a, b);
+    h = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+    l = _mm256_xor_si256(u, c);
+}
+
+/**
+ * @brief popcount total de `blocks` bloques de 16 registros (512 bytes)
+ *
+ * Harley-Seal (Muła, Kurz y Lemire): un árbol de CSA reduce cada bloque a un
+ * registro de peso 16 y solo ese pasa por popcount_epi64; unos, doses,
+ * cuatros y ochos se cuentan una vez al final. Unas 3 veces menos vpshufb
+ * que aplicar popcount_epi64 a cada registro.
+ *
+ * `load(k)` devuelve el registro k (0 .. 16 * blocks - 1); así el mismo árbol
+ * sirve para popcount(a & b) y similares sin materializar el resultado.
+ */
+template <typename Load>
+INTRINSICS_TARGET("avx2") inline uint64_t harley_seal(const Load& load, std::size_t blocks) noexcept
+{
+    std::size_t d = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i total = zero, ones = zero, twos = zero, fours = zero, eights = zero;
+    __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+    for (std::size_t b = 0; b < blocks; ++b, d += 16) {
+        csa(twos_a, ones, ones, load(d + 0), load(d + 1));
+        csa(twos_b, ones, ones, load(d + 2), load(d + 3));
+        csa(fours_a, twos, twos, twos_a, twos_b);
+        csa(twos_a, ones, ones, load(d + 4), load(d + 5));
+        csa(twos_b, ones, ones, load(d + 6), load(d + 7));
+        csa(fours_b, twos, twos, twos_a, twos_b);
+        csa(eights_a, fours, fours, fours_a, fours_b);
+        csa(twos_a, ones, ones, load(d + 8), load(d + 9));
+        csa(twos_b, ones, ones, load(d + 10), load(d + 11));
+        csa(fours_a, twos, twos, twos_a, twos_b);
+        csa(twos_a, ones, ones, load(d + 12), load(d + 13));
+        csa(twos_b, ones, ones, load(d + 14), load(d + 15));
+        csa(fours_b, twos, twos, twos_a, twos_b);
+        csa(eights_b, fours, fours, fours_a, fours_b);
+        csa(sixteens, eights, eights, eights_a, eights_b);
+        total = _mm256_add_epi64(total, popcount_epi64(sixteens));
+    }
+    total = _mm256_slli_epi64(total, 4);
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount_epi64(eights), 3));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount_epi64(fours), 2));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount_epi64(twos), 1));
+    total = _mm256_add_epi64(total, popcount_epi64(ones));
+    const __m128i t = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(t)) + static_cast<uint64_t>(_mm_extract_epi64(t, 1));
+}
+
+/// Carga sin alinear del registro k a partir de p
+struct load_at {
+    const __m256i* p;
+    INTRINSICS_TARGET("avx2") __m256i operator()(std::size_t k) const noexcept
+    {
+        return _mm256_loadu_si256(p + k);
+    }
+};
+
+/// popcount total de `blocks` bloques de 512 bytes a partir de p
+INTRINSICS_TARGET("avx2") inline uint64_t popcount_harley_seal(const void* p, std::size_t blocks) noexcept
+{
+    return harley_seal(load_at{static_cast<const __m256i*>(p)}, blocks);
+}
+
+/**
+ * @brief Carga 4 valores AoS (lo, hi, lo, hi, ...) y los separa en mitades
+ * @param p Puntero a 8 uint64_t consecutivos (sin requisito de alineación)
+ */
+INTRINSICS_TARGET("avx2") inline void load_deinterleave(const void* p, __m256i& hi, __m256i& lo) noexcept
+{
+    const __m256i a = _mm256_loadu_si256(static_cast<const __m256i*>(p));     // l0 h0 l1 h1
+    const __m256i b = _mm256_loadu_si256(static_cast<const __m256i*>(p) + 1); // l2 h2 l3 h3
+    // unpack trabaja por mitades de 128 bits: [l0 l2 | l1 l3] -> permutar a [l0 l1 l2 l3]
+    lo = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xD8);
+    hi = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), 0xD8);
+}
+
+/**
+ * @brief Inversa de load_deinterleave: escribe 4 valores en formato AoS
+ */
+INTRINSICS_TARGET("avx2") inline void interleave_store(void* p, __m256i hi, __m256i lo) noexcept
+{
+    const __m256i l = _mm256_permute4x64_epi64(lo, 0xD8); // l0 l2 l1 l3
+    const __m256i h = _mm256_permute4x64_epi64(hi, 0xD8); // h0 h2 h1 h3
+    _mm256_storeu_si256(static_cast<__m256i*>(p), _mm256_unpacklo_epi64(l, h));     // l0 h0 l1 h1
+    _mm256_storeu_si256(static_cast<__m256i*>(p) + 1, _mm256_unpackhi_epi64(l, h)); // l2 h2 l3 h3
+}
+
+} // namespace avx2
+
+// ============================================================================
+// AVX-512 - 8 valores de 128 bits por par de registros
+// ============================================================================
+
+// GCC 12 avisa de falsos "__Y is used uninitialized" dentro de avx512fintrin.h
+// (variables autoinicializadas de _mm512_undefined_*) al inlinear estos kernels
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace avx512
+{
+
+INTRINSICS_TARGET("avx512f")
+inline void add128(__m512i ahi, __m512i alo, __m512i bhi, __m512i blo, __m512i& rhi,
+                   __m512i& rlo) noexcept
+{
+    rlo = _mm512_add_epi64(alo, blo);
+    const __mmask8 carry = _mm512_cmplt_epu64_mask(rlo, alo);
+    const __m512i sum_hi = _mm512_add_epi64(ahi, bhi);
+    rhi = _mm512_mask_add_epi64(sum_hi, carry, sum_hi, _mm512_set1_epi64(1));
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void sub128(__m512i ahi, __m512i alo, __m512i bhi, __m512i blo, __m512i& rhi,
+                   __m512i& rlo) noexcept
+{
+    const __mmask8 borrow = _mm512_cmplt_epu64_mask(alo, blo);
+    rlo = _mm512_sub_epi64(alo, blo);
+    const __m512i diff_hi = _mm512_sub_epi64(ahi, bhi);
+    rhi = _mm512_mask_sub_epi64(diff_hi, borrow, diff_hi, _mm512_set1_epi64(1));
+}
+
+INTRINSICS_TARGET("avx512f")
+inline __mmask8 lt128(__m512i ahi, __m512i alo, __m512i bhi, __m512i blo) noexcept
+{
+    const __mmask8 hi_lt = _mm512_cmplt_epu64_mask(ahi, bhi);
+    const __mmask8 hi_eq = _mm512_cmpeq_epu64_mask(ahi, bhi);
+    return static_cast<__mmask8>(hi_lt | (hi_eq & _mm512_cmplt_epu64_mask(alo, blo)));
+}
+
+INTRINSICS_TARGET("avx512f")
+inline __mmask8 eq128(__m512i ahi, __m512i alo, __m512i bhi, __m512i blo) noexcept
+{
+    return static_cast<__mmask8>(_mm512_cmpeq_epu64_mask(ahi, bhi) &
+                                 _mm512_cmpeq_epu64_mask(alo, blo));
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void shl128(__m512i hi, __m512i lo, unsigned n, __m512i& rhi, __m512i& rlo) noexcept
+{
+    if (n < 64) {
+        const __m128i s = _mm_cvtsi64_si128(static_cast<long long>(n));
+        const __m128i r = _mm_cvtsi64_si128(static_cast<long long>(64 - n));
+        rhi = _mm512_or_si512(_mm512_sll_epi64(hi, s), _mm512_srl_epi64(lo, r));
+        rlo = _mm512_sll_epi64(lo, s);
+    } else {
+        rhi = _mm512_sll_epi64(lo, _mm_cvtsi64_si128(static_cast<long long>(n - 64)));
+        rlo = _mm512_setzero_si512();
+    }
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void shr128(__m512i hi, __m512i lo, unsigned n, __m512i& rhi, __m512i& rlo) noexcept
+{
+    if (n < 64) {
+        const __m128i s = _mm_cvtsi64_si128(static_cast<long long>(n));
+        const __m128i l = _mm_cvtsi64_si128(static_cast<long long>(64 - n));
+        rlo = _mm512_or_si512(_mm512_srl_epi64(lo, s), _mm512_sll_epi64(hi, l));
+        rhi = _mm512_srl_epi64(hi, s);
+    } else {
+        rlo = _mm512_srl_epi64(hi, _mm_cvtsi64_si128(static_cast<long long>(n - 64)));
+        rhi = _mm512_setzero_si512();
+    }
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void mul64x64(__m512i a, __m512i b, __m512i& hi, __m512i& lo) noexcept
+{
+    const __m512i mask32 = _mm512_set1_epi64(0xffffffffLL);
+    const __m512i a1 = _mm512_srli_epi64(a, 32);
+    const __m512i b1 = _mm512_srli_epi64(b, 32);
+    const __m512i p00 = _mm512_mul_epu32(a, b);
+    const __m512i p01 = _mm512_mul_epu32(a, b1);
+    const __m512i p10 = _mm512_mul_epu32(a1, b);
+    const __m512i p11 = _mm512_mul_epu32(a1, b1);
+    const __m512i mid = _mm512_add_epi64(_mm512_add_epi64(_mm512_srli_epi64(p00, 32),
+                                                          _mm512_and_si512(p01, mask32)),
+                                         _mm512_and_si512(p10, mask32));
+    lo = _mm512_or_si512(_mm512_slli_epi64(mid, 32), _mm512_and_si512(p00, mask32));
+    hi = _mm512_add_epi64(_mm512_add_epi64(p11, _mm512_srli_epi64(p01, 32)),
+                          _mm512_add_epi64(_mm512_srli_epi64(p10, 32), _mm512_srli_epi64(mid, 32)));
+}
+
+// vpmullq es AVX512DQ; con sólo AVX512F se compone igual que en AVX2
+INTRINSICS_TARGET("avx512f") inline __m512i mullo64(__m512i a, __m512i b) noexcept
+{
+    const __m512i cross = _mm512_add_epi64(_mm512_mul_epu32(a, _mm512_srli_epi64(b, 32)),
+                                           _mm512_mul_epu32(_mm512_srli_epi64(a, 32), b));
+    return _mm512_add_epi64(_mm512_mul_epu32(a, b), _mm512_slli_epi64(cross, 32));
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void mul128_lo(__m512i ahi, __m512i alo, __m512i bhi, __m512i blo, __m512i& rhi,
+                      __m512i& rlo) noexcept
+{
+    __m512i h;
+    mul64x64(alo, blo, h, rlo);
+    rhi = _mm512_add_epi64(h, _mm512_add_epi64(mullo64(ahi, blo), mullo64(alo, bhi)));
+}
+
+/**
+ * @brief popcount por carril con VPOPCNTQ (requiere AVX512_VPOPCNTDQ)
+ */
+INTRINSICS_TARGET("avx512f,avx512vpopcntdq") inline __m512i popcount_epi64(__m512i v) noexcept
+{
+    return _mm512_popcnt_epi64(v);
+}
+
+/**
+ * @brief Carga 8 valores AoS y los separa en mitades altas y bajas
+ */
+INTRINSICS_TARGET("avx512f")
+inline void load_deinterleave(const void* p, __m512i& hi, __m512i& lo) noexcept
+{
+    const __m512i a = _mm512_loadu_si512(p);
+    const __m512i b = _mm512_loadu_si512(static_cast<const __m512i*>(p) + 1);
+    lo = _mm512_permutex2var_epi64(a, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), b);
+    hi = _mm512_permutex2var_epi64(a, _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15), b);
+}
+
+/**
+ * @brief Inversa de load_deinterleave: escribe 8 valores en formato AoS
+ */
+INTRINSICS_TARGET("avx512f") inline void interleave_store(void* p, __m512i hi, __m512i lo) noexcept
+{
+    _mm512_storeu_si512(p,
+                        _mm512_permutex2var_epi64(lo, _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), hi));
+    _mm512_storeu_si512(static_cast<__m512i*>(p) + 1,
+                        _mm512_permutex2var_epi64(lo, _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), hi));
+}
+
+} // namespace avx512
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+} // namespace simd
+} // namespace intrinsics
+
+#endif // INTRINSICS_HAS_SIMD_128_LANES
+
+#endif // INTRINSICS_SIMD_OPERATIONS_HPP
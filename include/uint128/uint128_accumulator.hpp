@@ -0,0 +1,838 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_ACCUMULATOR_HPP
+#define UINT128_ACCUMULATOR_HPP
+
+/**
+ * @file uint128_accumulator.hpp
+ * @brief Acumuladores anchos (192/256/320 bits) para sumas exactas de uint128_t/int128_t
+ *
+ * `nstd::accumulate` y `calculate_stats` trabajan módulo 2^128: con suficientes
+ * elementos grandes la suma da la vuelta sin aviso. Aquí la suma se lleva en
+ * un entero de ancho fijo de 64·Limbs bits (complemento a dos si es con signo):
+ *
+ * | Acumulador            | Uso                              | Exacto hasta      |
+ * |-----------------------|----------------------------------|-------------------|
+ * | accumulator192        | Σx, x uint128_t                  | 2^64 elementos    |
+ * | int_accumulator192    | Σx, x int128_t                   | 2^64 elementos    |
+ * | accumulator320        | Σx·y, Σx² (productos de 256 bits)| 2^64 elementos    |
+ * | int_accumulator320    | Σx·y con signo                   | 2^64 elementos    |
+ *
+ * Funciones:
+ * - accumulate_exact / inner_product_exact / calculate_stats_exact (iteradores y spans)
+ * - Versiones `parallel_*` que reparten el span entre hilos y combinan los parciales
+ * - wide_fraction: media exacta como fracción, convertible a double correctamente redondeado
+ * - exact_stats: min, max, Σx, Σx², media y varianza (poblacional y muestral)
+ *
+ * La suma sobre spans se vectoriza con AVX2/AVX-512 (despacho en runtime):
+ * cada carril acumula mitades bajas y altas en 64 bits y cuenta los acarreos
+ * aparte, de modo que el bucle interno no tiene cadenas de acarreo entre carriles.
+ */
+
+#include "../int128/int128_t.hpp"
+#include "../intrinsics/arithmetic_operations.hpp"
+#include "../intrinsics/cpu_features.hpp"
+#include "../intrinsics/simd_operations.hpp"
+#include "uint128_parallel.hpp"
+#include "uint128_t.hpp"
+#include "uint128_wide.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace nstd
+{
+
+// ============================================================================
+// ACUMULADOR ANCHO
+// ============================================================================
+
+/**
+ * @brief Entero de 64·Limbs bits optimizado para acumular uint128_t/int128_t
+ *
+ * @tparam Limbs Número de palabras de 64 bits (2..8)
+ * @tparam Signed true: complemento a dos, los sumandos son int128_t
+ *
+ * add() son dos sumas con acarreo más la propagación (sin saltos) a los
+ * limbs altos; add_product() suma el producto completo de 256 bits.
+ *
+ * @code{.cpp}
+ * nstd::accumulator192 acc;
+ * for (const auto& x : ledger) acc += x;       // Nunca da la vuelta
+ * if (acc.fits()) total = acc.truncated();     // Cabe en uint128_t
+ * std::cout << acc.to_string() << "\n";        // Decimal exacto
+ * @endcode
+ */
+template <std::size_t Limbs, bool Signed = false> class wide_accumulator
+{
+    static_assert(Limbs >= 2 && Limbs <= 8, "wide_accumulator: 2..8 limbs");
+
+  public:
+    using value_type = std::conditional_t<Signed, int128_t, uint128_t>;
+    using limbs_type = detail::wide::limbs<Limbs>;
+    static constexpr std::size_t limb_count = Limbs;
+    static constexpr std::size_t bits = 64 * Limbs;
+    static constexpr bool is_signed = Signed;
+
+    constexpr wide_accumulator() noexcept = default;
+    constexpr explicit wide_accumulator(const value_type& v) noexcept
+    {
+        add(v);
+    }
+    constexpr explicit wide_accumulator(const limbs_type& raw) noexcept : limb_(raw) {}
+
+    // ------------------------------------------------------------------------
+    // Acumulación
+    // ------------------------------------------------------------------------
+
+    /// Suma un valor de 128 bits (extendido con signo si Signed)
+    constexpr wide_accumulator& add(const value_type& v) noexcept
+    {
+        uint64_t fill = 0;
+        if constexpr (Signed) {
+            fill = (v.high() >> 63) != 0 ? ~uint64_t{0} : 0;
+        }
+        const uint64_t s0 = limb_[0] + v.low();
+        uint64_t c = s0 < v.low() ? 1 : 0;
+        limb_[0] = s0;
+        uint64_t t = v.high() + c;
+        c = t < c ? 1 : 0;
+        limb_[1] += t;
+        c += limb_[1] < t ? 1 : 0;
+        for (std::size_t i = 2; i < Limbs; ++i) {
+            t = fill + c;
+            c = t < c ? 1 : 0;
+            limb_[i] += t;
+            c += limb_[i] < t ? 1 : 0;
+        }
+        return *this;
+    }
+
+    constexpr wide_accumulator& operator+=(const value_type& v) noexcept
+    {
+        return add(v);
+    }
+
+    /// Resta un valor de 128 bits
+    constexpr wide_accumulator& subtract(const value_type& v) noexcept
+    {
+        limbs_type x = extend(v);
+        detail::wide::sub(limb_, x);
+        return *this;
+    }
+
+    constexpr wide_accumulator& operator-=(const value_type& v) noexcept
+    {
+        return subtract(v);
+    }
+
+    /// Suma el producto exacto a·b (256 bits)
+    constexpr wide_accumulator& add_product(const value_type& a, const value_type& b) noexcept
+        requires(Limbs >= 4)
+    {
+        const auto x = detail::wide::magnitude(a);
+        const auto y = detail::wide::magnitude(b);
+        uint64_t p[4];
+        detail::wide::mul_2x2(x, y, p);
+        bool negative = false;
+        if constexpr (Signed) {
+            negative = ((a.high() ^ b.high()) >> 63) != 0;
+        }
+        if (!negative) {
+            uint64_t c = 0;
+            for (std::size_t i = 0; i < 4; ++i) {
+                const uint64_t t = p[i] + c;
+                c = t < c ? 1 : 0;
+                limb_[i] += t;
+                c += limb_[i] < t ? 1 : 0;
+            }
+            detail::wide::add_at(limb_, 4, c);
+        } else {
+            uint64_t borrow = 0;
+            for (std::size_t i = 0; i < 4; ++i) {
+                const uint64_t t = p[i] + borrow;
+                borrow = (t < borrow || limb_[i] < t) ? 1 : 0;
+                limb_[i] -= t;
+            }
+            detail::wide::sub_at(limb_, 4, borrow);
+        }
+        return *this;
+    }
+
+    /// Suma v·2^(64·pos) (bloque de construcción de las reducciones vectoriales)
+    constexpr wide_accumulator& add_at(std::size_t pos, uint64_t v) noexcept
+    {
+        detail::wide::add_at(limb_, pos, v);
+        return *this;
+    }
+
+    /// Resta v·2^(64·pos)
+    constexpr wide_accumulator& sub_at(std::size_t pos, uint64_t v) noexcept
+    {
+        detail::wide::sub_at(limb_, pos, v);
+        return *this;
+    }
+
+    constexpr wide_accumulator& operator+=(const wide_accumulator& other) noexcept
+    {
+        detail::wide::add(limb_, other.limb_);
+        return *this;
+    }
+
+    constexpr wide_accumulator& operator-=(const wide_accumulator& other) noexcept
+    {
+        detail::wide::sub(limb_, other.limb_);
+        return *this;
+    }
+
+    friend constexpr wide_accumulator operator+(wide_accumulator a, const wide_accumulator& b) noexcept
+    {
+        return a += b;
+    }
+
+    friend constexpr wide_accumulator operator-(wide_accumulator a, const wide_accumulator& b) noexcept
+    {
+        return a -= b;
+    }
+
+    friend constexpr bool operator==(const wide_accumulator&, const wide_accumulator&) noexcept = default;
+
+    // ------------------------------------------------------------------------
+    // Consulta
+    // ------------------------------------------------------------------------
+
+    constexpr uint64_t limb(std::size_t i) const noexcept
+    {
+        return limb_[i];
+    }
+
+    constexpr const limbs_type& limbs() const noexcept
+    {
+        return limb_;
+    }
+
+    constexpr bool is_zero() const noexcept
+    {
+        return detail::wide::is_zero(limb_);
+    }
+
+    constexpr bool is_negative() const noexcept
+    {
+        if constexpr (Signed) {
+            return (limb_[Limbs - 1] >> 63) != 0;
+        } else {
+            return false;
+        }
+    }
+
+    /// Valor absoluto como entero sin signo de Limbs palabras
+    constexpr limbs_type magnitude() const noexcept
+    {
+        limbs_type m = limb_;
+        if (is_negative()) {
+            detail::wide::negate(m);
+        }
+        return m;
+    }
+
+    /// ¿Cabe el valor exacto en value_type?
+    constexpr bool fits() const noexcept
+    {
+        const uint64_t fill = is_negative() ? ~uint64_t{0} : 0;
+        for (std::size_t i = 2; i < Limbs; ++i) {
+            if (limb_[i] != fill) {
+                return false;
+            }
+        }
+        if constexpr (Signed) {
+            return (limb_[1] >> 63) == (fill & 1);
+        } else {
+            return true;
+        }
+    }
+
+    /// Los 128 bits bajos (el valor exacto si fits())
+    constexpr value_type truncated() const noexcept
+    {
+        return value_type(limb_[1], limb_[0]);
+    }
+
+    /// Conversión correctamente redondeada a double
+    double to_double() const noexcept
+    {
+        const double m = detail::wide::ratio_to_double(magnitude(), detail::wide::limbs<1>{1});
+        return is_negative() ? -m : m;
+    }
+
+    /// Representación decimal exacta
+    std::string to_string() const
+    {
+        constexpr uint64_t chunk = 10000000000000000000ULL; // 10^19
+        char buf[bits * 30103 / 100000 + 3];               // log10(2) < 0.30103, + signo
+        char* end = buf + sizeof(buf);
+        char* p = end;
+        limbs_type m = magnitude();
+        do {
+            uint64_t r = detail::wide::div_u64(m, chunk);
+            const bool last = detail::wide::is_zero(m);
+            for (int i = 0; i < 19 && (!last || r != 0); ++i) {
+                *--p = static_cast<char>('0' + r % 10);
+                r /= 10;
+            }
+        } while (!detail::wide::is_zero(m));
+        if (p == end) {
+            *--p = '0';
+        }
+        if (is_negative()) {
+            *--p = '-';
+        }
+        return std::string(p, end);
+    }
+
+  private:
+    static constexpr limbs_type extend(const value_type& v) noexcept
+    {
+        limbs_type x{};
+        x[0] = v.low();
+        x[1] = v.high();
+        if constexpr (Signed) {
+            if ((v.high() >> 63) != 0) {
+                for (std::size_t i = 2; i < Limbs; ++i) {
+                    x[i] = ~uint64_t{0};
+                }
+            }
+        }
+        return x;
+    }
+
+    limbs_type limb_{};
+};
+
+using accumulator192 = wide_accumulator<3, false>;
+using accumulator256 = wide_accumulator<4, false>;
+using accumulator320 = wide_accumulator<5, false>;
+using int_accumulator192 = wide_accumulator<3, true>;
+using int_accumulator256 = wide_accumulator<4, true>;
+using int_accumulator320 = wide_accumulator<5, true>;
+
+/**
+ * @brief Tipos de 128 bits con acumuladores exactos
+ */
+template <typename T>
+concept wide_summable = std::same_as<T, uint128_t> || std::same_as<T, int128_t>;
+
+/// Acumulador de sumas exactas para T (192 bits)
+template <wide_summable T> using exact_sum_t = wide_accumulator<3, std::is_same_v<T, int128_t>>;
+
+/// Acumulador de productos exactos para T (320 bits)
+template <wide_summable T> using exact_product_sum_t = wide_accumulator<5, std::is_same_v<T, int128_t>>;
+
+// ============================================================================
+// FRACCIÓN EXACTA (media)
+// ============================================================================
+
+/**
+ * @brief numerator / denominator sin pérdida; to_double() redondea correctamente
+ */
+template <std::size_t Limbs, bool Signed> struct wide_fraction {
+    wide_accumulator<Limbs, Signed> numerator;
+    uint64_t denominator = 1;
+
+    /// Cociente truncado hacia cero
+    constexpr wide_accumulator<Limbs, Signed> quotient() const noexcept
+    {
+        auto m = numerator.magnitude();
+        detail::wide::div_u64(m, denominator);
+        if (numerator.is_negative()) {
+            detail::wide::negate(m);
+        }
+        return wide_accumulator<Limbs, Signed>(m);
+    }
+
+    /// Resto (en valor absoluto) de la división truncada
+    constexpr uint64_t remainder() const noexcept
+    {
+        auto m = numerator.magnitude();
+        return detail::wide::div_u64(m, denominator);
+    }
+
+    double to_double() const noexcept
+    {
+        const double m =
+            detail::wide::ratio_to_double(numerator.magnitude(), detail::wide::limbs<1>{denominator});
+        return numerator.is_negative() ? -m : m;
+    }
+};
+
+// ============================================================================
+// ESTADÍSTICAS EXACTAS
+// ============================================================================
+
+/**
+ * @brief min, max, Σx y Σx² exactos; media y varianza correctamente redondeadas
+ *
+ * Varianza poblacional = (n·Σx² − (Σx)²) / n², evaluada en enteros de 384 bits
+ * y redondeada una sola vez al convertir a double.
+ */
+template <wide_summable T> struct exact_stats {
+    T min_value{};
+    T max_value{};
+    exact_sum_t<T> sum;
+    accumulator320 sum_squares;
+    std::size_t count = 0;
+
+    constexpr void push(const T& value) noexcept
+    {
+        if (count == 0) {
+            min_value = max_value = value;
+        } else {
+            min_value = value < min_value ? value : min_value;
+            max_value = max_value < value ? value : max_value;
+        }
+        sum += value;
+        const auto m = detail::wide::magnitude(value);
+        const uint128_t mag(m[1], m[0]);
+        sum_squares.add_product(mag, mag);
+        ++count;
+    }
+
+    /// Combina estadísticas de dos subrangos
+    constexpr exact_stats& operator+=(const exact_stats& other) noexcept
+    {
+        if (other.count == 0) {
+            return *this;
+        }
+        if (count == 0) {
+            return *this = other;
+        }
+        min_value = other.min_value < min_value ? other.min_value : min_value;
+        max_value = max_value < other.max_value ? other.max_value : max_value;
+        sum += other.sum;
+        sum_squares += other.sum_squares;
+        count += other.count;
+        return *this;
+    }
+
+    constexpr wide_fraction<3, std::is_same_v<T, int128_t>> exact_mean() const noexcept
+    {
+        return {sum, count > 0 ? static_cast<uint64_t>(count) : 1};
+    }
+
+    double mean() const noexcept
+    {
+        return count > 0 ? exact_mean().to_double() : 0.0;
+    }
+
+    /// Varianza poblacional (divisor n)
+    double variance() const noexcept
+    {
+        return dispersion(static_cast<uint64_t>(count));
+    }
+
+    /// Varianza muestral (divisor n − 1)
+    double sample_variance() const noexcept
+    {
+        return dispersion(count > 1 ? static_cast<uint64_t>(count - 1) : 0);
+    }
+
+  private:
+    double dispersion(uint64_t n_minus_ddof) const noexcept
+    {
+        if (count == 0 || n_minus_ddof == 0) {
+            return 0.0;
+        }
+        using detail::wide::limbs;
+        const uint64_t n = static_cast<uint64_t>(count);
+        limbs<6> d = detail::wide::mul(sum_squares.limbs(), limbs<1>{n});
+        const auto s = sum.magnitude();
+        detail::wide::sub(d, detail::wide::mul(s, s));
+        return detail::wide::ratio_to_double(d, detail::wide::mul(limbs<1>{n}, limbs<1>{n_minus_ddof}));
+    }
+};
+
+// ============================================================================
+// REDUCCIÓN VECTORIAL DE SUMAS
+// ============================================================================
+
+namespace detail
+{
+
+/**
+ * @brief Sumas parciales sin cadenas de acarreo largas
+ *
+ * Σx = lo + 2^64·(lo_carry + hi) + 2^128·(hi_carry − negatives)
+ * (negatives sólo cuenta para int128_t: cada valor negativo se sumó como
+ * su patrón de bits sin signo, que excede al valor real en 2^128).
+ */
+struct sum_parts {
+    uint64_t lo = 0;
+    uint64_t lo_carry = 0;
+    uint64_t hi = 0;
+    uint64_t hi_carry = 0;
+    uint64_t negatives = 0;
+
+    constexpr void push(uint64_t l, uint64_t h) noexcept
+    {
+        lo += l;
+        lo_carry += lo < l ? 1 : 0;
+        hi += h;
+        hi_carry += hi < h ? 1 : 0;
+        negatives += h >> 63;
+    }
+
+    template <std::size_t Limbs, bool Signed>
+    constexpr void flush(wide_accumulator<Limbs, Signed>& acc) const noexcept
+    {
+        acc.add_at(0, lo).add_at(1, lo_carry).add_at(1, hi).add_at(2, hi_carry);
+        if constexpr (Signed) {
+            acc.sub_at(2, negatives);
+        }
+    }
+};
+
+/**
+ * @brief Suma de productos de 256 bits con los acarreos contados aparte
+ *
+ * Las cuatro palabras viven en registros dentro del bucle; sólo flush() toca
+ * el acumulador ancho. Σ = w + 2^256·(carry − borrow).
+ */
+struct product_parts {
+    uint64_t w0 = 0, w1 = 0, w2 = 0, w3 = 0;
+    uint64_t carry = 0;
+    uint64_t borrow = 0;
+
+    template <typename T> constexpr void push(const T& a, const T& b) noexcept
+    {
+        uint64_t p[4];
+        wide::mul_2x2(wide::magnitude(a), wide::magnitude(b), p);
+        if constexpr (std::is_same_v<T, int128_t>) {
+            // Sin saltos: un producto negativo se suma como 2^256 − |p| y se
+            // descuenta 2^256 en borrow (si |p| = 0 el acarreo lo compensa)
+            const uint64_t m = 0 - ((a.high() ^ b.high()) >> 63);
+            uint64_t c = m & 1;
+            borrow += c;
+            for (auto& x : p) {
+                x = (x ^ m) + c;
+                c = x < c ? 1 : 0;
+            }
+            carry += c;
+        }
+        w0 += p[0];
+        uint64_t c = w0 < p[0] ? 1 : 0;
+        step(w1, p[1], c);
+        step(w2, p[2], c);
+        step(w3, p[3], c);
+        carry += c;
+    }
+
+    template <std::size_t Limbs, bool Signed>
+    constexpr void flush(wide_accumulator<Limbs, Signed>& acc) const noexcept
+    {
+        acc.add_at(0, w0).add_at(1, w1).add_at(2, w2).add_at(3, w3).add_at(4, carry).sub_at(4, borrow);
+    }
+
+  private:
+    // w + v + c con el acarreo de entrada al final: GCC lo traduce a add/adc sin saltos
+    static constexpr void step(uint64_t& w, uint64_t v, uint64_t& c) noexcept
+    {
+        const uint64_t t = w + v;
+        const uint64_t c1 = t < v ? 1 : 0;
+        w = t + c;
+        c = c1 | (w < t ? 1 : 0);
+    }
+};
+
+#if INTRINSICS_HAS_SIMD_128_LANES
+
+INTRINSICS_TARGET("avx2")
+inline std::size_t sum_parts_avx2(const void* data, std::size_t n, sum_parts& parts) noexcept
+{
+    namespace v = intrinsics::simd::avx2;
+    const auto* p = static_cast<const unsigned char*>(data);
+    __m256i acc_lo = _mm256_setzero_si256(), carry_lo = _mm256_setzero_si256();
+    __m256i acc_hi = _mm256_setzero_si256(), carry_hi = _mm256_setzero_si256();
+    __m256i neg = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i hi, lo;
+        v::load_deinterleave(p + 16 * i, hi, lo);
+        acc_lo = _mm256_add_epi64(acc_lo, lo);
+        carry_lo = _mm256_sub_epi64(carry_lo, v::lt_epu64(acc_lo, lo)); // máscara -1 => +1
+        acc_hi = _mm256_add_epi64(acc_hi, hi);
+        carry_hi = _mm256_sub_epi64(carry_hi, v::lt_epu64(acc_hi, hi));
+        neg = _mm256_add_epi64(neg, _mm256_srli_epi64(hi, 63));
+    }
+    alignas(32) uint64_t l[4], lc[4], h[4], hc[4], ng[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(l), acc_lo);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lc), carry_lo);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(h), acc_hi);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(hc), carry_hi);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ng), neg);
+    for (int k = 0; k < 4; ++k) {
+        parts.lo += l[k];
+        parts.lo_carry += lc[k] + (parts.lo < l[k] ? 1 : 0);
+        parts.hi += h[k];
+        parts.hi_carry += hc[k] + (parts.hi < h[k] ? 1 : 0);
+        parts.negatives += ng[k];
+    }
+    return i;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+INTRINSICS_TARGET("avx512f")
+inline std::size_t sum_parts_avx512(const void* data, std::size_t n, sum_parts& parts) noexcept
+{
+    namespace v = intrinsics::simd::avx512;
+    const auto* p = static_cast<const unsigned char*>(data);
+    const __m512i one = _mm512_set1_epi64(1);
+    __m512i acc_lo = _mm512_setzero_si512(), carry_lo = _mm512_setzero_si512();
+    __m512i acc_hi = _mm512_setzero_si512(), carry_hi = _mm512_setzero_si512();
+    __m512i neg = _mm512_setzero_si512();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i hi, lo;
+        v::load_deinterleave(p + 16 * i, hi, lo);
+        acc_lo = _mm512_add_epi64(acc_lo, lo);
+        carry_lo = _mm512_mask_add_epi64(carry_lo, _mm512_cmplt_epu64_mask(acc_lo, lo), carry_lo, one);
+        acc_hi = _mm512_add_epi64(acc_hi, hi);
+        carry_hi = _mm512_mask_add_epi64(carry_hi, _mm512_cmplt_epu64_mask(acc_hi, hi), carry_hi, one);
+        neg = _mm512_add_epi64(neg, _mm512_srli_epi64(hi, 63));
+    }
+    alignas(64) uint64_t l[8], lc[8], h[8], hc[8], ng[8];
+    _mm512_store_si512(l, acc_lo);
+    _mm512_store_si512(lc, carry_lo);
+    _mm512_store_si512(h, acc_hi);
+    _mm512_store_si512(hc, carry_hi);
+    _mm512_store_si512(ng, neg);
+    for (int k = 0; k < 8; ++k) {
+        parts.lo += l[k];
+        parts.lo_carry += lc[k] + (parts.lo < l[k] ? 1 : 0);
+        parts.hi += h[k];
+        parts.hi_carry += hc[k] + (parts.hi < h[k] ? 1 : 0);
+        parts.negatives += ng[k];
+    }
+    return i;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // INTRINSICS_HAS_SIMD_128_LANES
+
+template <wide_summable T> sum_parts sum_span(std::span<const T> data) noexcept
+{
+    sum_parts parts;
+    std::size_t i = 0;
+#if INTRINSICS_HAS_SIMD_128_LANES
+    switch (intrinsics::active_simd_level()) {
+    case intrinsics::simd_level::avx512:
+        i = sum_parts_avx512(data.data(), data.size(), parts);
+        break;
+    case intrinsics::simd_level::avx2:
+        i = sum_parts_avx2(data.data(), data.size(), parts);
+        break;
+    default:
+        break;
+    }
+#endif
+    for (; i < data.size(); ++i) {
+        parts.push(data[i].low(), data[i].high());
+    }
+    return parts;
+}
+
+} // namespace detail
+
+// ============================================================================
+// API: ACUMULACIÓN EXACTA
+// ============================================================================
+
+/**
+ * @brief Σ[first, last) exacta (sin desbordamiento hasta 2^64 elementos)
+ *
+ * @code{.cpp}
+ * auto total = nstd::accumulate_exact(v.begin(), v.end());
+ * double avg = nstd::wide_fraction<3, false>{total, v.size()}.to_double();
+ * @endcode
+ */
+template <std::input_iterator InputIt>
+    requires wide_summable<std::iter_value_t<InputIt>>
+constexpr exact_sum_t<std::iter_value_t<InputIt>> accumulate_exact(InputIt first, InputIt last)
+{
+    exact_sum_t<std::iter_value_t<InputIt>> acc;
+    for (; first != last; ++first) {
+        acc += *first;
+    }
+    return acc;
+}
+
+/**
+ * @brief Σ exacta sobre memoria contigua, vectorizada con AVX2/AVX-512
+ */
+inline accumulator192 accumulate_exact(std::span<const uint128_t> data) noexcept
+{
+    accumulator192 acc;
+    detail::sum_span(data).flush(acc);
+    return acc;
+}
+
+inline int_accumulator192 accumulate_exact(std::span<const int128_t> data) noexcept
+{
+    int_accumulator192 acc;
+    detail::sum_span(data).flush(acc);
+    return acc;
+}
+
+/**
+ * @brief Σ exacta repartida entre hilos (cada hilo usa la ruta vectorial)
+ *
+ * @code{.cpp}
+ * auto total = nstd::parallel_accumulate_exact(std::span(v), nstd::execution::par(4));
+ * @endcode
+ */
+template <wide_summable T>
+exact_sum_t<T> parallel_accumulate_exact(std::span<const T> data,
+                                         const execution::parallel_policy& policy = execution::par)
+{
+    return parallel_reduce<exact_sum_t<T>>(
+        data.size(), policy,
+        [data](std::size_t b, std::size_t e, std::atomic<bool>&) {
+            return accumulate_exact(data.subspan(b, e - b));
+        },
+        [](exact_sum_t<T> l, const exact_sum_t<T>& r) { return l += r; });
+}
+
+/**
+ * @brief Σ a[i]·b[i] exacta (productos de 256 bits, acumulador de 320)
+ */
+template <std::input_iterator InputIt1, std::input_iterator InputIt2>
+    requires wide_summable<std::iter_value_t<InputIt1>> &&
+             std::same_as<std::iter_value_t<InputIt1>, std::iter_value_t<InputIt2>>
+constexpr exact_product_sum_t<std::iter_value_t<InputIt1>>
+inner_product_exact(InputIt1 first1, InputIt1 last1, InputIt2 first2)
+{
+    detail::product_parts parts;
+    for (; first1 != last1; ++first1, ++first2) {
+        parts.push(*first1, *first2);
+    }
+    exact_product_sum_t<std::iter_value_t<InputIt1>> acc;
+    parts.flush(acc);
+    return acc;
+}
+
+/**
+ * @brief Producto escalar exacto repartido entre hilos
+ * @throws std::invalid_argument si a y b difieren en tamaño
+ */
+template <wide_summable T>
+exact_product_sum_t<T> parallel_inner_product_exact(std::span<const T> a, std::span<const T> b,
+                                                    const execution::parallel_policy& policy = execution::par)
+{
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("parallel_inner_product_exact: sizes differ");
+    }
+    return parallel_reduce<exact_product_sum_t<T>>(
+        a.size(), policy,
+        [a, b](std::size_t first, std::size_t last, std::atomic<bool>&) {
+            return inner_product_exact(a.begin() + first, a.begin() + last, b.begin() + first);
+        },
+        [](exact_product_sum_t<T> l, const exact_product_sum_t<T>& r) { return l += r; });
+}
+
+/**
+ * @brief min, max, Σx, Σx², media y varianza exactas de [first, last)
+ *
+ * @code{.cpp}
+ * auto st = nstd::calculate_stats_exact(v.begin(), v.end());
+ * std::cout << st.sum.to_string() << " " << st.mean() << " " << st.variance();
+ * @endcode
+ */
+template <std::input_iterator InputIt>
+    requires wide_summable<std::iter_value_t<InputIt>>
+constexpr exact_stats<std::iter_value_t<InputIt>> calculate_stats_exact(InputIt first, InputIt last)
+{
+    using T = std::iter_value_t<InputIt>;
+    exact_stats<T> st;
+    if (first == last) {
+        return st;
+    }
+    // Mismo cálculo que exact_stats::push, con las sumas parciales en registros
+    detail::sum_parts sum;
+    detail::product_parts squares;
+    T lo = *first, hi = *first;
+    std::size_t n = 0;
+    for (; first != last; ++first) {
+        const T& v = *first;
+        lo = v < lo ? v : lo;
+        hi = hi < v ? v : hi;
+        sum.push(v.low(), v.high());
+        squares.push(v, v);
+        ++n;
+    }
+    st.min_value = lo;
+    st.max_value = hi;
+    sum.flush(st.sum);
+    squares.flush(st.sum_squares);
+    st.count = n;
+    return st;
+}
+
+/**
+ * @brief calculate_stats_exact repartido entre hilos
+ */
+template <wide_summable T>
+exact_stats<T> parallel_calculate_stats_exact(std::span<const T> data,
+                                              const execution::parallel_policy& policy = execution::par)
+{
+    return parallel_reduce<exact_stats<T>>(
+        data.size(), policy,
+        [data](std::size_t b, std::size_t e, std::atomic<bool>&) {
+            return calculate_stats_exact(data.begin() + b, data.begin() + e);
+        },
+        [](exact_stats<T> l, const exact_stats<T>& r) { return l += r; });
+}
+
+} // namespace nstd
+
+#endif // UINT128_ACCUMULATOR_HPP
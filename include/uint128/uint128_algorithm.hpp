@@ -30,6 +30,7 @@
 #include "uint128_cmath.hpp"
 #include "uint128_concepts.hpp"
 #include "uint128_t.hpp"
+#include "uint128_wide.hpp"
 #include <algorithm>
 #include <functional>
 #include <iterator>
@@ -109,6 +110,32 @@ ForwardIt find_if_uint128(ForwardIt first, ForwardIt last,
     return std::find_if(first, last, pred);
 }
 
+/**
+ * @brief Cuenta los elementos que satisfacen el predicado
+ *
+ * @tparam InputIt Tipo de iterador
+ * @param first Iterador al inicio del rango
+ * @param last Iterador al final del rango
+ * @param pred Predicado a aplicar
+ * @return Numero de elementos para los que pred devuelve true
+ *
+ * @test test_count_if_uint128
+ * @code{.cpp}
+ * // Cuenta los elementos pares
+ * std::vector<uint128_t> vec = {1, 2, 3, 4};
+ * auto n = count_if_uint128(vec.begin(), vec.end(),
+ *     [](const uint128_t& x) { return (x & uint128_t(1)) == uint128_t(0); });
+ * assert(n == 2);
+ * @endcode
+ */
+template <std::input_iterator InputIt>
+std::size_t count_if_uint128(InputIt first, InputIt last,
+                             uint128_concepts::uint128_predicate auto pred)
+    requires std::same_as<typename std::iterator_traits<InputIt>::value_type, uint128_t>
+{
+    return static_cast<std::size_t>(std::count_if(first, last, pred));
+}
+
 // ===============================================================================
 // ALGORITMOS DE TRANSFORMACIoN
 // ===============================================================================
@@ -429,6 +456,9 @@ void generate_geometric_sequence(OutputIt first, std::size_t count, const uint12
 
 /**
  * @brief Estadisticas basicas de un rango de uint128_t
+ *
+ * @note `sum` es modulo 2^128; para sumas que puedan desbordar usar
+ *       calculate_stats_exact() (uint128_accumulator.hpp)
  */
 struct uint128_stats {
     uint128_t min_value;
@@ -436,9 +466,14 @@ struct uint128_stats {
     uint128_t sum;
     std::size_t count;
 
+    /// sum / count correctamente redondeado (los 128 bits de sum)
     double mean() const
     {
-        return count > 0 ? static_cast<double>(static_cast<uint64_t>(sum)) / count : 0.0;
+        if (count == 0) {
+            return 0.0;
+        }
+        namespace w = nstd::detail::wide;
+        return w::ratio_to_double(w::limbs<2>{sum.low(), sum.high()}, w::limbs<1>{count});
     }
 };
 
@@ -0,0 +1,583 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_ATOMIC_HPP
+#define UINT128_ATOMIC_HPP
+
+/**
+ * @file uint128_atomic.hpp
+ * @brief Atómico de 128 bits sin cerrojos para uint128_t e int128_t
+ *
+ * `std::atomic<uint128_t>` en GCC/libstdc++ pasa por libatomic, que suele
+ * informar is_lock_free() == false y serializa con una tabla global de
+ * mutex. `atomic128<T>` emite directamente la instrucción de la plataforma
+ * (ver intrinsics/atomic_operations.hpp):
+ *
+ * - x86-64: `lock cmpxchg16b` (comprobando cx16 en runtime salvo con -mcx16);
+ *   load/store con un único `vmovdqa` en Intel/AMD con AVX
+ * - AArch64: `caspal` con LSE, `ldaxp`/`stlxp` sin LSE
+ * - Resto: fallback explícito con spin-locks por dirección (is_lock_free() == false)
+ *
+ * Las operaciones fetch_* (add, sub, and, or, xor, mul, min, max) son bucles
+ * CAS con espera exponencial (`pause`) configurable con backoff_policy, y
+ * wait()/notify_*() duermen en un futex (Linux) o en std::atomic::wait.
+ *
+ * @code{.cpp}
+ * nstd::atomic_uint128 counter;
+ * counter.fetch_add(uint128_t(1), std::memory_order_relaxed);
+ * counter.fetch_max(uint128_t(42), std::memory_order_relaxed, {.initial_spins = 4});
+ * @endcode
+ */
+
+#include "../int128/int128_t.hpp"
+#include "../intrinsics/atomic_operations.hpp"
+#include "uint128_t.hpp"
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace nstd
+{
+
+/// Tipos que admite atomic128
+template <typename T>
+concept atomic128_value = std::same_as<T, uint128_t> || std::same_as<T, int128_t>;
+
+// =============================================================================
+// ESPERA EXPONENCIAL
+// =============================================================================
+
+/**
+ * @brief Parámetros de la espera tras un CAS fallido
+ *
+ * Tras el k-ésimo fallo se ejecutan min(initial_spins·2^k, max_spins) pausas;
+ * una vez saturado, si yield_when_saturated, se cede además el hilo (útil con
+ * más hilos que núcleos). `{0, 0, false}` desactiva la espera.
+ */
+struct backoff_policy {
+    uint32_t initial_spins = 1;
+    uint32_t max_spins = 1024;
+    bool yield_when_saturated = true;
+};
+
+/// Estado de la espera exponencial de un bucle CAS
+class exponential_backoff
+{
+  public:
+    constexpr explicit exponential_backoff(const backoff_policy& policy = {}) noexcept
+        : policy_(policy), spins_(policy.initial_spins)
+    {
+    }
+
+    void operator()() noexcept
+    {
+        for (uint32_t i = 0; i < spins_; ++i) {
+            intrinsics::cpu_relax();
+        }
+        if (spins_ < policy_.max_spins) {
+            spins_ = std::min(policy_.max_spins, spins_ ? spins_ * 2 : 1u);
+        } else if (policy_.yield_when_saturated) {
+            std::this_thread::yield();
+        }
+    }
+
+    void reset() noexcept
+    {
+        spins_ = policy_.initial_spins;
+    }
+
+  private:
+    backoff_policy policy_;
+    uint32_t spins_;
+};
+
+namespace detail
+{
+
+// =============================================================================
+// wait/notify: tabla de épocas por dirección
+// =============================================================================
+//
+// Un futex sólo compara 32 bits y atomic128 no tiene espacio propio para uno,
+// así que cada dirección se asocia a una época de 32 bits en una tabla global.
+// notify incrementa la época *después* de publicar el valor; wait lee la época
+// *antes* de comprobar el valor, de modo que un notify entre la comprobación y
+// la llamada al futex hace fallar la espera (EAGAIN) en lugar de perderse.
+
+struct alignas(64) atomic128_waiter {
+    std::atomic<uint32_t> epoch{0};
+    std::atomic<uint32_t> waiters{0};
+};
+
+inline atomic128_waiter& waiter_for(const void* p) noexcept
+{
+    static atomic128_waiter table[64];
+    return table[(reinterpret_cast<std::uintptr_t>(p) >> 4) % 64];
+}
+
+inline void epoch_wait(std::atomic<uint32_t>& epoch, uint32_t seen) noexcept
+{
+#if defined(__linux__)
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAIT_PRIVATE, seen, nullptr,
+            nullptr, 0);
+#else
+    epoch.wait(seen, std::memory_order_seq_cst);
+#endif
+}
+
+inline void epoch_notify_all(std::atomic<uint32_t>& epoch) noexcept
+{
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr,
+            nullptr, 0);
+#else
+    epoch.notify_all();
+#endif
+}
+
+// =============================================================================
+// Operaciones comunes
+// =============================================================================
+
+/// Operaciones comunes de atomic128 y atomic_ref128 sobre dos palabras de 64 bits
+template <atomic128_value T, typename Derived> class atomic128_ops
+{
+  public:
+    using value_type = T;
+
+    /// true si la plataforma garantiza CAS nativo sin comprobar la CPU
+    static constexpr bool is_always_lock_free = INTRINSICS_CAS128_ALWAYS_NATIVE != 0;
+    static constexpr std::size_t required_alignment = intrinsics::cas128_alignment;
+
+    /// true si las operaciones no usan el fallback con cerrojos
+    bool is_lock_free() const noexcept
+    {
+        return intrinsics::cas128_is_lock_free();
+    }
+
+    T load(std::memory_order = std::memory_order_seq_cst) const noexcept
+    {
+        uint64_t lo, hi;
+        intrinsics::load128(words(), lo, hi);
+        return T(hi, lo);
+    }
+
+    operator T() const noexcept
+    {
+        return load();
+    }
+
+    void store(T value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        intrinsics::store128(words(), value.low(), value.high(), order);
+    }
+
+    T exchange(T value, std::memory_order = std::memory_order_seq_cst) noexcept
+    {
+        uint64_t lo, hi;
+        intrinsics::exchange128(words(), value.low(), value.high(), lo, hi);
+        return T(hi, lo);
+    }
+
+    /**
+     * @brief CAS fuerte: si *this == expected escribe desired; si no, expected = *this
+     */
+    bool compare_exchange_strong(T& expected, T desired, std::memory_order,
+                                 std::memory_order) noexcept
+    {
+        uint64_t lo = expected.low(), hi = expected.high();
+        const bool ok = intrinsics::cas128(words(), lo, hi, desired.low(), desired.high());
+        if (!ok) {
+            expected = T(hi, lo);
+        }
+        return ok;
+    }
+
+    bool compare_exchange_strong(T& expected, T desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return compare_exchange_strong(expected, desired, order, order);
+    }
+
+    /// Las instrucciones usadas no fallan espuriamente: igual que la versión fuerte
+    bool compare_exchange_weak(T& expected, T desired, std::memory_order success,
+                               std::memory_order failure) noexcept
+    {
+        return compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    bool compare_exchange_weak(T& expected, T desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return compare_exchange_strong(expected, desired, order, order);
+    }
+
+    // -------------------------------------------------------------------------
+    // Lectura-modificación-escritura
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Sustituye el valor v por f(v) con un bucle CAS; devuelve v
+     *
+     * Un CAS fallido ya devuelve el valor actual, así que cada reintento cuesta
+     * una sola instrucción atómica más la espera indicada por @p policy.
+     */
+    template <typename F>
+    T fetch_update(F f, std::memory_order order = std::memory_order_seq_cst,
+                   const backoff_policy& policy = {}) noexcept
+    {
+        T cur = load(std::memory_order_relaxed);
+        exponential_backoff backoff(policy);
+        while (!compare_exchange_weak(cur, f(cur), order, std::memory_order_relaxed)) {
+            backoff();
+        }
+        return cur;
+    }
+
+    T fetch_add(T arg, std::memory_order order = std::memory_order_seq_cst,
+                const backoff_policy& policy = {}) noexcept
+    {
+        return fetch_update([arg](T v) { return v + arg; }, order, policy);
+    }
+
+    T fetch_sub(T arg, std::memory_order order = std::memory_order_seq_cst,
+                const backoff_policy& policy = {}) noexcept
+    {
+        return fetch_update([arg](T v) { return v - arg; }, order, policy);
+    }
+
+    T fetch_and(T arg, std::memory_order order = std::memory_order_seq_cst,
+                const backoff_policy& policy = {}) noexcept
+    {
+        return fetch_update([arg](T v) { return v & arg; }, order, policy);
+    }
+
+    T fetch_or(T arg, std::memory_order order = std::memory_order_seq_cst,
+               const backoff_policy& policy = {}) noexcept
+    {
+        return fetch_update([arg](T v) { return v | arg; }, order, policy);
+    }
+
+    T fetch_xor(T arg, std::memory_order order = std::memory_order_seq_cst,
+                const backoff_policy& policy = {}) noexcept
+    {
+        return fetch_update([arg](T v) { return v ^ arg; }, order, policy);
+    }
+
+    /// Multiplicación módulo 2^128 (con signo: complemento a dos)
+    T fetch_mul(T arg, std::memory_order order = std::memory_order_seq_cst,
+                const backoff_policy& policy = {}) noexcept
+    {
+        return fetch_update([arg](T v) { return v * arg; }, order, policy);
+    }
+
+    /// Si el valor ya es <= arg no se escribe nada
+    T fetch_min(T arg, std::memory_order order = std::memory_order_seq_cst,
+                const backoff_policy& policy = {}) noexcept
+    {
+        T cur = load(std::memory_order_relaxed);
+        exponential_backoff backoff(policy);
+        while (arg < cur && !compare_exchange_weak(cur, arg, order, std::memory_order_relaxed)) {
+            backoff();
+        }
+        return cur;
+    }
+
+    /// Si el valor ya es >= arg no se escribe nada
+    T fetch_max(T arg, std::memory_order order = std::memory_order_seq_cst,
+                const backoff_policy& policy = {}) noexcept
+    {
+        T cur = load(std::memory_order_relaxed);
+        exponential_backoff backoff(policy);
+        while (cur < arg && !compare_exchange_weak(cur, arg, order, std::memory_order_relaxed)) {
+            backoff();
+        }
+        return cur;
+    }
+
+    T operator++() noexcept
+    {
+        return fetch_add(T(1)) + T(1);
+    }
+    T operator++(int) noexcept
+    {
+        return fetch_add(T(1));
+    }
+    T operator--() noexcept
+    {
+        return fetch_sub(T(1)) - T(1);
+    }
+    T operator--(int) noexcept
+    {
+        return fetch_sub(T(1));
+    }
+    T operator+=(T arg) noexcept
+    {
+        return fetch_add(arg) + arg;
+    }
+    T operator-=(T arg) noexcept
+    {
+        return fetch_sub(arg) - arg;
+    }
+    T operator&=(T arg) noexcept
+    {
+        return fetch_and(arg) & arg;
+    }
+    T operator|=(T arg) noexcept
+    {
+        return fetch_or(arg) | arg;
+    }
+    T operator^=(T arg) noexcept
+    {
+        return fetch_xor(arg) ^ arg;
+    }
+
+    // -------------------------------------------------------------------------
+    // Espera bloqueante
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Bloquea mientras el valor sea igual a @p old
+     *
+     * Como std::atomic::wait, sólo garantiza despertar tras un notify_*() que
+     * siga a la modificación; puede volver antes si el valor cambió.
+     */
+    void wait(T old, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        auto& w = waiter_for(words());
+        exponential_backoff spin({1, 64, false});
+        for (int i = 0; i < 8; ++i) { // Espera activa breve antes de dormir
+            if (load(order) != old) {
+                return;
+            }
+            spin();
+        }
+        w.waiters.fetch_add(1, std::memory_order_seq_cst);
+        for (;;) {
+            const uint32_t seen = w.epoch.load(std::memory_order_seq_cst);
+            if (load(order) != old) {
+                break;
+            }
+            epoch_wait(w.epoch, seen);
+        }
+        w.waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Despierta a los hilos bloqueados en wait()
+     *
+     * Varias direcciones comparten entrada en la tabla de épocas: despertar a
+     * uno solo podría elegir un hilo que espera en otro atómico, así que
+     * notify_one() despierta a todos los de la entrada (los demás reevalúan su
+     * valor y vuelven a dormir). Sin hilos esperando no hay llamada al sistema.
+     */
+    void notify_one() noexcept
+    {
+        notify_all();
+    }
+
+    void notify_all() noexcept
+    {
+        auto& w = waiter_for(words());
+        w.epoch.fetch_add(1, std::memory_order_seq_cst);
+        if (w.waiters.load(std::memory_order_seq_cst) != 0) {
+            epoch_notify_all(w.epoch);
+        }
+    }
+
+  private:
+    uint64_t* words() const noexcept
+    {
+        return static_cast<const Derived*>(this)->storage();
+    }
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Atómico de 128 bits con la interfaz de std::atomic
+ *
+ * Todas las operaciones aceptan cualquier std::memory_order; la instrucción
+ * usada es al menos tan fuerte como la pedida (en x86 los CAS son siempre
+ * seq_cst, en AArch64 acquire-release).
+ */
+template <atomic128_value T> class atomic128 : public detail::atomic128_ops<T, atomic128<T>>
+{
+  public:
+    constexpr atomic128() noexcept = default;
+    constexpr atomic128(T value) noexcept : words_{value.low(), value.high()} {}
+
+    atomic128(const atomic128&) = delete;
+    atomic128& operator=(const atomic128&) = delete;
+
+    T operator=(T value) noexcept
+    {
+        this->store(value);
+        return value;
+    }
+
+  private:
+    friend class detail::atomic128_ops<T, atomic128<T>>;
+
+    uint64_t* storage() const noexcept
+    {
+        return words_;
+    }
+
+    // mutable: sin carga nativa de 16 bytes, load() es un CAS que escribe el mismo valor
+    alignas(intrinsics::cas128_alignment) mutable uint64_t words_[2] = {0, 0};
+};
+
+/**
+ * @brief Operaciones atómicas de 128 bits sobre un objeto existente (como std::atomic_ref)
+ *
+ * Para tablas de uint128_t / int128_t en memoria compartida que no pueden
+ * envolverse elemento a elemento. Mientras exista algún atomic_ref128 sobre
+ * un objeto, todos los accesos concurrentes a él deben hacerse con
+ * atomic_ref128. Las operaciones son las de atomic128 (load, store, exchange,
+ * compare_exchange_*, fetch_*, wait/notify).
+ *
+ * @pre El objeto está alineado a required_alignment (16) bytes: alignof(uint128_t)
+ *      es 8, así que los arrays deben declararse `alignas(16)`. En x86-64
+ *      cmpxchg16b sobre una dirección no alineada provoca una excepción.
+ *
+ * @code{.cpp}
+ * alignas(16) uint128_t histogram[64] = {};
+ * nstd::atomic_ref128<uint128_t>(histogram[bucket]).fetch_add(uint128_t(1));
+ * @endcode
+ */
+template <atomic128_value T> class atomic_ref128 : public detail::atomic128_ops<T, atomic_ref128<T>>
+{
+  public:
+    explicit atomic_ref128(T& object) noexcept
+        : words_(reinterpret_cast<uint64_t*>(std::addressof(object)))
+    {
+    }
+
+    atomic_ref128(const atomic_ref128&) noexcept = default;
+    atomic_ref128& operator=(const atomic_ref128&) = delete;
+
+    T operator=(T value) noexcept
+    {
+        this->store(value);
+        return value;
+    }
+
+    /// true si @p object cumple la precondición de alineación
+    static bool is_suitably_aligned(const T& object) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(std::addressof(object)) %
+                   intrinsics::cas128_alignment ==
+               0;
+    }
+
+  private:
+    friend class detail::atomic128_ops<T, atomic_ref128<T>>;
+
+    uint64_t* storage() const noexcept
+    {
+        return words_;
+    }
+
+    uint64_t* words_;
+};
+
+using atomic_uint128 = atomic128<uint128_t>;
+using atomic_int128 = atomic128<int128_t>;
+
+static_assert(sizeof(atomic_uint128) == 16 && alignof(atomic_uint128) == 16);
+// atomic_ref128 trata el objeto como {low, high} en dos palabras de 64 bits
+static_assert(sizeof(uint128_t) == 16 && sizeof(int128_t) == 16);
+static_assert(std::is_standard_layout_v<uint128_t> && std::is_standard_layout_v<int128_t>);
+
+// =============================================================================
+// OPERACIONES EN BLOQUE SOBRE ARRAYS
+// =============================================================================
+
+/**
+ * @brief Suma @p delta a cada elemento, cada uno de forma atómica
+ *
+ * No es atómica para el conjunto: otro hilo puede ver unos elementos ya
+ * sumados y otros no.
+ * @pre values.data() alineado a 16 bytes
+ */
+template <atomic128_value T>
+void atomic_add_all(std::span<T> values, T delta,
+                    std::memory_order order = std::memory_order_relaxed) noexcept
+{
+    for (T& v : values) {
+        atomic_ref128<T>(v).fetch_add(delta, order);
+    }
+}
+
+/**
+ * @brief target[i] += deltas[i] de forma atómica por elemento; se saltan los ceros
+ *
+ * Para volcar un histograma local de cada hilo sobre el compartido.
+ * @pre target.data() alineado a 16 bytes y deltas.size() <= target.size()
+ */
+template <atomic128_value T>
+void atomic_add_each(std::span<T> target, std::span<const T> deltas,
+                     std::memory_order order = std::memory_order_relaxed) noexcept
+{
+    for (std::size_t i = 0; i < deltas.size(); ++i) {
+        if (deltas[i] != T(0)) {
+            atomic_ref128<T>(target[i]).fetch_add(deltas[i], order);
+        }
+    }
+}
+
+/**
+ * @brief out[i] = values[i] con una carga atómica por elemento (sin partir ningún valor)
+ * @pre values.data() alineado a 16 bytes y out.size() >= values.size()
+ */
+template <atomic128_value T>
+void atomic_load_all(std::span<T> values, std::span<T> out,
+                     std::memory_order order = std::memory_order_acquire) noexcept
+{
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        out[i] = atomic_ref128<T>(values[i]).load(order);
+    }
+}
+
+} // namespace nstd
+
+#endif // UINT128_ATOMIC_HPP
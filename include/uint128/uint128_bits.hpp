@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../intrinsics/bit_operations.hpp"
+#include "../intrinsics/cpu_features.hpp"
 #include "uint128_t.hpp"
 #include <bitset>
 #include <type_traits>
@@ -186,31 +188,55 @@ namespace uint128_bits
 using uint128_t = nstd::uint128_t;
 
 /**
- * @brief Rotate left
+ * @brief Upper 128 bits of the 256-bit concatenation (hi:lo) shifted left by n
+ *
+ * Branch-free: bit 6 of n selects (by mask) which three words take part and
+ * two SHLDs do the rest. funnel_shift_left(v, v, n) is rotl(v, n).
+ *
+ * @param n Shift amount, taken modulo 128
  */
-constexpr uint128_t rotl(const uint128_t& value, int shift) noexcept
+constexpr uint128_t funnel_shift_left(const uint128_t& hi, const uint128_t& lo, int n) noexcept
 {
-    shift %= 128;
-    if (shift == 0)
-        return value;
-    if (shift < 0)
-        shift += 128;
+    const unsigned s = static_cast<unsigned>(n) & 127;
+    // Mask select: GCC turns the equivalent ternaries into a jump
+    const uint64_t wide = uint64_t(0) - static_cast<uint64_t>(s >> 6);
+    const uint64_t a = (hi.low() & wide) | (hi.high() & ~wide);
+    const uint64_t b = (lo.high() & wide) | (hi.low() & ~wide);
+    const uint64_t c = (lo.low() & wide) | (lo.high() & ~wide);
+    return uint128_t(intrinsics::funnel_shl64(a, b, s), intrinsics::funnel_shl64(b, c, s));
+}
 
-    return (value << shift) | (value >> (128 - shift));
+/**
+ * @brief Lower 128 bits of the 256-bit concatenation (hi:lo) shifted right by n
+ *
+ * funnel_shift_right(v, v, n) is rotr(v, n).
+ *
+ * @param n Shift amount, taken modulo 128
+ */
+constexpr uint128_t funnel_shift_right(const uint128_t& hi, const uint128_t& lo, int n) noexcept
+{
+    const unsigned s = static_cast<unsigned>(n) & 127;
+    const uint64_t wide = uint64_t(0) - static_cast<uint64_t>(s >> 6);
+    const uint64_t a = (hi.high() & wide) | (hi.low() & ~wide);
+    const uint64_t b = (hi.low() & wide) | (lo.high() & ~wide);
+    const uint64_t c = (lo.high() & wide) | (lo.low() & ~wide);
+    return uint128_t(intrinsics::funnel_shr64(a, b, s), intrinsics::funnel_shr64(b, c, s));
 }
 
 /**
- * @brief Rotate right
+ * @brief Rotate left (shift taken modulo 128, negative rotates right)
  */
-constexpr uint128_t rotr(const uint128_t& value, int shift) noexcept
+constexpr uint128_t rotl(const uint128_t& value, int shift) noexcept
 {
-    shift %= 128;
-    if (shift == 0)
-        return value;
-    if (shift < 0)
-        shift += 128;
+    return funnel_shift_left(value, value, shift);
+}
 
-    return (value >> shift) | (value << (128 - shift));
+/**
+ * @brief Rotate right (shift taken modulo 128, negative rotates left)
+ */
+constexpr uint128_t rotr(const uint128_t& value, int shift) noexcept
+{
+    return funnel_shift_right(value, value, shift);
 }
 
 /**
@@ -290,48 +316,170 @@ constexpr uint128_t insert_bits(const uint128_t& dest, const uint128_t& src, int
     return (dest & clear_mask) | ((src & mask) << offset);
 }
 
+namespace detail
+{
+
+// Los 64 bits de value a partir de la posición k (0 <= k <= 64)
+constexpr uint64_t bits_from(const uint128_t& value, int k) noexcept
+{
+    if (k == 0)
+        return value.low();
+    if (k == 64)
+        return value.high();
+    return (value.low() >> k) | (value.high() << (64 - k));
+}
+
+// lo | (hi << k) sobre 128 bits (0 <= k <= 64)
+constexpr uint128_t join_at(uint64_t lo, uint64_t hi, int k) noexcept
+{
+    if (k == 0)
+        return uint128_t(0, lo | hi);
+    if (k == 64)
+        return uint128_t(hi, lo);
+    return uint128_t(hi >> (64 - k), lo | (hi << k));
+}
+
+// Cada mitad se resuelve por separado: los popcount(mask.low()) bits bajos de
+// value van a la mitad baja y los siguientes a la alta
+constexpr uint128_t pdep128_soft(const uint128_t& value, const uint128_t& mask) noexcept
+{
+    const int k = intrinsics::popcount64(mask.low());
+    return uint128_t(intrinsics::pdep64_soft(bits_from(value, k), mask.high()),
+                     intrinsics::pdep64_soft(value.low(), mask.low()));
+}
+
+constexpr uint128_t pext128_soft(const uint128_t& value, const uint128_t& mask) noexcept
+{
+    return join_at(intrinsics::pext64_soft(value.low(), mask.low()),
+                   intrinsics::pext64_soft(value.high(), mask.high()),
+                   intrinsics::popcount64(mask.low()));
+}
+
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+
+INTRINSICS_TARGET("bmi2,popcnt")
+inline uint128_t pdep128_bmi2(const uint128_t& value, const uint128_t& mask) noexcept
+{
+    const int k = intrinsics::popcount64(mask.low());
+    return uint128_t(_pdep_u64(bits_from(value, k), mask.high()),
+                     _pdep_u64(value.low(), mask.low()));
+}
+
+INTRINSICS_TARGET("bmi2,popcnt")
+inline uint128_t pext128_bmi2(const uint128_t& value, const uint128_t& mask) noexcept
+{
+    return join_at(_pext_u64(value.low(), mask.low()), _pext_u64(value.high(), mask.high()),
+                   intrinsics::popcount64(mask.low()));
+}
+
+INTRINSICS_TARGET("bmi,bmi2")
+inline int select64_bmi2(uint64_t x, int k) noexcept
+{
+    // 64 para k fuera de rango: pdep de un bit ausente da 0 y tzcnt(0) = 64
+    return k < 0 || k >= 64 ? 64 : static_cast<int>(_tzcnt_u64(_pdep_u64(uint64_t(1) << k, x)));
+}
+
+#endif
+
+inline int select64_runtime(uint64_t x, int k) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (intrinsics::cpu().fast_pdep)
+        return select64_bmi2(x, k);
+#endif
+    return intrinsics::select64_soft(x, k);
+}
+
+inline uint128_t pdep128_runtime(const uint128_t& value, const uint128_t& mask) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (intrinsics::cpu().fast_pdep)
+        return pdep128_bmi2(value, mask);
+#endif
+    return pdep128_soft(value, mask);
+}
+
+inline uint128_t pext128_runtime(const uint128_t& value, const uint128_t& mask) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (intrinsics::cpu().fast_pdep)
+        return pext128_bmi2(value, mask);
+#endif
+    return pext128_soft(value, mask);
+}
+
+} // namespace detail
+
 /**
  * @brief Parallel bit deposit (PDEP)
+ *
+ * Two 64-bit PDEP when the CPU has fast BMI2 (detected once via CPUID);
+ * the magic-mask software version on older CPUs where PDEP is microcoded
+ * (AMD before Zen 3) and in constant evaluation.
+ *
  * @param value Source value
  * @param mask Bit mask indicating positions
  */
 constexpr uint128_t parallel_deposit(const uint128_t& value, const uint128_t& mask) noexcept
 {
-    uint128_t result(0);
-    uint128_t src_bit(1);
-
-    for (int i = 0; i < 128; ++i) {
-        if ((mask & (uint128_t(1) << i)) != uint128_t(0)) {
-            if ((value & src_bit) != uint128_t(0)) {
-                result |= (uint128_t(1) << i);
-            }
-            src_bit <<= 1;
-        }
-    }
-
-    return result;
+    if (std::is_constant_evaluated())
+        return detail::pdep128_soft(value, mask);
+    return detail::pdep128_runtime(value, mask);
 }
 
 /**
  * @brief Parallel bit extract (PEXT)
+ *
+ * Same dispatch as parallel_deposit.
+ *
  * @param value Source value
  * @param mask Bit mask indicating positions to extract
  */
 constexpr uint128_t parallel_extract(const uint128_t& value, const uint128_t& mask) noexcept
 {
-    uint128_t result(0);
-    uint128_t dst_bit(1);
+    if (std::is_constant_evaluated())
+        return detail::pext128_soft(value, mask);
+    return detail::pext128_runtime(value, mask);
+}
 
-    for (int i = 0; i < 128; ++i) {
-        if ((mask & (uint128_t(1) << i)) != uint128_t(0)) {
-            if ((value & (uint128_t(1) << i)) != uint128_t(0)) {
-                result |= dst_bit;
-            }
-            dst_bit <<= 1;
-        }
+/**
+ * @brief Rank: number of set bits strictly below position
+ * @param value Source value
+ * @param position Bit position; clamped to [0, 128]
+ */
+constexpr int rank(const uint128_t& value, int position) noexcept
+{
+    if (position <= 0)
+        return 0;
+    if (position >= 128)
+        return intrinsics::popcount64(value.high()) + intrinsics::popcount64(value.low());
+    if (position <= 64) {
+        const uint64_t below = position == 64 ? ~uint64_t(0) : (uint64_t(1) << position) - 1;
+        return intrinsics::popcount64(value.low() & below);
     }
+    return intrinsics::popcount64(value.low()) +
+           intrinsics::popcount64(value.high() & ((uint64_t(1) << (position - 64)) - 1));
+}
 
-    return result;
+/**
+ * @brief Select: position of the k-th set bit (k is 0-based)
+ *
+ * `tzcnt(pdep(1 << k, word))` on CPUs with fast BMI2, broadword select
+ * otherwise. select(value, 0) == countr_zero(value).
+ *
+ * @return Bit position, or 128 if value has k or fewer set bits
+ */
+constexpr int select(const uint128_t& value, int k) noexcept
+{
+    const int low_count = intrinsics::popcount64(value.low());
+    if (k < 0)
+        return 128;
+    if (std::is_constant_evaluated()) {
+        return k < low_count ? intrinsics::select64_soft(value.low(), k)
+                             : 64 + intrinsics::select64_soft(value.high(), k - low_count);
+    }
+    return k < low_count ? detail::select64_runtime(value.low(), k)
+                         : 64 + detail::select64_runtime(value.high(), k - low_count);
 }
 
 /**
@@ -406,53 +554,30 @@ namespace nstd
 
 /**
  * @brief Convert uint128_t to std::bitset<128>
+ *
+ * Word by word: two 64-bit constructions and one shift instead of 128 set().
  */
 inline std::bitset<128> to_bitset(const uint128_t& value) noexcept
 {
-    std::bitset<128> result;
-
-    // Set bits for low 64 bits
-    for (int i = 0; i < 64; ++i) {
-        if ((value.low() & (1ULL << i)) != 0) {
-            result.set(i);
-        }
-    }
-
-    // Set bits for high 64 bits
-    for (int i = 0; i < 64; ++i) {
-        if ((value.high() & (1ULL << i)) != 0) {
-            result.set(64 + i);
-        }
-    }
-
-    return result;
+    return (std::bitset<128>(value.high()) << 64) | std::bitset<128>(value.low());
 }
 
 /**
  * @brief Convert std::bitset<128> to uint128_t
+ *
+ * Word by word. The low word is masked before to_ullong(), so it never throws.
  */
 template <size_t N> inline uint128_t from_bitset(const std::bitset<N>& bs) noexcept
 {
     static_assert(N <= 128, "Bitset size cannot exceed 128 bits");
 
-    uint64_t low_part = 0;
-    uint64_t high_part = 0;
-
-    // Extract low 64 bits
-    for (int i = 0; i < 64 && i < static_cast<int>(N); ++i) {
-        if (bs[i]) {
-            low_part |= (1ULL << i);
-        }
-    }
-
-    // Extract high 64 bits
-    for (int i = 64; i < 128 && i < static_cast<int>(N); ++i) {
-        if (bs[i]) {
-            high_part |= (1ULL << (i - 64));
-        }
+    if constexpr (N <= 64) {
+        return uint128_t(0, bs.to_ullong());
+    } else {
+        const uint64_t low_part = (bs & std::bitset<N>(~0ULL)).to_ullong();
+        const uint64_t high_part = (bs >> 64).to_ullong();
+        return uint128_t(high_part, low_part);
     }
-
-    return uint128_t(high_part, low_part);
 }
 
 } // namespace nstd
\ No newline at end of file
@@ -0,0 +1,701 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_BITSET_HPP
+#define UINT128_BITSET_HPP
+
+/**
+ * @file uint128_bitset.hpp
+ * @brief Bitset dinámico sobre palabras uint128_t con operaciones vectoriales
+ *
+ * `bitset128_vector` sustituye a `std::vector<bool>` en filtros y máscaras
+ * grandes:
+ * - Almacenamiento en bloques de 64 bytes (4 palabras) alineados a línea de
+ *   caché; los bits por encima de size() se mantienen siempre a cero.
+ * - &=, |=, ^=, and_not y count() delegan en los kernels de nstd::simd
+ *   (escalar / AVX2 / AVX-512 elegido en runtime).
+ * - and_popcount(a, b) cuenta |a & b| sin materializar la intersección.
+ * - Recorrido de bits a 1 palabra a palabra con countr_zero y x & (x - 1):
+ *   el coste es proporcional al número de unos, no al tamaño.
+ * - word(w) / set_word(w, ...) y la conversión a std::bitset<128> van palabra
+ *   a palabra.
+ *
+ * @code{.cpp}
+ * nstd::bitset128_vector seen(n), wanted(n);
+ * ...
+ * seen &= wanted;
+ * for (std::size_t i : seen.ones()) {
+ *     process(i);
+ * }
+ * std::size_t common = nstd::and_popcount(seen, wanted);
+ * @endcode
+ */
+
+#include "../intrinsics/bit_operations.hpp"
+#include "uint128_bits.hpp"
+#include "uint128_simd.hpp"
+#include "uint128_t.hpp"
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace nstd
+{
+
+/**
+ * @brief Secuencia dinámica de bits empaquetada en palabras uint128_t
+ *
+ * El bit i es el bit (i % 128) de la palabra i / 128. Los accesos por índice
+ * no comprueban límites (como std::vector::operator[]); las operaciones entre
+ * dos bitsets exigen el mismo size().
+ */
+class bitset128_vector
+{
+  public:
+    static constexpr std::size_t word_bits = 128;
+    static constexpr std::size_t alignment = 64;
+    static constexpr std::size_t block_words = alignment / sizeof(uint128_t);
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    class ones_iterator;
+    class ones_view;
+
+    bitset128_vector() = default;
+
+    /// `bits` bits, todos a `value`
+    explicit bitset128_vector(std::size_t bits, bool value = false) : size_(bits)
+    {
+        reallocate(words_for(bits));
+        if (value) {
+            set();
+        }
+    }
+
+    /**
+     * @brief Copia los primeros `bits` bits de `words`
+     * @throws std::invalid_argument si words tiene menos de `bits` bits
+     */
+    bitset128_vector(std::span<const uint128_t> words, std::size_t bits) : size_(bits)
+    {
+        if (bits > words.size() * word_bits) {
+            throw std::invalid_argument("bitset128_vector: not enough words for bit count");
+        }
+        reallocate(words_for(bits));
+        if (bits != 0) {
+            std::memcpy(static_cast<void*>(data_.get()), words.data(), num_words() * sizeof(uint128_t));
+            clear_tail();
+        }
+    }
+
+    /// Conversión desde std::vector<bool> para migrar código existente
+    explicit bitset128_vector(const std::vector<bool>& bits) : bitset128_vector(bits.size())
+    {
+        for (std::size_t i = 0; i < bits.size(); ++i) {
+            if (bits[i]) {
+                set(i);
+            }
+        }
+    }
+
+    bitset128_vector(const bitset128_vector& other) : size_(other.size_)
+    {
+        reallocate(words_for(size_));
+        if (size_ != 0) {
+            std::memcpy(static_cast<void*>(data_.get()), other.data_.get(),
+                        num_words() * sizeof(uint128_t));
+        }
+    }
+
+    bitset128_vector& operator=(const bitset128_vector& other)
+    {
+        if (this != &other) {
+            bitset128_vector copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    bitset128_vector(bitset128_vector&& other) noexcept
+        : size_(std::exchange(other.size_, 0)), capacity_(std::exchange(other.capacity_, 0)),
+          data_(std::move(other.data_))
+    {
+    }
+
+    bitset128_vector& operator=(bitset128_vector&& other) noexcept
+    {
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+        data_ = std::move(other.data_);
+        return *this;
+    }
+
+    // ------------------------------------------------------------------------
+    // Tamaño y capacidad
+    // ------------------------------------------------------------------------
+
+    /// Número de bits
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /// Palabras de 128 bits en uso: ceil(size() / 128)
+    std::size_t num_words() const noexcept
+    {
+        return words_for(size_);
+    }
+
+    /// Bits que caben sin reservar memoria
+    std::size_t capacity() const noexcept
+    {
+        return capacity_ * word_bits;
+    }
+
+    void reserve(std::size_t bits)
+    {
+        if (words_for(bits) > capacity_) {
+            reallocate(words_for(bits));
+        }
+    }
+
+    /// Cambia el tamaño; los bits nuevos valen `value`
+    void resize(std::size_t bits, bool value = false)
+    {
+        const std::size_t old = size_;
+        reserve(bits);
+        size_ = bits;
+        if (bits < old) {
+            clear_tail();
+            const std::size_t nw = num_words();
+            std::fill(data_.get() + nw, data_.get() + words_for(old), uint128_t(0));
+        } else if (value) {
+            set_range(old, bits);
+        }
+    }
+
+    void clear() noexcept
+    {
+        std::fill(data_.get(), data_.get() + num_words(), uint128_t(0));
+        size_ = 0;
+    }
+
+    void push_back(bool value)
+    {
+        if (size_ == capacity()) {
+            reallocate(std::max(capacity_ * 2, block_words));
+        }
+        ++size_;
+        if (value) {
+            set(size_ - 1);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Acceso por bit (@pre i < size())
+    // ------------------------------------------------------------------------
+
+    bool test(std::size_t i) const noexcept
+    {
+        const uint128_t& w = data_[i / word_bits];
+        const uint64_t half = (i & 64) != 0 ? w.high() : w.low();
+        return ((half >> (i & 63)) & 1) != 0;
+    }
+
+    bool operator[](std::size_t i) const noexcept
+    {
+        return test(i);
+    }
+
+    void set(std::size_t i, bool value = true) noexcept
+    {
+        uint128_t& w = data_[i / word_bits];
+        const uint64_t bit = uint64_t(1) << (i & 63);
+        const uint64_t keep = value ? bit : 0;
+        if ((i & 64) != 0) {
+            w.set_high((w.high() & ~bit) | keep);
+        } else {
+            w.set_low((w.low() & ~bit) | keep);
+        }
+    }
+
+    void reset(std::size_t i) noexcept
+    {
+        set(i, false);
+    }
+
+    void flip(std::size_t i) noexcept
+    {
+        uint128_t& w = data_[i / word_bits];
+        const uint64_t bit = uint64_t(1) << (i & 63);
+        if ((i & 64) != 0) {
+            w.set_high(w.high() ^ bit);
+        } else {
+            w.set_low(w.low() ^ bit);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Operaciones sobre todos los bits
+    // ------------------------------------------------------------------------
+
+    bitset128_vector& set() noexcept
+    {
+        std::fill(data_.get(), data_.get() + num_words(), ~uint128_t(0));
+        clear_tail();
+        return *this;
+    }
+
+    bitset128_vector& reset() noexcept
+    {
+        std::fill(data_.get(), data_.get() + num_words(), uint128_t(0));
+        return *this;
+    }
+
+    bitset128_vector& flip() noexcept
+    {
+        uint128_t* w = data_.get();
+        for (std::size_t i = 0, n = num_words(); i < n; ++i) {
+            w[i] = ~w[i];
+        }
+        clear_tail();
+        return *this;
+    }
+
+    /// Número de bits a 1
+    std::size_t count() const noexcept
+    {
+        return static_cast<std::size_t>(simd::popcount_sum(words()));
+    }
+
+    bool any() const noexcept
+    {
+        const uint128_t* w = data_.get();
+        for (std::size_t i = 0, n = num_words(); i < n; ++i) {
+            if ((w[i].high() | w[i].low()) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool none() const noexcept
+    {
+        return !any();
+    }
+
+    bool all() const noexcept
+    {
+        return count() == size_;
+    }
+
+    // ------------------------------------------------------------------------
+    // Operaciones entre bitsets (mismo tamaño)
+    // ------------------------------------------------------------------------
+
+    /// @throws std::invalid_argument si los tamaños difieren
+    bitset128_vector& operator&=(const bitset128_vector& other)
+    {
+        simd::bit_and(words(), other.checked_words(size_), mutable_words());
+        return *this;
+    }
+
+    /// @throws std::invalid_argument si los tamaños difieren
+    bitset128_vector& operator|=(const bitset128_vector& other)
+    {
+        simd::bit_or(words(), other.checked_words(size_), mutable_words());
+        return *this;
+    }
+
+    /// @throws std::invalid_argument si los tamaños difieren
+    bitset128_vector& operator^=(const bitset128_vector& other)
+    {
+        simd::bit_xor(words(), other.checked_words(size_), mutable_words());
+        return *this;
+    }
+
+    /// *this &= ~other, sin construir ~other. @throws std::invalid_argument si los tamaños difieren
+    bitset128_vector& and_not(const bitset128_vector& other)
+    {
+        simd::bit_andnot(words(), other.checked_words(size_), mutable_words());
+        return *this;
+    }
+
+    bitset128_vector operator~() const
+    {
+        bitset128_vector result(*this);
+        result.flip();
+        return result;
+    }
+
+    friend bool operator==(const bitset128_vector& a, const bitset128_vector& b) noexcept
+    {
+        return a.size_ == b.size_ &&
+               std::equal(a.data_.get(), a.data_.get() + a.num_words(), b.data_.get());
+    }
+
+    // ------------------------------------------------------------------------
+    // Búsqueda y recorrido de bits a 1
+    // ------------------------------------------------------------------------
+
+    /// Primer bit a 1, o npos
+    std::size_t find_first() const noexcept
+    {
+        return empty() ? npos : find_from_half(0, half(0));
+    }
+
+    /// Primer bit a 1 en (pos, size()), o npos
+    std::size_t find_next(std::size_t pos) const noexcept
+    {
+        if (size_ == 0 || pos >= size_ - 1) { // Sin pos + 1: npos daría la vuelta
+            return npos;
+        }
+        ++pos;
+        const std::size_t h = pos / 64;
+        return find_from_half(h, half(h) & (~uint64_t(0) << (pos & 63)));
+    }
+
+    /**
+     * @brief Llama a f(i) para cada bit i a 1, en orden creciente
+     *
+     * Por cada mitad de 64 bits: countr_zero da el bit más bajo y x & (x - 1)
+     * lo borra, sin examinar los ceros.
+     */
+    template <typename F> void for_each_set(F&& f) const
+    {
+        const uint128_t* w = data_.get();
+        for (std::size_t i = 0, n = num_words(); i < n; ++i) {
+            for (uint64_t x = w[i].low(); x != 0; x &= x - 1) {
+                f(i * word_bits + static_cast<std::size_t>(intrinsics::ctz64(x)));
+            }
+            for (uint64_t x = w[i].high(); x != 0; x &= x - 1) {
+                f(i * word_bits + 64 + static_cast<std::size_t>(intrinsics::ctz64(x)));
+            }
+        }
+    }
+
+    /// Rango de las posiciones de los bits a 1 (para range-for)
+    ones_view ones() const noexcept;
+
+    // ------------------------------------------------------------------------
+    // Acceso por palabras
+    // ------------------------------------------------------------------------
+
+    /// Palabras en uso; los bits por encima de size() son cero
+    std::span<const uint128_t> words() const noexcept
+    {
+        return {data_.get(), num_words()};
+    }
+
+    /// Palabra w (bits [128 w, 128 w + 128)); @pre w < num_words()
+    const uint128_t& word(std::size_t w) const noexcept
+    {
+        return data_[w];
+    }
+
+    /// Sustituye la palabra w; los bits por encima de size() se descartan
+    void set_word(std::size_t w, const uint128_t& value) noexcept
+    {
+        data_[w] = value;
+        if (w + 1 == num_words()) {
+            clear_tail();
+        }
+    }
+
+    /// Palabra w como std::bitset<128>
+    std::bitset<128> bitset_word(std::size_t w) const noexcept
+    {
+        return to_bitset(data_[w]);
+    }
+
+    void set_word(std::size_t w, const std::bitset<128>& value) noexcept
+    {
+        set_word(w, from_bitset(value));
+    }
+
+    std::vector<bool> to_vector_bool() const
+    {
+        std::vector<bool> result(size_, false);
+        for_each_set([&](std::size_t i) { result[i] = true; });
+        return result;
+    }
+
+    /// Bytes reservados
+    std::size_t memory_bytes() const noexcept
+    {
+        return capacity_ * sizeof(uint128_t);
+    }
+
+  private:
+    struct aligned_delete {
+        void operator()(uint128_t* p) const noexcept
+        {
+            ::operator delete[](p, std::align_val_t{alignment});
+        }
+    };
+    using buffer = std::unique_ptr<uint128_t[], aligned_delete>;
+
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0; ///< En palabras, múltiplo de block_words
+    buffer data_;
+
+    static std::size_t words_for(std::size_t bits) noexcept
+    {
+        return (bits + word_bits - 1) / word_bits;
+    }
+
+    // Nuevo buffer de al menos `words` palabras (redondeado a bloques de 64
+    // bytes), a cero salvo las palabras en uso, que se copian
+    void reallocate(std::size_t words)
+    {
+        const std::size_t cap = (words + block_words - 1) / block_words * block_words;
+        buffer fresh;
+        if (cap != 0) {
+            void* p = ::operator new[](cap * sizeof(uint128_t), std::align_val_t{alignment});
+            fresh = buffer(static_cast<uint128_t*>(p));
+            std::memset(static_cast<void*>(fresh.get()), 0, cap * sizeof(uint128_t));
+            if (data_) {
+                std::memcpy(static_cast<void*>(fresh.get()), data_.get(),
+                            std::min(cap, capacity_) * sizeof(uint128_t));
+            }
+        }
+        data_ = std::move(fresh);
+        capacity_ = cap;
+    }
+
+    std::span<uint128_t> mutable_words() noexcept
+    {
+        return {data_.get(), num_words()};
+    }
+
+    std::span<const uint128_t> checked_words(std::size_t bits) const
+    {
+        if (bits != size_) {
+            throw std::invalid_argument("bitset128_vector: sizes differ");
+        }
+        return words();
+    }
+
+    // Pone a cero los bits de la última palabra por encima de size()
+    void clear_tail() noexcept
+    {
+        const std::size_t r = size_ % word_bits;
+        if (r != 0) {
+            const uint64_t ones = ~uint64_t(0);
+            data_[size_ / word_bits] &= r > 64 ? uint128_t((uint64_t(1) << (r - 64)) - 1, ones)
+                                               : uint128_t(0, r == 64 ? ones : (uint64_t(1) << r) - 1);
+        }
+    }
+
+    void set_range(std::size_t from, std::size_t to) noexcept
+    {
+        for (; from < to && from % word_bits != 0; ++from) {
+            set(from);
+        }
+        for (; from + word_bits <= to; from += word_bits) {
+            data_[from / word_bits] = ~uint128_t(0);
+        }
+        for (; from < to; ++from) {
+            set(from);
+        }
+    }
+
+    // Mitad de 64 bits h (h par: baja, h impar: alta)
+    uint64_t half(std::size_t h) const noexcept
+    {
+        const uint128_t& w = data_[h / 2];
+        return (h & 1) != 0 ? w.high() : w.low();
+    }
+
+    // Primer bit a 1 empezando por los bits `x` de la mitad h
+    std::size_t find_from_half(std::size_t h, uint64_t x) const noexcept
+    {
+        const std::size_t halves = 2 * num_words();
+        if (h >= halves) {
+            return npos;
+        }
+        while (x == 0) {
+            if (++h == halves) {
+                return npos;
+            }
+            x = half(h);
+        }
+        return h * 64 + static_cast<std::size_t>(intrinsics::ctz64(x));
+    }
+};
+
+/**
+ * @brief Iterador de avance sobre las posiciones de los bits a 1
+ *
+ * Guarda la mitad de 64 bits actual con los unos ya visitados borrados;
+ * ++ es x & (x - 1) y sólo salta de palabra cuando x queda a cero.
+ */
+class bitset128_vector::ones_iterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::size_t;
+
+    ones_iterator() = default;
+
+    std::size_t operator*() const noexcept
+    {
+        return h_ * 64 + static_cast<std::size_t>(intrinsics::ctz64(x_));
+    }
+
+    ones_iterator& operator++() noexcept
+    {
+        x_ &= x_ - 1;
+        skip_empty();
+        return *this;
+    }
+
+    ones_iterator operator++(int) noexcept
+    {
+        ones_iterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    friend bool operator==(const ones_iterator& a, const ones_iterator& b) noexcept
+    {
+        return a.h_ == b.h_ && a.x_ == b.x_;
+    }
+
+    friend bool operator==(const ones_iterator& it, std::default_sentinel_t) noexcept
+    {
+        return it.h_ == it.halves_;
+    }
+
+  private:
+    friend class bitset128_vector::ones_view;
+
+    const bitset128_vector* bits_ = nullptr;
+    std::size_t h_ = 0;
+    std::size_t halves_ = 0;
+    uint64_t x_ = 0;
+
+    ones_iterator(const bitset128_vector* bits, std::size_t h) noexcept
+        : bits_(bits), h_(h), halves_(2 * bits->num_words())
+    {
+        if (h_ < halves_) {
+            x_ = bits_->half(h_);
+            skip_empty();
+        }
+    }
+
+    void skip_empty() noexcept
+    {
+        while (x_ == 0 && ++h_ < halves_) {
+            x_ = bits_->half(h_);
+        }
+    }
+};
+
+/// Vista de los bits a 1; end() es std::default_sentinel
+class bitset128_vector::ones_view
+{
+  public:
+    explicit ones_view(const bitset128_vector* bits) noexcept : bits_(bits) {}
+
+    ones_iterator begin() const noexcept
+    {
+        return ones_iterator(bits_, 0);
+    }
+
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+  private:
+    const bitset128_vector* bits_;
+};
+
+inline bitset128_vector::ones_view bitset128_vector::ones() const noexcept
+{
+    return ones_view(this);
+}
+
+// ============================================================================
+// OPERADORES LIBRES
+// ============================================================================
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline bitset128_vector operator&(const bitset128_vector& a, const bitset128_vector& b)
+{
+    bitset128_vector result(a);
+    result &= b;
+    return result;
+}
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline bitset128_vector operator|(const bitset128_vector& a, const bitset128_vector& b)
+{
+    bitset128_vector result(a);
+    result |= b;
+    return result;
+}
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline bitset128_vector operator^(const bitset128_vector& a, const bitset128_vector& b)
+{
+    bitset128_vector result(a);
+    result ^= b;
+    return result;
+}
+
+/**
+ * @brief |a & b| en una sola pasada, sin construir la intersección
+ * @throws std::invalid_argument si los tamaños difieren
+ */
+inline std::size_t and_popcount(const bitset128_vector& a, const bitset128_vector& b)
+{
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("bitset128_vector: sizes differ");
+    }
+    return static_cast<std::size_t>(simd::and_popcount(a.words(), b.words()));
+}
+
+} // namespace nstd
+
+#endif // UINT128_BITSET_HPP
@@ -0,0 +1,687 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_CLMUL_HPP
+#define UINT128_CLMUL_HPP
+
+/**
+ * @file uint128_clmul.hpp
+ * @brief Multiplicación sin acarreo (GF(2)[x]), GF(2^128) y CRC-64
+ *
+ * - `clmul(a, b)`: producto sin acarreo de dos palabras de 64 bits (128 bits).
+ * - `clmul_wide(a, b)`: producto sin acarreo de dos uint128_t (256 bits).
+ * - `gf2_128`: cuerpo GF(2^128) módulo el polinomio de GCM
+ *   x^128 + x^7 + x^2 + x + 1, con mul, square, pow e inverse.
+ * - `crc64(data, crc)`: CRC-64/XZ (ECMA-182 reflejado) por plegado con
+ *   PCLMULQDQ: cuatro acumuladores de 128 bits, o de 256 bits con
+ *   VPCLMULQDQ, y tablas slice-by-8 como alternativa.
+ *
+ * Todas las funciones son constexpr. En tiempo de ejecución se usa
+ * PCLMULQDQ/VPCLMULQDQ si CPUID lo anuncia; si no, la versión software
+ * (ventana de 4 bits), que no es de tiempo constante: no debe usarse con
+ * claves secretas (p. ej. la H de GHASH) en CPUs sin PCLMULQDQ.
+ *
+ * Representación de gf2_128: el bit i del uint128_t es el coeficiente de
+ * x^i. GCM numera los bits al revés (el bit más significativo del primer
+ * byte es x^0); from_gcm/to_gcm convierten un bloque leído en big-endian.
+ *
+ * @code{.cpp}
+ * nstd::gf2_128 h = nstd::gf2_128::from_gcm(hash_key);
+ * nstd::gf2_128 y;
+ * for (const auto& block : blocks)
+ *     y = (y + nstd::gf2_128::from_gcm(block)) * h;   // GHASH
+ * uint64_t crc = nstd::crc64(std::as_bytes(std::span(buffer)));
+ * @endcode
+ */
+
+#include "../intrinsics/cpu_features.hpp"
+#include "uint128_bits.hpp"
+#include "uint128_t.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace nstd
+{
+
+/**
+ * @brief Producto de 256 bits de clmul_wide
+ */
+struct clmul_product {
+    uint128_t high;
+    uint128_t low;
+
+    friend constexpr bool operator==(const clmul_product&, const clmul_product&) = default;
+};
+
+namespace detail
+{
+
+// Ventana de 4 bits: tabla de a * i para i en [0, 16), entradas de 67 bits
+constexpr uint128_t clmul64_soft(uint64_t a, uint64_t b) noexcept
+{
+    uint64_t table_lo[16] = {};
+    uint64_t table_hi[16] = {};
+    table_lo[1] = a;
+    for (int i = 2; i < 16; ++i) {
+        if (i % 2 == 0) {
+            table_lo[i] = table_lo[i / 2] << 1;
+            table_hi[i] = (table_hi[i / 2] << 1) | (table_lo[i / 2] >> 63);
+        } else {
+            table_lo[i] = table_lo[i - 1] ^ a;
+            table_hi[i] = table_hi[i - 1];
+        }
+    }
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    for (int shift = 60; shift >= 0; shift -= 4) {
+        hi = (hi << 4) | (lo >> 60);
+        lo <<= 4;
+        const unsigned nibble = static_cast<unsigned>(b >> shift) & 15u;
+        lo ^= table_lo[nibble];
+        hi ^= table_hi[nibble];
+    }
+    return uint128_t(hi, lo);
+}
+
+// Karatsuba: tres productos de 64 bits
+constexpr clmul_product clmul128_soft(const uint128_t& a, const uint128_t& b) noexcept
+{
+    const uint128_t lo = clmul64_soft(a.low(), b.low());
+    const uint128_t hi = clmul64_soft(a.high(), b.high());
+    const uint128_t mid =
+        clmul64_soft(a.low() ^ a.high(), b.low() ^ b.high()) ^ lo ^ hi;
+    return {hi ^ (mid >> 64), lo ^ (mid << 64)};
+}
+
+// Intercala ceros entre los 32 bits de x: el cuadrado sin acarreo
+constexpr uint64_t spread_bits32(uint64_t x) noexcept
+{
+    x &= 0xFFFFFFFFULL;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+}
+
+constexpr clmul_product clsquare128_soft(const uint128_t& a) noexcept
+{
+    return {uint128_t(spread_bits32(a.high() >> 32), spread_bits32(a.high())),
+            uint128_t(spread_bits32(a.low() >> 32), spread_bits32(a.low()))};
+}
+
+// Reducción módulo x^128 + x^7 + x^2 + x + 1: x^128 = x^7 + x^2 + x + 1.
+// Los bits de high que desbordan al desplazar (a lo sumo 7) se pliegan una vez más
+constexpr uint128_t gf2_128_reduce(const clmul_product& p) noexcept
+{
+    const uint128_t& h = p.high;
+    const uint128_t carry = (h >> 127) ^ (h >> 126) ^ (h >> 121);
+    const uint128_t t = h ^ carry;
+    return p.low ^ t ^ (t << 1) ^ (t << 2) ^ (t << 7);
+}
+
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+
+// Los kernels se compilan con target("pclmul,sse4.1"): ése es el requisito
+inline bool has_pclmul() noexcept
+{
+    const auto& f = intrinsics::cpu();
+    return f.pclmul && f.sse41;
+}
+
+INTRINSICS_TARGET("pclmul,sse4.1") inline __m128i to_m128(const uint128_t& v) noexcept
+{
+    return _mm_set_epi64x(static_cast<long long>(v.high()), static_cast<long long>(v.low()));
+}
+
+INTRINSICS_TARGET("pclmul,sse4.1") inline uint128_t from_m128(__m128i v) noexcept
+{
+    return uint128_t(static_cast<uint64_t>(_mm_extract_epi64(v, 1)),
+                     static_cast<uint64_t>(_mm_cvtsi128_si64(v)));
+}
+
+INTRINSICS_TARGET("pclmul,sse4.1") inline uint128_t clmul64_pclmul(uint64_t a, uint64_t b) noexcept
+{
+    return from_m128(_mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<long long>(a)),
+                                          _mm_cvtsi64_si128(static_cast<long long>(b)), 0x00));
+}
+
+INTRINSICS_TARGET("pclmul,sse4.1")
+inline clmul_product clmul128_pclmul(const uint128_t& a, const uint128_t& b) noexcept
+{
+    const __m128i x = to_m128(a);
+    const __m128i y = to_m128(b);
+    const __m128i lo = _mm_clmulepi64_si128(x, y, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128(x, y, 0x11);
+    const __m128i mid =
+        _mm_xor_si128(_mm_clmulepi64_si128(x, y, 0x01), _mm_clmulepi64_si128(x, y, 0x10));
+    return {from_m128(_mm_xor_si128(hi, _mm_srli_si128(mid, 8))),
+            from_m128(_mm_xor_si128(lo, _mm_slli_si128(mid, 8)))};
+}
+
+INTRINSICS_TARGET("pclmul,sse4.1")
+inline uint128_t gf2_128_mul_pclmul(const uint128_t& a, const uint128_t& b) noexcept
+{
+    return gf2_128_reduce(clmul128_pclmul(a, b));
+}
+
+INTRINSICS_TARGET("pclmul,sse4.1") inline uint128_t gf2_128_square_pclmul(const uint128_t& a) noexcept
+{
+    const __m128i x = to_m128(a);
+    return gf2_128_reduce(
+        {from_m128(_mm_clmulepi64_si128(x, x, 0x11)), from_m128(_mm_clmulepi64_si128(x, x, 0x00))});
+}
+
+// Cadena de Itoh-Tsujii de gf2_128::inverse con los productos en línea
+INTRINSICS_TARGET("pclmul,sse4.1") inline uint128_t gf2_128_inverse_pclmul(const uint128_t& a) noexcept
+{
+    uint128_t b = a;
+    int k = 1;
+    for (int bit = 5; bit >= 0; --bit) {
+        uint128_t t = b;
+        for (int i = 0; i < k; ++i) {
+            t = gf2_128_square_pclmul(t);
+        }
+        b = gf2_128_mul_pclmul(t, b);
+        k *= 2;
+        if ((127 >> bit) & 1) {
+            b = gf2_128_mul_pclmul(gf2_128_square_pclmul(b), a);
+            k += 1;
+        }
+    }
+    return gf2_128_square_pclmul(b);
+}
+
+#endif
+
+inline uint128_t gf2_128_mul_runtime(const uint128_t& a, const uint128_t& b) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (detail::has_pclmul())
+        return gf2_128_mul_pclmul(a, b);
+#endif
+    return gf2_128_reduce(clmul128_soft(a, b));
+}
+
+inline uint128_t gf2_128_square_runtime(const uint128_t& a) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (detail::has_pclmul())
+        return gf2_128_square_pclmul(a);
+#endif
+    return gf2_128_reduce(clsquare128_soft(a));
+}
+
+} // namespace detail
+
+/**
+ * @brief Producto sin acarreo de dos palabras de 64 bits
+ */
+constexpr uint128_t clmul(uint64_t a, uint64_t b) noexcept
+{
+    if (std::is_constant_evaluated())
+        return detail::clmul64_soft(a, b);
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (detail::has_pclmul())
+        return detail::clmul64_pclmul(a, b);
+#endif
+    return detail::clmul64_soft(a, b);
+}
+
+/**
+ * @brief Producto sin acarreo de dos uint128_t (256 bits)
+ */
+constexpr clmul_product clmul_wide(const uint128_t& a, const uint128_t& b) noexcept
+{
+    if (std::is_constant_evaluated())
+        return detail::clmul128_soft(a, b);
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (detail::has_pclmul())
+        return detail::clmul128_pclmul(a, b);
+#endif
+    return detail::clmul128_soft(a, b);
+}
+
+/**
+ * @brief Elemento de GF(2^128) = GF(2)[x] / (x^128 + x^7 + x^2 + x + 1)
+ *
+ * La suma es XOR; el producto es clmul_wide seguido de la reducción.
+ */
+class gf2_128
+{
+  public:
+    constexpr gf2_128() noexcept = default;
+
+    /// Bit i de bits = coeficiente de x^i
+    constexpr explicit gf2_128(const uint128_t& bits) noexcept : bits_(bits) {}
+
+    static constexpr gf2_128 zero() noexcept
+    {
+        return gf2_128();
+    }
+
+    static constexpr gf2_128 one() noexcept
+    {
+        return gf2_128(uint128_t(1));
+    }
+
+    /// Bloque GCM/GHASH leído en big-endian (bit 127 = coeficiente de x^0)
+    static constexpr gf2_128 from_gcm(const uint128_t& block) noexcept
+    {
+        return gf2_128(uint128_bits::reverse_bits(block));
+    }
+
+    /// Inversa de from_gcm
+    constexpr uint128_t to_gcm() const noexcept
+    {
+        return uint128_bits::reverse_bits(bits_);
+    }
+
+    constexpr const uint128_t& value() const noexcept
+    {
+        return bits_;
+    }
+
+    constexpr bool is_zero() const noexcept
+    {
+        return bits_ == uint128_t(0);
+    }
+
+    friend constexpr gf2_128 operator+(const gf2_128& a, const gf2_128& b) noexcept
+    {
+        return gf2_128(a.bits_ ^ b.bits_);
+    }
+
+    /// En característica 2 la resta es la suma
+    friend constexpr gf2_128 operator-(const gf2_128& a, const gf2_128& b) noexcept
+    {
+        return a + b;
+    }
+
+    friend constexpr gf2_128 operator*(const gf2_128& a, const gf2_128& b) noexcept
+    {
+        if (std::is_constant_evaluated())
+            return gf2_128(detail::gf2_128_reduce(detail::clmul128_soft(a.bits_, b.bits_)));
+        return gf2_128(detail::gf2_128_mul_runtime(a.bits_, b.bits_));
+    }
+
+    /// @throws std::domain_error si b es cero
+    friend constexpr gf2_128 operator/(const gf2_128& a, const gf2_128& b)
+    {
+        return a * b.inverse();
+    }
+
+    constexpr gf2_128& operator+=(const gf2_128& other) noexcept
+    {
+        return *this = *this + other;
+    }
+
+    constexpr gf2_128& operator-=(const gf2_128& other) noexcept
+    {
+        return *this = *this + other;
+    }
+
+    constexpr gf2_128& operator*=(const gf2_128& other) noexcept
+    {
+        return *this = *this * other;
+    }
+
+    constexpr gf2_128& operator/=(const gf2_128& other)
+    {
+        return *this = *this / other;
+    }
+
+    friend constexpr bool operator==(const gf2_128&, const gf2_128&) = default;
+
+    /// Cuadrado: en software basta intercalar ceros entre los bits y reducir
+    constexpr gf2_128 square() const noexcept
+    {
+        if (std::is_constant_evaluated())
+            return gf2_128(detail::gf2_128_reduce(detail::clsquare128_soft(bits_)));
+        return gf2_128(detail::gf2_128_square_runtime(bits_));
+    }
+
+    /// this^(2^n)
+    constexpr gf2_128 square_n(int n) const noexcept
+    {
+        gf2_128 r = *this;
+        for (int i = 0; i < n; ++i) {
+            r = r.square();
+        }
+        return r;
+    }
+
+    /// Potencia por cuadrados y productos; pow(0) = 1
+    constexpr gf2_128 pow(const uint128_t& exponent) const noexcept
+    {
+        gf2_128 result = one();
+        gf2_128 base = *this;
+        uint128_t e = exponent;
+        while (e != uint128_t(0)) {
+            if ((e & uint128_t(1)) != uint128_t(0)) {
+                result *= base;
+            }
+            e >>= 1;
+            base = base.square();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Inverso multiplicativo: a^(2^128 - 2)
+     *
+     * Itoh-Tsujii: a^(2^127 - 1) con la cadena 1, 2, 3, 6, 7, ..., 126, 127
+     * (126 cuadrados y 12 productos) y un cuadrado final.
+     *
+     * @throws std::domain_error si el elemento es cero
+     */
+    constexpr gf2_128 inverse() const
+    {
+        if (is_zero()) {
+            throw std::domain_error("gf2_128::inverse: zero has no inverse");
+        }
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+        if (!std::is_constant_evaluated() && detail::has_pclmul()) {
+            return gf2_128(detail::gf2_128_inverse_pclmul(bits_));
+        }
+#endif
+        gf2_128 b = *this; // a^(2^k - 1), k = 1
+        int k = 1;
+        for (int bit = 5; bit >= 0; --bit) { // 127 = 0b1111111
+            b = b.square_n(k) * b;
+            k *= 2;
+            if ((127 >> bit) & 1) {
+                b = b.square() * *this;
+                k += 1;
+            }
+        }
+        return b.square();
+    }
+
+  private:
+    uint128_t bits_{};
+};
+
+// =============================================================================
+// CRC-64/XZ
+// =============================================================================
+
+namespace detail
+{
+
+/// ECMA-182 (x^64 + x^62 + x^57 + ...), bit i = coeficiente de x^i
+inline constexpr uint64_t crc64_poly = 0x42F0E1EBA9EA3693ULL;
+/// Mismo polinomio reflejado, el que usa la implementación LSB primero
+inline constexpr uint64_t crc64_poly_reflected = 0xC96C5795D7870F42ULL;
+
+constexpr uint64_t reverse64(uint64_t x) noexcept
+{
+    uint64_t r = 0;
+    for (int i = 0; i < 64; ++i) {
+        r = (r << 1) | ((x >> i) & 1);
+    }
+    return r;
+}
+
+// x^n mod P en representación reflejada: constante de plegado
+constexpr uint64_t crc64_xpow_mod(unsigned n) noexcept
+{
+    uint64_t r = 1;
+    for (unsigned i = 0; i < n; ++i) {
+        r = (r << 1) ^ ((r >> 63) != 0 ? crc64_poly : 0);
+    }
+    return reverse64(r);
+}
+
+// Constantes para plegar un bloque de 128 bits `bits` posiciones hacia
+// delante: la palabra baja (grado alto) se multiplica por x^(bits + 63) y la
+// alta por x^(bits - 1); el -1 compensa el desplazamiento del clmul reflejado
+struct crc64_fold_keys {
+    uint64_t low;
+    uint64_t high;
+};
+
+constexpr crc64_fold_keys crc64_fold_for(unsigned bits) noexcept
+{
+    return {crc64_xpow_mod(bits + 63), crc64_xpow_mod(bits - 1)};
+}
+
+using crc64_slice_tables = std::array<std::array<uint64_t, 256>, 8>;
+
+constexpr crc64_slice_tables make_crc64_tables() noexcept
+{
+    crc64_slice_tables t{};
+    for (unsigned i = 0; i < 256; ++i) {
+        uint64_t c = i;
+        for (int k = 0; k < 8; ++k) {
+            c = (c >> 1) ^ ((c & 1) != 0 ? crc64_poly_reflected : 0);
+        }
+        t[0][i] = c;
+    }
+    for (unsigned i = 0; i < 256; ++i) {
+        for (std::size_t s = 1; s < 8; ++s) {
+            t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+        }
+    }
+    return t;
+}
+
+inline constexpr crc64_slice_tables crc64_tables = make_crc64_tables();
+
+// Slice-by-8 sobre el registro (sin la inversión inicial y final)
+constexpr uint64_t crc64_update_soft(uint64_t crc, const std::byte* p, std::size_t n) noexcept
+{
+    const auto& t = crc64_tables;
+    for (; n >= 8; n -= 8, p += 8) {
+        uint64_t word = 0;
+        for (int i = 7; i >= 0; --i) {
+            word = (word << 8) | static_cast<uint64_t>(p[i]);
+        }
+        crc ^= word;
+        crc = t[7][crc & 0xFF] ^ t[6][(crc >> 8) & 0xFF] ^ t[5][(crc >> 16) & 0xFF] ^
+              t[4][(crc >> 24) & 0xFF] ^ t[3][(crc >> 32) & 0xFF] ^ t[2][(crc >> 40) & 0xFF] ^
+              t[1][(crc >> 48) & 0xFF] ^ t[0][crc >> 56];
+    }
+    for (; n > 0; --n, ++p) {
+        crc = (crc >> 8) ^ t[0][(crc ^ static_cast<uint64_t>(*p)) & 0xFF];
+    }
+    return crc;
+}
+
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+
+INTRINSICS_TARGET("pclmul,sse4.1") inline __m128i crc64_fold(__m128i x, __m128i keys) noexcept
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, keys, 0x00), _mm_clmulepi64_si128(x, keys, 0x11));
+}
+
+INTRINSICS_TARGET("pclmul,sse4.1") inline __m128i crc64_keys(crc64_fold_keys k) noexcept
+{
+    return _mm_set_epi64x(static_cast<long long>(k.high), static_cast<long long>(k.low));
+}
+
+// Resto de 128 bits pendiente + cola de bytes, por tablas
+INTRINSICS_TARGET("pclmul,sse4.1")
+inline uint64_t crc64_finish(__m128i x, const std::byte* p, std::size_t n) noexcept
+{
+    alignas(16) std::byte last[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(last), x);
+    return crc64_update_soft(crc64_update_soft(0, last, 16), p, n);
+}
+
+/// @pre n >= 64
+INTRINSICS_TARGET("pclmul,sse4.1")
+inline uint64_t crc64_update_pclmul(uint64_t crc, const std::byte* p, std::size_t n) noexcept
+{
+    constexpr crc64_fold_keys k128 = crc64_fold_for(128);
+    constexpr crc64_fold_keys k512 = crc64_fold_for(512);
+    const __m128i* v = reinterpret_cast<const __m128i*>(p);
+
+    // El registro inicial se suma a los primeros 8 bytes
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(v), _mm_cvtsi64_si128(static_cast<long long>(crc)));
+    __m128i x1 = _mm_loadu_si128(v + 1);
+    __m128i x2 = _mm_loadu_si128(v + 2);
+    __m128i x3 = _mm_loadu_si128(v + 3);
+    v += 4;
+    n -= 64;
+
+    const __m128i keys512 = crc64_keys(k512);
+    for (; n >= 64; n -= 64, v += 4) {
+        x0 = _mm_xor_si128(crc64_fold(x0, keys512), _mm_loadu_si128(v));
+        x1 = _mm_xor_si128(crc64_fold(x1, keys512), _mm_loadu_si128(v + 1));
+        x2 = _mm_xor_si128(crc64_fold(x2, keys512), _mm_loadu_si128(v + 2));
+        x3 = _mm_xor_si128(crc64_fold(x3, keys512), _mm_loadu_si128(v + 3));
+    }
+
+    const __m128i keys128 = crc64_keys(k128);
+    __m128i x = _mm_xor_si128(crc64_fold(x0, keys128), x1);
+    x = _mm_xor_si128(crc64_fold(x, keys128), x2);
+    x = _mm_xor_si128(crc64_fold(x, keys128), x3);
+    for (; n >= 16; n -= 16, ++v) {
+        x = _mm_xor_si128(crc64_fold(x, keys128), _mm_loadu_si128(v));
+    }
+    return crc64_finish(x, reinterpret_cast<const std::byte*>(v), n);
+}
+
+INTRINSICS_TARGET("vpclmulqdq,pclmul,avx2,sse4.1")
+inline __m256i crc64_fold256(__m256i x, __m256i keys) noexcept
+{
+    return _mm256_xor_si256(_mm256_clmulepi64_epi128(x, keys, 0x00),
+                            _mm256_clmulepi64_epi128(x, keys, 0x11));
+}
+
+INTRINSICS_TARGET("vpclmulqdq,pclmul,avx2,sse4.1") inline __m256i crc64_keys256(crc64_fold_keys k) noexcept
+{
+    return _mm256_set_epi64x(static_cast<long long>(k.high), static_cast<long long>(k.low),
+                             static_cast<long long>(k.high), static_cast<long long>(k.low));
+}
+
+/// Cuatro acumuladores de 256 bits (128 bytes por iteración); @pre n >= 128
+INTRINSICS_TARGET("vpclmulqdq,pclmul,avx2,sse4.1")
+inline uint64_t crc64_update_vpclmul(uint64_t crc, const std::byte* p, std::size_t n) noexcept
+{
+    constexpr crc64_fold_keys k128 = crc64_fold_for(128);
+    constexpr crc64_fold_keys k256 = crc64_fold_for(256);
+    constexpr crc64_fold_keys k1024 = crc64_fold_for(1024);
+    const __m256i* v = reinterpret_cast<const __m256i*>(p);
+
+    __m256i y0 = _mm256_xor_si256(_mm256_loadu_si256(v),
+                                  _mm256_zextsi128_si256(_mm_cvtsi64_si128(static_cast<long long>(crc))));
+    __m256i y1 = _mm256_loadu_si256(v + 1);
+    __m256i y2 = _mm256_loadu_si256(v + 2);
+    __m256i y3 = _mm256_loadu_si256(v + 3);
+    v += 4;
+    n -= 128;
+
+    const __m256i keys1024 = crc64_keys256(k1024);
+    for (; n >= 128; n -= 128, v += 4) {
+        y0 = _mm256_xor_si256(crc64_fold256(y0, keys1024), _mm256_loadu_si256(v));
+        y1 = _mm256_xor_si256(crc64_fold256(y1, keys1024), _mm256_loadu_si256(v + 1));
+        y2 = _mm256_xor_si256(crc64_fold256(y2, keys1024), _mm256_loadu_si256(v + 2));
+        y3 = _mm256_xor_si256(crc64_fold256(y3, keys1024), _mm256_loadu_si256(v + 3));
+    }
+
+    // Cada carril avanza dos bloques al plegar un acumulador sobre el siguiente
+    const __m256i keys256 = crc64_keys256(k256);
+    __m256i y = _mm256_xor_si256(crc64_fold256(y0, keys256), y1);
+    y = _mm256_xor_si256(crc64_fold256(y, keys256), y2);
+    y = _mm256_xor_si256(crc64_fold256(y, keys256), y3);
+    for (; n >= 32; n -= 32, ++v) {
+        y = _mm256_xor_si256(crc64_fold256(y, keys256), _mm256_loadu_si256(v));
+    }
+
+    __m128i x = _mm_xor_si128(crc64_fold(_mm256_castsi256_si128(y), crc64_keys(k128)),
+                              _mm256_extracti128_si256(y, 1));
+    const __m128i* w = reinterpret_cast<const __m128i*>(v);
+    if (n >= 16) {
+        x = _mm_xor_si128(crc64_fold(x, crc64_keys(k128)), _mm_loadu_si128(w));
+        ++w;
+        n -= 16;
+    }
+    return crc64_finish(x, reinterpret_cast<const std::byte*>(w), n);
+}
+
+#endif
+
+} // namespace detail
+
+/**
+ * @brief CRC-64/XZ (ECMA-182 reflejado, registro inicial y final invertidos)
+ *
+ * Encadenable como zlib: crc64(b, crc64(a)) == crc64(a seguido de b).
+ * crc64 de "123456789" = 0x995DC9BBDF1939FA.
+ *
+ * @param data Bytes a procesar
+ * @param crc CRC de los datos anteriores (0 para empezar)
+ */
+constexpr uint64_t crc64(std::span<const std::byte> data, uint64_t crc = 0) noexcept
+{
+    const std::byte* p = data.data();
+    const std::size_t n = data.size();
+    crc = ~crc;
+    if (!std::is_constant_evaluated()) {
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+        const auto& f = intrinsics::cpu();
+        if (n >= 256 && f.vpclmulqdq && f.avx2 && detail::has_pclmul()) {
+            return ~detail::crc64_update_vpclmul(crc, p, n);
+        }
+        if (n >= 64 && detail::has_pclmul()) {
+            return ~detail::crc64_update_pclmul(crc, p, n);
+        }
+#endif
+    }
+    return ~detail::crc64_update_soft(crc, p, n);
+}
+
+/**
+ * @brief CRC-64/XZ de bloques de 128 bits, cada uno como 16 bytes little-endian
+ */
+inline uint64_t crc64(std::span<const uint128_t> blocks, uint64_t crc = 0) noexcept
+{
+    if constexpr (std::endian::native == std::endian::little) {
+        return crc64(std::as_bytes(blocks), crc);
+    } else {
+        for (const uint128_t& b : blocks) {
+            std::byte bytes[16];
+            for (int i = 0; i < 8; ++i) {
+                bytes[i] = static_cast<std::byte>(b.low() >> (8 * i));
+                bytes[8 + i] = static_cast<std::byte>(b.high() >> (8 * i));
+            }
+            crc = crc64(std::span<const std::byte>(bytes), crc);
+        }
+        return crc;
+    }
+}
+
+} // namespace nstd
+
+#endif // UINT128_CLMUL_HPP
@@ -0,0 +1,254 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_COUNTER_GROUP_HPP
+#define UINT128_COUNTER_GROUP_HPP
+
+/**
+ * @file uint128_counter_group.hpp
+ * @brief Grupo de N contadores de 128 bits con instantánea consistente
+ *
+ * Para contadores relacionados (bytes de entrada y salida, peticiones,
+ * errores) que deben leerse juntos: leer N `ThreadSafeUint128` uno a uno da
+ * totales incoherentes entre sí, y bloquearlos todos frena a los escritores.
+ *
+ * Doble búfer por épocas sobre ranuras por hilo: cada hilo tiene, en su
+ * ranura alineada a línea de caché, dos bancos de N contadores (uno por
+ * paridad de época) y escribe en el de la época actual con una carga y un
+ * almacenamiento de 16 bytes, sin competir con nadie. Como en
+ * sharded_counter128, los hilos de más comparten ranuras de desbordamiento
+ * con fetch_add. snapshot() avanza la época, espera a que terminen los
+ * incrementos que empezaron en la anterior y suma a los totales los bancos
+ * ya inmóviles. Cada incremento entra entero en una instantánea: antes o
+ * después del corte, nunca a medias; add() con varios contadores es atómico
+ * respecto a las instantáneas.
+ *
+ * Memoria: 2 x ranuras x 2 x N x 16 bytes (64 KiB con 16 contadores y 32
+ * ranuras); snapshot() recorre todas las ranuras.
+ *
+ * @code{.cpp}
+ * enum { bytes_in, bytes_out, requests, errors };
+ * nstd::counter_group128<4> stats;
+ * stats.add({{bytes_in, uint128_t(n)}, {requests, uint128_t(1)}}); // En cualquier hilo
+ * auto totals = stats.snapshot();                                  // std::array<uint128_t, 4>
+ * @endcode
+ */
+
+#include "../int128/int128_t.hpp"
+#include "uint128_atomic.hpp"
+#include "uint128_sharded_counter.hpp"
+#include "uint128_t.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+
+namespace nstd
+{
+
+/**
+ * @brief N contadores de 128 bits con incrementos sin cerrojos e instantánea atómica
+ *
+ * Los escritores nunca esperan. snapshot() se serializa con un mutex propio y
+ * espera, como mucho, a los incrementos que ya estaban en curso al cambiar de
+ * época. Con más escritores activos que CPUs, un escritor desalojado a mitad
+ * de un incremento retrasa snapshot() hasta que el planificador lo reanuda.
+ */
+template <std::size_t N, atomic128_value T = uint128_t> class counter_group128
+{
+    static_assert(N > 0, "counter_group128 requires at least one counter");
+
+  public:
+    using value_type = T;
+    using snapshot_type = std::array<T, N>;
+
+    /// @param slots Ranuras exclusivas (0 = hardware_concurrency redondeado a
+    ///        potencia de 2); los hilos de más comparten otras tantas ranuras
+    explicit counter_group128(std::size_t slots = 0)
+        : slot_count_(slot_count_for(slots)), slots_(std::make_unique<slot[]>(2 * slot_count_))
+    {
+    }
+
+    counter_group128(const counter_group128&) = delete;
+    counter_group128& operator=(const counter_group128&) = delete;
+
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    /// Suma delta al contador i (módulo 2^128). @pre i < N
+    void add(std::size_t i, T delta) noexcept
+    {
+        write([&](bank& b, bool exclusive) { add_to(b[i], delta, exclusive); });
+    }
+
+    void sub(std::size_t i, T delta) noexcept
+    {
+        add(i, T(0) - delta);
+    }
+
+    void increment(std::size_t i) noexcept
+    {
+        add(i, T(1));
+    }
+
+    /// Varios contadores a la vez: ninguna instantánea ve sólo una parte
+    void add(std::initializer_list<std::pair<std::size_t, T>> deltas) noexcept
+    {
+        write([&](bank& b, bool exclusive) {
+            for (const auto& [i, delta] : deltas) {
+                add_to(b[i], delta, exclusive);
+            }
+        });
+    }
+
+    /// Un delta por contador (los ceros se saltan), atómico respecto a snapshot()
+    void add(std::span<const T, N> deltas) noexcept
+    {
+        write([&](bank& b, bool exclusive) {
+            for (std::size_t i = 0; i < N; ++i) {
+                if (deltas[i] != T(0)) {
+                    add_to(b[i], deltas[i], exclusive);
+                }
+            }
+        });
+    }
+
+    /// Valores de los N contadores en un mismo instante lógico
+    snapshot_type snapshot()
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        const uint64_t old = epoch_.load(std::memory_order_relaxed);
+        epoch_.store(old + 1, std::memory_order_seq_cst);
+
+        // Incrementos que empezaron en la época anterior
+        const std::size_t parity = old & 1;
+        exponential_backoff backoff;
+        for (std::size_t s = 0; s < 2 * slot_count_; ++s) {
+            slot& sl = slots_[s];
+            while (sl.active[parity].load(std::memory_order_seq_cst) != 0) {
+                backoff();
+            }
+            bank& b = sl.banks[parity];
+            for (std::size_t i = 0; i < N; ++i) {
+                totals_[i] += b[i].load(std::memory_order_relaxed);
+                b[i].store(T(0), std::memory_order_relaxed);
+            }
+        }
+        return totals_;
+    }
+
+    /// Pone todos los contadores a 0. @pre Ningún hilo está llamando a add()
+    void reset() noexcept
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        totals_.fill(T(0));
+        for (std::size_t s = 0; s < 2 * slot_count_; ++s) {
+            for (auto& b : slots_[s].banks) {
+                for (auto& c : b) {
+                    c.store(T(0), std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    std::size_t slot_count() const noexcept
+    {
+        return slot_count_;
+    }
+
+  private:
+    using bank = std::array<atomic128<T>, N>;
+
+    struct alignas(64) slot {
+        std::atomic<uint32_t> active[2] = {0, 0}; // Escritores en curso por paridad
+        bank banks[2];
+    };
+
+    static std::size_t slot_count_for(std::size_t requested) noexcept
+    {
+        if (requested == 0) {
+            requested = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return std::bit_ceil(requested);
+    }
+
+    /**
+     * Anunciarse en la ranura y volver a leer la época forman un Dekker con
+     * snapshot(), que cambia la época y después lee las ranuras (ambos
+     * seq_cst): o el escritor ve la época nueva y reintenta, o snapshot()
+     * ve al escritor y lo espera.
+     */
+    template <typename F> void write(F&& f) noexcept
+    {
+        const unsigned id = detail::this_thread_index();
+        const bool exclusive = id < slot_count_;
+        slot& s = slots_[exclusive ? id : slot_count_ + (id & (slot_count_ - 1))];
+        for (;;) {
+            const uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+            std::atomic<uint32_t>& active = s.active[epoch & 1];
+            active.fetch_add(1, std::memory_order_seq_cst);
+            if (epoch_.load(std::memory_order_seq_cst) == epoch) {
+                f(s.banks[epoch & 1], exclusive);
+                active.fetch_sub(1, std::memory_order_release);
+                return;
+            }
+            active.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Un único escritor: carga + almacenamiento, sin RMW
+    static void add_to(atomic128<T>& cell, T delta, bool exclusive) noexcept
+    {
+        if (exclusive) {
+            cell.store(cell.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        } else {
+            cell.fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t slot_count_;
+    std::unique_ptr<slot[]> slots_; // [exclusivas | desbordamiento]
+    alignas(64) std::atomic<uint64_t> epoch_{0};
+    std::mutex snapshot_mutex_;
+    snapshot_type totals_{}; // Protegido por snapshot_mutex_
+};
+
+template <std::size_t N> using uint128_counter_group = counter_group128<N, uint128_t>;
+template <std::size_t N> using int128_counter_group = counter_group128<N, int128_t>;
+
+} // namespace nstd
+
+#endif // UINT128_COUNTER_GROUP_HPP
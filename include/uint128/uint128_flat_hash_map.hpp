@@ -0,0 +1,807 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_FLAT_HASH_MAP_HPP
+#define UINT128_FLAT_HASH_MAP_HPP
+
+/**
+ * @file uint128_flat_hash_map.hpp
+ * @brief Tabla hash de direccionamiento abierto (estilo Swiss table) para claves de 128 bits
+ *
+ * `nstd::flat_hash_map<uint128_t, V>` guarda las claves en línea (sin nodos) y
+ * mantiene un array paralelo de bytes de control:
+ *
+ * - `kEmpty`   (0x80): hueco libre, termina la búsqueda
+ * - `kDeleted` (0xFE): tumba, la búsqueda continúa
+ * - `0..127`         : hueco ocupado, guarda los 7 bits bajos del hash (H2)
+ *
+ * La búsqueda compara H2 contra un grupo completo de bytes de control a la vez:
+ * 16 bytes con SSE2 (`_mm_cmpeq_epi8` + `_mm_movemask_epi8`) o 8 bytes con
+ * SWAR portable en el resto de arquitecturas. Sólo los candidatos cuyo H2
+ * coincide llegan a comparar la clave completa.
+ *
+ * El hash por defecto es nstd::hash (hash128 de uint128_traits.hpp); un hash
+ * débil rompe la suposición de que H1/H2 son independientes.
+ */
+
+#include "uint128_t.hpp"
+#include "uint128_traits.hpp"
+#include "../intrinsics/bit_operations.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UINT128_FLAT_HASH_MAP_SSE2 1
+#else
+#define UINT128_FLAT_HASH_MAP_SSE2 0
+#endif
+
+namespace nstd
+{
+
+namespace flat_hash_map_detail
+{
+
+using ctrl_t = int8_t;
+
+inline constexpr ctrl_t kEmpty = static_cast<ctrl_t>(-128);  // 0b10000000
+inline constexpr ctrl_t kDeleted = static_cast<ctrl_t>(-2);  // 0b11111110
+
+inline constexpr bool is_full(ctrl_t c) noexcept
+{
+    return c >= 0;
+}
+
+/**
+ * @brief Máscara de coincidencias dentro de un grupo
+ *
+ * Cada coincidencia ocupa `Shift + 1` bits (1 bit por byte con SSE2, 8 bits
+ * por byte con SWAR); iterar devuelve el índice de byte de cada coincidencia.
+ */
+template <typename Mask, int Shift> class bitmask
+{
+  private:
+    Mask mask_;
+
+  public:
+    explicit constexpr bitmask(Mask mask) noexcept : mask_(mask) {}
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return mask_ != 0;
+    }
+
+    constexpr int lowest() const noexcept
+    {
+        return intrinsics::ctz64(static_cast<uint64_t>(mask_)) >> Shift;
+    }
+
+    constexpr void clear_lowest() noexcept
+    {
+        mask_ &= static_cast<Mask>(mask_ - 1);
+    }
+};
+
+#if UINT128_FLAT_HASH_MAP_SSE2
+
+/**
+ * @brief Grupo de 16 bytes de control comparado con SSE2
+ */
+struct group {
+    static constexpr size_t width = 16;
+    using mask_type = bitmask<uint32_t, 0>;
+
+    __m128i ctrl;
+
+    explicit group(const ctrl_t* pos) noexcept
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)))
+    {
+    }
+
+    mask_type match(ctrl_t h2) const noexcept
+    {
+        const __m128i needle = _mm_set1_epi8(static_cast<char>(h2));
+        return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(needle, ctrl))));
+    }
+
+    mask_type match_empty() const noexcept
+    {
+        return match(kEmpty);
+    }
+
+    // kEmpty y kDeleted son los únicos bytes con el bit de signo activo
+    mask_type match_empty_or_deleted() const noexcept
+    {
+        return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(ctrl)));
+    }
+};
+
+#else
+
+/**
+ * @brief Grupo de 8 bytes de control comparado con SWAR (portable)
+ *
+ * `match()` puede dar falsos positivos cuando un byte vale h2 + 1 tras un
+ * préstamo; no importa porque cada candidato se verifica comparando la clave.
+ */
+struct group {
+    static constexpr size_t width = 8;
+    using mask_type = bitmask<uint64_t, 3>;
+
+    static constexpr uint64_t lsbs = 0x0101010101010101ULL;
+    static constexpr uint64_t msbs = 0x8080808080808080ULL;
+
+    uint64_t ctrl;
+
+    explicit group(const ctrl_t* pos) noexcept
+    {
+        std::memcpy(&ctrl, pos, sizeof(ctrl));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        ctrl = __builtin_bswap64(ctrl);
+#endif
+    }
+
+    mask_type match(ctrl_t h2) const noexcept
+    {
+        const uint64_t x = ctrl ^ (lsbs * static_cast<uint8_t>(h2));
+        return mask_type((x - lsbs) & ~x & msbs);
+    }
+
+    mask_type match_empty() const noexcept
+    {
+        // kEmpty es el único byte con el bit 7 activo y el bit 1 a cero
+        return mask_type(ctrl & ~(ctrl << 6) & msbs);
+    }
+
+    mask_type match_empty_or_deleted() const noexcept
+    {
+        return mask_type(ctrl & msbs);
+    }
+};
+
+#endif // UINT128_FLAT_HASH_MAP_SSE2
+
+} // namespace flat_hash_map_detail
+
+/**
+ * @brief Mapa hash plano (Swiss table) con claves en línea
+ *
+ * @tparam Key Tipo de clave (pensado para uint128_t / int128_t)
+ * @tparam T Tipo de valor
+ * @tparam Hash Función hash (por defecto nstd::hash<Key>)
+ * @tparam KeyEqual Comparación de igualdad
+ *
+ * Diferencias con std::unordered_map:
+ * - `value_type` es `std::pair<Key, T>` (no `pair<const Key, T>`); no se debe
+ *   modificar la clave a través de un iterador.
+ * - insert/erase/rehash invalidan iteradores y referencias.
+ * - Factor de carga máximo fijo de 7/8.
+ *
+ * Example:
+ * @code
+ * nstd::flat_hash_map<uint128_t, int> map;
+ * map[uint128_t(0x20010db800000000ULL, 1)] = 42;
+ * if (auto it = map.find(uint128_t(0x20010db800000000ULL, 1)); it != map.end()) {
+ *     int v = it->second;
+ * }
+ * @endcode
+ */
+template <typename Key, typename T, typename Hash = nstd::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class flat_hash_map
+{
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+  private:
+    using ctrl_t = flat_hash_map_detail::ctrl_t;
+    using group = flat_hash_map_detail::group;
+
+    static constexpr size_t group_width = group::width;
+    static constexpr size_t min_capacity = group_width;
+
+    ctrl_t* ctrl_ = nullptr;       // capacity_ + group_width bytes (los últimos reflejan el inicio)
+    value_type* slots_ = nullptr;  // capacity_ huecos sin inicializar
+    size_t capacity_ = 0;          // potencia de 2 (o 0)
+    size_t size_ = 0;
+    size_t growth_left_ = 0;       // inserciones posibles antes de rehash (cuenta las tumbas)
+    [[no_unique_address]] Hash hash_{};
+    [[no_unique_address]] KeyEqual eq_{};
+
+    // ------------------------------------------------------------------ helpers
+
+    static constexpr size_t max_load(size_t capacity) noexcept
+    {
+        return capacity - capacity / 8; // 7/8
+    }
+
+    static size_t capacity_for(size_t n) noexcept
+    {
+        size_t cap = min_capacity;
+        while (max_load(cap) < n) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    size_t hash_of(const Key& key) const noexcept(noexcept(std::declval<const Hash&>()(key)))
+    {
+        return static_cast<size_t>(hash_(key));
+    }
+
+    static constexpr size_t h1(size_t h) noexcept
+    {
+        return h >> 7;
+    }
+
+    static constexpr ctrl_t h2(size_t h) noexcept
+    {
+        return static_cast<ctrl_t>(h & 0x7F);
+    }
+
+    void set_ctrl(size_t i, ctrl_t c) noexcept
+    {
+        ctrl_[i] = c;
+        if (i < group_width) {
+            ctrl_[capacity_ + i] = c; // Copia para lecturas de grupo que dan la vuelta
+        }
+    }
+
+    /**
+     * @brief Secuencia de sondeo triangular en unidades de grupo
+     *
+     * Con capacidad potencia de 2 y pasos múltiplos de group_width, los
+     * números triangulares recorren todos los desplazamientos de grupo.
+     */
+    struct probe_seq {
+        size_t mask;
+        size_t offset;
+        size_t index = 0;
+
+        size_t at(size_t i) const noexcept
+        {
+            return (offset + i) & mask;
+        }
+
+        void next() noexcept
+        {
+            index += group_width;
+            offset = (offset + index) & mask;
+        }
+    };
+
+    probe_seq probe(size_t hash) const noexcept
+    {
+        return probe_seq{capacity_ - 1, h1(hash) & (capacity_ - 1)};
+    }
+
+    size_t find_index(const Key& key, size_t hash) const
+    {
+        if (capacity_ == 0) {
+            return capacity_;
+        }
+        probe_seq seq = probe(hash);
+        const ctrl_t tag = h2(hash);
+        while (true) {
+            const group g(ctrl_ + seq.offset);
+            for (auto m = g.match(tag); m; m.clear_lowest()) {
+                const size_t i = seq.at(static_cast<size_t>(m.lowest()));
+                if (eq_(slots_[i].first, key)) {
+                    return i;
+                }
+            }
+            if (g.match_empty()) {
+                return capacity_;
+            }
+            seq.next();
+        }
+    }
+
+    size_t find_insert_slot(size_t hash) const noexcept
+    {
+        probe_seq seq = probe(hash);
+        while (true) {
+            const group g(ctrl_ + seq.offset);
+            if (auto m = g.match_empty_or_deleted()) {
+                return seq.at(static_cast<size_t>(m.lowest()));
+            }
+            seq.next();
+        }
+    }
+
+    void allocate(size_t capacity)
+    {
+        capacity_ = capacity;
+        ctrl_ = new ctrl_t[capacity + group_width];
+        std::memset(ctrl_, static_cast<unsigned char>(flat_hash_map_detail::kEmpty),
+                    capacity + group_width);
+        slots_ = std::allocator<value_type>{}.allocate(capacity);
+        size_ = 0;
+        growth_left_ = max_load(capacity);
+    }
+
+    void destroy_and_deallocate() noexcept
+    {
+        if (capacity_ == 0) {
+            return;
+        }
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_t i = 0; i < capacity_; ++i) {
+                if (flat_hash_map_detail::is_full(ctrl_[i])) {
+                    std::destroy_at(slots_ + i);
+                }
+            }
+        }
+        std::allocator<value_type>{}.deallocate(slots_, capacity_);
+        delete[] ctrl_;
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+        growth_left_ = 0;
+    }
+
+    void rehash_to(size_t new_capacity)
+    {
+        ctrl_t* old_ctrl = ctrl_;
+        value_type* old_slots = slots_;
+        const size_t old_capacity = capacity_;
+        const size_t old_size = size_;
+
+        allocate(new_capacity);
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (flat_hash_map_detail::is_full(old_ctrl[i])) {
+                const size_t hash = hash_of(old_slots[i].first);
+                const size_t dst = find_insert_slot(hash);
+                set_ctrl(dst, h2(hash));
+                std::construct_at(slots_ + dst, std::move(old_slots[i]));
+                std::destroy_at(old_slots + i);
+            }
+        }
+        size_ = old_size;
+        growth_left_ = max_load(capacity_) - size_;
+
+        if (old_capacity != 0) {
+            std::allocator<value_type>{}.deallocate(old_slots, old_capacity);
+            delete[] old_ctrl;
+        }
+    }
+
+    // Crece al doble, o rehace en la misma capacidad si la mitad son tumbas
+    void grow_if_needed()
+    {
+        if (growth_left_ > 0) {
+            return;
+        }
+        if (capacity_ == 0) {
+            allocate(min_capacity);
+        } else if (size_ * 2 <= max_load(capacity_)) {
+            rehash_to(capacity_);
+        } else {
+            rehash_to(capacity_ * 2);
+        }
+    }
+
+    template <typename K, typename... Args>
+    std::pair<size_t, bool> emplace_unique(K&& key, Args&&... args)
+    {
+        size_t hash = hash_of(key);
+        size_t i = find_index(key, hash);
+        if (i != capacity_) {
+            return {i, false};
+        }
+        // key puede apuntar a un elemento de este mapa: copiarla antes de que
+        // grow_if_needed() libere slots_
+        key_type k(std::forward<K>(key));
+        grow_if_needed();
+        i = find_insert_slot(hash);
+        if (ctrl_[i] == flat_hash_map_detail::kEmpty) {
+            --growth_left_; // Reutilizar una tumba no consume crecimiento
+        }
+        std::construct_at(slots_ + i, std::piecewise_construct, std::forward_as_tuple(std::move(k)),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+        set_ctrl(i, h2(hash));
+        ++size_;
+        return {i, true};
+    }
+
+  public:
+    // ------------------------------------------------------------------ iteradores
+
+    template <bool Const> class basic_iterator
+    {
+        friend class flat_hash_map;
+        using map_ptr = std::conditional_t<Const, const flat_hash_map*, flat_hash_map*>;
+
+        map_ptr map_ = nullptr;
+        size_t index_ = 0;
+
+        basic_iterator(map_ptr map, size_t index) noexcept : map_(map), index_(index)
+        {
+            skip_empty();
+        }
+
+        void skip_empty() noexcept
+        {
+            while (index_ < map_->capacity_ && !flat_hash_map_detail::is_full(map_->ctrl_[index_])) {
+                ++index_;
+            }
+        }
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = flat_hash_map::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        basic_iterator() noexcept = default;
+
+        // iterator -> const_iterator
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) noexcept
+            : map_(other.map_), index_(other.index_)
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return map_->slots_[index_];
+        }
+
+        pointer operator->() const noexcept
+        {
+            return map_->slots_ + index_;
+        }
+
+        basic_iterator& operator++() noexcept
+        {
+            ++index_;
+            skip_empty();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            basic_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept
+        {
+            return a.index_ == b.index_;
+        }
+
+        friend class basic_iterator<!Const>;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // ------------------------------------------------------------------ construcción
+
+    flat_hash_map() noexcept(std::is_nothrow_default_constructible_v<Hash> &&
+                             std::is_nothrow_default_constructible_v<KeyEqual>) = default;
+
+    explicit flat_hash_map(size_t bucket_count, const Hash& hash = Hash(),
+                           const KeyEqual& eq = KeyEqual())
+        : hash_(hash), eq_(eq)
+    {
+        reserve(bucket_count);
+    }
+
+    flat_hash_map(std::initializer_list<value_type> init) : flat_hash_map(init.size())
+    {
+        for (const auto& v : init) {
+            insert(v);
+        }
+    }
+
+    flat_hash_map(const flat_hash_map& other) : hash_(other.hash_), eq_(other.eq_)
+    {
+        reserve(other.size_);
+        for (const auto& v : other) {
+            insert(v);
+        }
+    }
+
+    flat_hash_map(flat_hash_map&& other) noexcept
+        : ctrl_(std::exchange(other.ctrl_, nullptr)), slots_(std::exchange(other.slots_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)), size_(std::exchange(other.size_, 0)),
+          growth_left_(std::exchange(other.growth_left_, 0)), hash_(std::move(other.hash_)),
+          eq_(std::move(other.eq_))
+    {
+    }
+
+    flat_hash_map& operator=(const flat_hash_map& other)
+    {
+        if (this != &other) {
+            flat_hash_map tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    flat_hash_map& operator=(flat_hash_map&& other) noexcept
+    {
+        if (this != &other) {
+            destroy_and_deallocate();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~flat_hash_map()
+    {
+        destroy_and_deallocate();
+    }
+
+    void swap(flat_hash_map& other) noexcept
+    {
+        using std::swap;
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(size_, other.size_);
+        swap(growth_left_, other.growth_left_);
+        swap(hash_, other.hash_);
+        swap(eq_, other.eq_);
+    }
+
+    // ------------------------------------------------------------------ capacidad
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept
+    {
+        return iterator(this, capacity_);
+    }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, capacity_);
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+    size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+    float load_factor() const noexcept
+    {
+        return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_);
+    }
+    static constexpr float max_load_factor() noexcept
+    {
+        return 0.875f;
+    }
+
+    /**
+     * @brief Garantiza espacio para `n` elementos sin rehash
+     */
+    void reserve(size_t n)
+    {
+        if (n == 0) {
+            return;
+        }
+        const size_t cap = capacity_for(n);
+        if (cap > capacity_) {
+            rehash_to(cap);
+        }
+    }
+
+    void clear() noexcept
+    {
+        if (capacity_ == 0) {
+            return;
+        }
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_t i = 0; i < capacity_; ++i) {
+                if (flat_hash_map_detail::is_full(ctrl_[i])) {
+                    std::destroy_at(slots_ + i);
+                }
+            }
+        }
+        std::memset(ctrl_, static_cast<unsigned char>(flat_hash_map_detail::kEmpty),
+                    capacity_ + group_width);
+        size_ = 0;
+        growth_left_ = max_load(capacity_);
+    }
+
+    // ------------------------------------------------------------------ modificadores
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        auto [i, inserted] = emplace_unique(value.first, value.second);
+        return {iterator(this, i), inserted};
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        auto [i, inserted] = emplace_unique(std::move(value.first), std::move(value.second));
+        return {iterator(this, i), inserted};
+    }
+
+    template <typename... Args> std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        auto [i, inserted] = emplace_unique(key, std::forward<Args>(args)...);
+        return {iterator(this, i), inserted};
+    }
+
+    template <typename... Args> std::pair<iterator, bool> emplace(const Key& key, Args&&... args)
+    {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    template <typename M> std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        auto [i, inserted] = emplace_unique(key, std::forward<M>(obj));
+        if (!inserted) {
+            slots_[i].second = std::forward<M>(obj);
+        }
+        return {iterator(this, i), inserted};
+    }
+
+    T& operator[](const Key& key)
+    {
+        const size_t i = emplace_unique(key).first; // Puede reasignar slots_
+        return slots_[i].second;
+    }
+
+    /**
+     * @brief Elimina la clave si existe (deja una tumba)
+     * @return Número de elementos eliminados (0 o 1)
+     */
+    size_t erase(const Key& key)
+    {
+        const size_t i = find_index(key, hash_of(key));
+        if (i == capacity_) {
+            return 0;
+        }
+        erase_at(i);
+        return 1;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        erase_at(pos.index_);
+        return iterator(this, pos.index_ + 1);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+  private:
+    void erase_at(size_t i) noexcept
+    {
+        std::destroy_at(slots_ + i);
+        set_ctrl(i, flat_hash_map_detail::kDeleted);
+        --size_;
+    }
+
+  public:
+    // ------------------------------------------------------------------ búsqueda
+
+    iterator find(const Key& key)
+    {
+        return iterator(this, find_index(key, hash_of(key)));
+    }
+
+    const_iterator find(const Key& key) const
+    {
+        return const_iterator(this, find_index(key, hash_of(key)));
+    }
+
+    bool contains(const Key& key) const
+    {
+        return find_index(key, hash_of(key)) != capacity_;
+    }
+
+    size_t count(const Key& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    T& at(const Key& key)
+    {
+        const size_t i = find_index(key, hash_of(key));
+        if (i == capacity_) {
+            throw std::out_of_range("flat_hash_map::at: key not found");
+        }
+        return slots_[i].second;
+    }
+
+    const T& at(const Key& key) const
+    {
+        const size_t i = find_index(key, hash_of(key));
+        if (i == capacity_) {
+            throw std::out_of_range("flat_hash_map::at: key not found");
+        }
+        return slots_[i].second;
+    }
+
+    hasher hash_function() const
+    {
+        return hash_;
+    }
+
+    key_equal key_eq() const
+    {
+        return eq_;
+    }
+};
+
+template <typename K, typename T, typename H, typename E>
+void swap(flat_hash_map<K, T, H, E>& a, flat_hash_map<K, T, H, E>& b) noexcept
+{
+    a.swap(b);
+}
+
+} // namespace nstd
+
+#endif // UINT128_FLAT_HASH_MAP_HPP
@@ -0,0 +1,276 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_ID_ALLOCATOR_HPP
+#define UINT128_ID_ALLOCATOR_HPP
+
+/**
+ * @file uint128_id_allocator.hpp
+ * @brief Generador de identificadores únicos de 128 bits con reserva por bloques
+ *
+ * Cada hilo reserva un bloque de block_size secuencias con un único
+ * fetch_add de 128 bits sobre el contador común y las entrega después sin
+ * ninguna sincronización. Con bloques de 1024 el contador común se toca una
+ * vez cada 1024 identificadores, frente a un mutex por identificador con
+ * `ThreadSafeUint128::fetch_add(1)`.
+ *
+ * Cada identificador se compone de un nodo en los bits altos y una secuencia
+ * en los `sequence_bits` bits bajos:
+ *
+ *     id = (node_id << sequence_bits) | secuencia
+ *
+ * Garantías:
+ * - Ningún identificador se entrega dos veces (mientras el generador viva y,
+ *   entre reinicios, si se continúa desde high_water()).
+ * - Los identificadores de un mismo hilo son estrictamente crecientes.
+ * - Entre hilos no hay orden global, y los bloques a medio usar al terminar
+ *   un hilo pasan al siguiente hilo que reciba su índice.
+ * - Al agotar el espacio de secuencias next() lanza std::overflow_error y
+ *   try_next() devuelve std::nullopt: nunca se vuelve a empezar desde 0.
+ *   La secuencia con todos los bits a 1 no se entrega nunca; marca el
+ *   espacio agotado.
+ *
+ * @code{.cpp}
+ * nstd::id_allocator128 ids({.block_size = 4096, .sequence_bits = 96, .node_id = 17});
+ * uint128_t id = ids.next();          // En cualquier hilo
+ * uint128_t node = ids.node_of(id);   // 17
+ * @endcode
+ */
+
+#include "uint128_atomic.hpp"
+#include "uint128_sharded_counter.hpp"
+#include "uint128_t.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+namespace nstd
+{
+
+/// Configuración de id_allocator128 (admite inicializadores designados)
+struct id_allocator_options {
+    uint64_t block_size = 1024;     ///< Secuencias reservadas por cada fetch_add
+    unsigned sequence_bits = 128;   ///< Bits bajos para la secuencia (1-128)
+    uint128_t node_id = 0;          ///< Bits altos; debe caber en 128 - sequence_bits
+    uint128_t first_sequence = 0;   ///< Primera secuencia (p. ej. high_water() anterior)
+    std::size_t cached_threads = 0; ///< Hilos con bloque propio (0 = 2 x hardware_concurrency)
+};
+
+/// Rango de identificadores consecutivos [first, first + count)
+struct id_block {
+    uint128_t first = 0;
+    uint64_t count = 0;
+
+    bool empty() const noexcept
+    {
+        return count == 0;
+    }
+
+    uint128_t operator[](uint64_t i) const noexcept
+    {
+        return first + uint128_t(i);
+    }
+};
+
+/**
+ * @brief Generador de identificadores de 128 bits, único y sin cerrojos
+ *
+ * next() y try_next() desde cualquier hilo. Los primeros cached_threads
+ * hilos (por índice de hilo denso, reutilizable) guardan su bloque en una
+ * ranura propia alineada a línea de caché; los hilos restantes (y los que
+ * no se pudieron registrar) reservan un bloque de un solo identificador en
+ * cada llamada.
+ */
+class id_allocator128
+{
+  public:
+    /// @throws std::invalid_argument si block_size es 0, sequence_bits no
+    ///         está en [1, 128], node_id no cabe o first_sequence no es válida
+    explicit id_allocator128(const id_allocator_options& options = {})
+        : block_size_(options.block_size), sequence_bits_(options.sequence_bits),
+          node_id_(options.node_id),
+          node_prefix_(options.sequence_bits < 128 ? options.node_id << options.sequence_bits
+                                                   : uint128_t(0)),
+          sequence_mask_(options.sequence_bits < 128
+                             ? (uint128_t(1) << options.sequence_bits) - uint128_t(1)
+                             : ~uint128_t(0)),
+          slot_count_(options.cached_threads != 0
+                          ? options.cached_threads
+                          : 2 * std::max(1u, std::thread::hardware_concurrency())),
+          slots_(std::make_unique<slot[]>(slot_count_)), sequence_(options.first_sequence)
+    {
+        if (block_size_ == 0) {
+            throw std::invalid_argument("id_allocator128: block_size must be positive");
+        }
+        if (sequence_bits_ == 0 || sequence_bits_ > 128) {
+            throw std::invalid_argument("id_allocator128: sequence_bits must be in [1, 128]");
+        }
+        if (sequence_bits_ == 128 ? node_id_ != uint128_t(0)
+                                  : (node_prefix_ >> sequence_bits_) != node_id_) {
+            throw std::invalid_argument("id_allocator128: node_id does not fit");
+        }
+        if (options.first_sequence > sequence_mask_) {
+            throw std::invalid_argument("id_allocator128: first_sequence out of range");
+        }
+    }
+
+    id_allocator128(const id_allocator128&) = delete;
+    id_allocator128& operator=(const id_allocator128&) = delete;
+
+    /// Siguiente identificador del hilo actual
+    /// @throws std::overflow_error si el espacio de secuencias está agotado
+    uint128_t next()
+    {
+        if (const auto id = try_next()) {
+            return *id;
+        }
+        throw std::overflow_error("id_allocator128: sequence space exhausted");
+    }
+
+    /// Siguiente identificador, o std::nullopt si el espacio está agotado
+    std::optional<uint128_t> try_next() noexcept
+    {
+        bool cached = false;
+        unsigned index = 0;
+        try {
+            index = detail::this_thread_index();
+            cached = index < slot_count_;
+        } catch (...) {
+            // Registrar el hilo puede fallar (bad_alloc): sin bloque propio
+        }
+        if (!cached) {
+            const id_block b = reserve(1);
+            return b.empty() ? std::nullopt : std::optional<uint128_t>(b.first);
+        }
+        slot& s = slots_[index];
+        if (s.used == s.block.count) {
+            s.block = reserve(block_size_);
+            s.used = 0;
+            if (s.block.empty()) {
+                return std::nullopt;
+            }
+        }
+        return s.block[s.used++];
+    }
+
+    /**
+     * @brief Reserva directamente hasta n identificadores consecutivos
+     *
+     * No pasa por el bloque del hilo. Cerca del final del espacio el bloque
+     * puede traer menos de n identificadores; vacío si ya está agotado.
+     */
+    id_block reserve(uint64_t n) noexcept
+    {
+        const uint128_t limit = sequence_mask_; // Nunca se entrega: marca de agotado
+        if (n == 0 || sequence_.load(std::memory_order_relaxed) == limit) {
+            return {};
+        }
+        uint64_t granted = 0;
+        const uint128_t start = sequence_.fetch_update(
+            [&](uint128_t cur) {
+                const uint128_t left = limit - cur;
+                granted = left < uint128_t(n) ? left.low() : n;
+                return cur + uint128_t(granted);
+            },
+            std::memory_order_relaxed);
+        return {node_prefix_ | start, granted};
+    }
+
+    /// Secuencias aún sin reservar (no incluye las guardadas en bloques de hilo)
+    uint128_t remaining() const noexcept
+    {
+        return sequence_mask_ - sequence_.load(std::memory_order_relaxed);
+    }
+
+    /// true si el contador común ya no puede entregar más bloques
+    bool exhausted() const noexcept
+    {
+        return remaining() == uint128_t(0);
+    }
+
+    /**
+     * @brief Primera secuencia no reservada
+     *
+     * Guardarla y pasarla como first_sequence al reiniciar evita repetir
+     * identificadores; los bloques sin terminar se pierden como huecos.
+     */
+    uint128_t high_water() const noexcept
+    {
+        return sequence_.load(std::memory_order_acquire);
+    }
+
+    uint128_t node_of(uint128_t id) const noexcept
+    {
+        return sequence_bits_ < 128 ? id >> sequence_bits_ : uint128_t(0);
+    }
+
+    uint128_t sequence_of(uint128_t id) const noexcept
+    {
+        return id & sequence_mask_;
+    }
+
+    uint128_t node_id() const noexcept
+    {
+        return node_id_;
+    }
+
+    unsigned sequence_bits() const noexcept
+    {
+        return sequence_bits_;
+    }
+
+    uint64_t block_size() const noexcept
+    {
+        return block_size_;
+    }
+
+  private:
+    // Sólo la escribe el hilo con ese índice; el registro de índices ordena
+    // el traspaso cuando un hilo nuevo hereda la ranura. El camino rápido sólo
+    // incrementa `used`: reescribir un uint128_t por mitades y releerlo
+    // entero provoca un fallo de reenvío de almacenamiento en cada llamada
+    struct alignas(64) slot {
+        id_block block;
+        uint64_t used = 0;
+    };
+
+    uint64_t block_size_;
+    unsigned sequence_bits_;
+    uint128_t node_id_;
+    uint128_t node_prefix_;
+    uint128_t sequence_mask_;
+    std::size_t slot_count_;
+    std::unique_ptr<slot[]> slots_;
+    alignas(64) atomic128<uint128_t> sequence_;
+};
+
+} // namespace nstd
+
+#endif // UINT128_ID_ALLOCATOR_HPP
@@ -0,0 +1,504 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_MERSENNE_HPP
+#define UINT128_MERSENNE_HPP
+
+/**
+ * @file uint128_mersenne.hpp
+ * @brief Aritmética módulo 2^p - 1 sin divisiones, Lucas-Lehmer y hash polinómico
+ *
+ * - `mersenne_mod<P>`: enteros módulo M_P = 2^P - 1 (2 <= P <= 127). Como
+ *   2^P = 1 (mod M_P), x = hi * 2^P + lo se reduce a hi + lo: el producto de
+ *   256 bits se pliega con desplazamientos, máscaras y una suma, sin `%`.
+ *   Multiplicar por 2^k es una rotación de P bits.
+ * - `lucas_lehmer(p)`: test de primalidad de M_p para p <= 127, con el
+ *   cuadrado de 256 bits (tres productos de 64x64) y la misma reducción.
+ * - `polynomial_hash` y `rolling_hash<P>`: hash de Karp-Rabin módulo
+ *   2^61 - 1 (`mersenne61`) o 2^127 - 1 (`mersenne127`).
+ *
+ * Con P <= 63 todo cabe en una palabra: un producto 64x64 y el plegado en
+ * 64 bits. Todas las funciones son constexpr.
+ *
+ * @code{.cpp}
+ * static_assert(nstd::lucas_lehmer(127));
+ * nstd::mersenne127 base(nstd::uniform_uint128_distribution()(rng)); // Base aleatoria
+ * auto h = nstd::polynomial_hash(std::string_view("abracadabra"), base);
+ * nstd::rolling_hash<127> window(base, 4);   // Ventanas de 4 símbolos
+ * @endcode
+ */
+
+#include "../intrinsics/arithmetic_operations.hpp"
+#include "uint128_t.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace nstd
+{
+
+namespace detail
+{
+
+/// Producto de 256 bits: high * 2^128 + low
+struct mersenne_wide {
+    uint128_t high;
+    uint128_t low;
+};
+
+constexpr mersenne_wide mersenne_mul_wide(const uint128_t& a, const uint128_t& b) noexcept
+{
+    uint64_t h00 = 0, h01 = 0, h10 = 0, h11 = 0;
+    const uint64_t l00 = intrinsics::umul128(a.low(), b.low(), &h00);
+    const uint64_t l01 = intrinsics::umul128(a.low(), b.high(), &h01);
+    const uint64_t l10 = intrinsics::umul128(a.high(), b.low(), &h10);
+    const uint64_t l11 = intrinsics::umul128(a.high(), b.high(), &h11);
+    const uint128_t mid = uint128_t(0, h00) + uint128_t(0, l01) + uint128_t(0, l10);
+    return {uint128_t(h11, l11) + uint128_t(0, h01) + uint128_t(0, h10) + uint128_t(0, mid.high()),
+            uint128_t(mid.low(), l00)};
+}
+
+/// Cuadrado de 256 bits: el producto cruzado se calcula una vez y se duplica
+constexpr mersenne_wide mersenne_square_wide(const uint128_t& a) noexcept
+{
+    uint64_t h00 = 0, hc = 0, h11 = 0;
+    const uint64_t l00 = intrinsics::umul128(a.low(), a.low(), &h00);
+    const uint64_t lc = intrinsics::umul128(a.low(), a.high(), &hc);
+    const uint64_t l11 = intrinsics::umul128(a.high(), a.high(), &h11);
+    const uint128_t cross = uint128_t(hc, lc) << 1;
+    const uint128_t mid = uint128_t(0, h00) + uint128_t(0, cross.low());
+    return {uint128_t(h11, l11) + uint128_t(hc >> 63, cross.high()) + uint128_t(0, mid.high()),
+            uint128_t(mid.low(), l00)};
+}
+
+/**
+ * @brief x >= m ? x - m : x sin saltos, para x < 2m y m < 2^127
+ *
+ * Tras una suma o una resta la condición sale cierta la mitad de las veces
+ * con datos aleatorios (un hash), y un salto fallaría mucho. Si x < m,
+ * x - m da la vuelta y deja el bit 127 a 1; con x >= m es x - m < m y ese
+ * bit está a 0. En 64 bits basta el operador ?: (CMOV).
+ */
+constexpr uint128_t mersenne_csub(const uint128_t& x, const uint128_t& m) noexcept
+{
+    const uint128_t t = x - m;
+    return t + (m & (uint128_t(0) - (t >> 127)));
+}
+
+/**
+ * @brief x mod (2^p - 1) para x = high * 2^128 + low < 2^(2p)
+ *
+ * Dos plegados x -> (x & M) + (x >> p) dejan x <= M; el caso x == M es el cero.
+ */
+constexpr uint128_t mersenne_fold(const uint128_t& high, const uint128_t& low, unsigned p) noexcept
+{
+    const uint128_t m = (uint128_t(1) << p) - uint128_t(1);
+    uint128_t t = (low & m) + ((low >> p) | (high << (128 - p)));
+    t = (t & m) + (t >> p);
+    return t >= m ? t - m : t; // Sólo t == M o M + 1: salto casi nunca tomado
+}
+
+/// Igual que mersenne_fold para p <= 63: el producto cabe en 128 bits
+constexpr uint64_t mersenne_fold64(uint64_t high, uint64_t low, unsigned p) noexcept
+{
+    const uint64_t m = (uint64_t(1) << p) - 1;
+    uint64_t t = (low & m) + ((low >> p) | (high << (64 - p)));
+    t = (t & m) + (t >> p);
+    return t >= m ? t - m : t;
+}
+
+/// a * b mod (2^p - 1), con a, b < 2^p - 1
+constexpr uint128_t mersenne_mul(const uint128_t& a, const uint128_t& b, unsigned p) noexcept
+{
+    if (p <= 63) {
+        uint64_t high = 0;
+        const uint64_t low = intrinsics::umul128(a.low(), b.low(), &high);
+        return uint128_t(0, mersenne_fold64(high, low, p));
+    }
+    const mersenne_wide w = mersenne_mul_wide(a, b);
+    return mersenne_fold(w.high, w.low, p);
+}
+
+/// a^2 mod (2^p - 1), con a < 2^p - 1
+constexpr uint128_t mersenne_square(const uint128_t& a, unsigned p) noexcept
+{
+    if (p <= 63) {
+        uint64_t high = 0;
+        const uint64_t low = intrinsics::umul128(a.low(), a.low(), &high);
+        return uint128_t(0, mersenne_fold64(high, low, p));
+    }
+    const mersenne_wide w = mersenne_square_wide(a);
+    return mersenne_fold(w.high, w.low, p);
+}
+
+/// x mod (2^p - 1) para cualquier x de 128 bits
+constexpr uint128_t mersenne_reduce(uint128_t x, unsigned p) noexcept
+{
+    const uint128_t m = (uint128_t(1) << p) - uint128_t(1);
+    if (p >= 64) {
+        // x >> p < 2^64 <= 2^p: dos plegados bastan, sin bucle
+        x = (x & m) + (x >> p);
+        x = (x & m) + (x >> p);
+    } else {
+        while ((x >> p) != uint128_t(0)) {
+            x = (x & m) + (x >> p);
+        }
+    }
+    return x >= m ? x - m : x;
+}
+
+} // namespace detail
+
+/**
+ * @brief Test de Lucas-Lehmer: ¿es primo 2^p - 1?
+ *
+ * s_0 = 4, s_{i+1} = s_i^2 - 2 mod M_p; M_p es primo si y sólo si
+ * s_{p-2} = 0 (p primo impar). Si p es compuesto, M_p también lo es y se
+ * responde sin iterar. Cada paso es un cuadrado de 256 bits y un plegado.
+ *
+ * @throws std::invalid_argument si p > 127
+ */
+constexpr bool lucas_lehmer(unsigned p)
+{
+    if (p > 127) {
+        throw std::invalid_argument("lucas_lehmer: p must be at most 127");
+    }
+    if (p < 2) {
+        return false;
+    }
+    if (p == 2) {
+        return true; // M_2 = 3
+    }
+    for (unsigned d = 2; d * d <= p; ++d) {
+        if (p % d == 0) {
+            return false; // 2^d - 1 divide a 2^p - 1
+        }
+    }
+    const uint128_t m = (uint128_t(1) << p) - uint128_t(1);
+    uint128_t s(4);
+    for (unsigned i = 0; i < p - 2; ++i) {
+        s = detail::mersenne_square(s, p);
+        s = s >= uint128_t(2) ? s - uint128_t(2) : s + m - uint128_t(2);
+    }
+    return s == uint128_t(0);
+}
+
+/**
+ * @brief Entero módulo M_P = 2^P - 1
+ *
+ * El valor se guarda reducido en [0, M_P). La suma y la resta son una
+ * comparación y una corrección; el producto, uno (P <= 63) o cuatro
+ * productos de 64x64 y dos plegados.
+ */
+template <unsigned P> class mersenne_mod
+{
+    static_assert(P >= 2 && P <= 127, "mersenne_mod: P must be in [2, 127]");
+
+  public:
+    static constexpr unsigned exponent = P;
+
+    /// M_P = 2^P - 1
+    static constexpr uint128_t modulus() noexcept
+    {
+        return (uint128_t(1) << P) - uint128_t(1);
+    }
+
+    /// M_P es primo (evaluado con lucas_lehmer en compilación)
+    static constexpr bool is_prime = lucas_lehmer(P);
+
+    constexpr mersenne_mod() noexcept = default;
+
+    /// Reduce x módulo M_P
+    constexpr explicit mersenne_mod(const uint128_t& x) noexcept : value_(detail::mersenne_reduce(x, P))
+    {
+    }
+
+    static constexpr mersenne_mod zero() noexcept
+    {
+        return mersenne_mod();
+    }
+
+    static constexpr mersenne_mod one() noexcept
+    {
+        return mersenne_mod(uint128_t(1));
+    }
+
+    constexpr const uint128_t& value() const noexcept
+    {
+        return value_;
+    }
+
+    constexpr bool is_zero() const noexcept
+    {
+        return value_ == uint128_t(0);
+    }
+
+    friend constexpr mersenne_mod operator+(const mersenne_mod& a, const mersenne_mod& b) noexcept
+    {
+        if constexpr (P <= 63) {
+            const uint64_t m = modulus().low();
+            const uint64_t sum = a.value_.low() + b.value_.low();
+            return from_reduced(uint128_t(0, sum >= m ? sum - m : sum));
+        }
+        // a + b < 2 M_P: no desborda
+        return from_reduced(detail::mersenne_csub(a.value_ + b.value_, modulus()));
+    }
+
+    friend constexpr mersenne_mod operator-(const mersenne_mod& a, const mersenne_mod& b) noexcept
+    {
+        if constexpr (P <= 63) {
+            const uint64_t m = modulus().low();
+            const uint64_t diff = a.value_.low() - b.value_.low();
+            return from_reduced(uint128_t(0, a.value_.low() >= b.value_.low() ? diff : diff + m));
+        }
+        return from_reduced(detail::mersenne_csub(a.value_ + modulus() - b.value_, modulus()));
+    }
+
+    constexpr mersenne_mod operator-() const noexcept
+    {
+        return from_reduced(is_zero() ? value_ : modulus() - value_);
+    }
+
+    friend constexpr mersenne_mod operator*(const mersenne_mod& a, const mersenne_mod& b) noexcept
+    {
+        return from_reduced(detail::mersenne_mul(a.value_, b.value_, P));
+    }
+
+    /// @throws std::domain_error si b es cero
+    friend constexpr mersenne_mod operator/(const mersenne_mod& a, const mersenne_mod& b)
+        requires is_prime
+    {
+        return a * b.inverse();
+    }
+
+    constexpr mersenne_mod& operator+=(const mersenne_mod& other) noexcept
+    {
+        return *this = *this + other;
+    }
+
+    constexpr mersenne_mod& operator-=(const mersenne_mod& other) noexcept
+    {
+        return *this = *this - other;
+    }
+
+    constexpr mersenne_mod& operator*=(const mersenne_mod& other) noexcept
+    {
+        return *this = *this * other;
+    }
+
+    constexpr mersenne_mod& operator/=(const mersenne_mod& other)
+        requires is_prime
+    {
+        return *this = *this / other;
+    }
+
+    friend constexpr bool operator==(const mersenne_mod&, const mersenne_mod&) = default;
+
+    /// Cuadrado: tres productos de 64x64 en lugar de cuatro
+    constexpr mersenne_mod square() const noexcept
+    {
+        return from_reduced(detail::mersenne_square(value_, P));
+    }
+
+    /// this * 2^k: como 2^P = 1, es una rotación de los P bits del valor
+    constexpr mersenne_mod mul_pow2(unsigned k) const noexcept
+    {
+        k %= P;
+        if (k == 0) {
+            return *this;
+        }
+        // La rotación conserva los unos: un valor < M_P no puede pasar a M_P
+        return from_reduced(((value_ << k) | (value_ >> (P - k))) & modulus());
+    }
+
+    /// Potencia por cuadrados y productos; pow(0) = 1
+    constexpr mersenne_mod pow(const uint128_t& exponent) const noexcept
+    {
+        mersenne_mod result = one();
+        mersenne_mod base = *this;
+        uint128_t e = exponent;
+        while (e != uint128_t(0)) {
+            if ((e & uint128_t(1)) != uint128_t(0)) {
+                result *= base;
+            }
+            e >>= 1;
+            base = base.square();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Inverso multiplicativo: a^(M_P - 2) (Fermat; sólo si M_P es primo)
+     *
+     * @throws std::domain_error si el elemento es cero
+     */
+    constexpr mersenne_mod inverse() const
+        requires is_prime
+    {
+        if (is_zero()) {
+            throw std::domain_error("mersenne_mod::inverse: zero has no inverse");
+        }
+        return pow(modulus() - uint128_t(2));
+    }
+
+  private:
+    static constexpr mersenne_mod from_reduced(const uint128_t& v) noexcept
+    {
+        mersenne_mod r;
+        r.value_ = v;
+        return r;
+    }
+
+    uint128_t value_{};
+};
+
+using mersenne61 = mersenne_mod<61>;
+using mersenne127 = mersenne_mod<127>;
+
+// =============================================================================
+// HASH POLINÓMICO
+// =============================================================================
+
+namespace detail
+{
+
+/// Símbolo entero como elemento de mersenne_mod<P> (los negativos, sin signo)
+template <unsigned P, std::integral T> constexpr mersenne_mod<P> mersenne_symbol(T c) noexcept
+{
+    return mersenne_mod<P>(uint128_t(static_cast<uint64_t>(static_cast<std::make_unsigned_t<T>>(c))));
+}
+
+} // namespace detail
+
+/**
+ * @brief Hash de Karp-Rabin: seed * b^n + sum(data[i] * b^(n - 1 - i))
+ *
+ * Con seed el hash de un prefijo, el resultado es el hash de la
+ * concatenación. Horner encadena un producto por símbolo; a partir de 8
+ * símbolos se reparten en cuatro cadenas independientes con paso b^4, que
+ * se combinan al final, para no quedar limitados por la latencia del producto.
+ *
+ * Los símbolos nulos iniciales no cambian el hash: si importan, súmese 1 a
+ * cada símbolo. La base debe elegirse al azar para que la probabilidad de
+ * colisión entre dos cadenas de longitud n sea como mucho n / M_P.
+ */
+template <unsigned P, std::integral T>
+constexpr mersenne_mod<P> polynomial_hash(std::span<const T> data, const mersenne_mod<P>& base,
+                                          const mersenne_mod<P>& seed = mersenne_mod<P>()) noexcept
+{
+    std::size_t i = 0;
+    mersenne_mod<P> h = seed;
+    if (data.size() >= 8) {
+        const mersenne_mod<P> b2 = base.square();
+        const mersenne_mod<P> b3 = b2 * base;
+        const mersenne_mod<P> b4 = b2.square();
+        mersenne_mod<P> h0, h1, h2;
+        mersenne_mod<P> h3 = seed; // seed * b^(4k) acaba con coeficiente 1
+        for (; i + 4 <= data.size(); i += 4) {
+            h0 = h0 * b4 + detail::mersenne_symbol<P>(data[i]);
+            h1 = h1 * b4 + detail::mersenne_symbol<P>(data[i + 1]);
+            h2 = h2 * b4 + detail::mersenne_symbol<P>(data[i + 2]);
+            h3 = h3 * b4 + detail::mersenne_symbol<P>(data[i + 3]);
+        }
+        h = h0 * b3 + h1 * b2 + h2 * base + h3;
+    }
+    for (; i < data.size(); ++i) {
+        h = h * base + detail::mersenne_symbol<P>(data[i]);
+    }
+    return h;
+}
+
+/// polynomial_hash sobre los bytes de una cadena
+template <unsigned P>
+constexpr mersenne_mod<P> polynomial_hash(std::string_view text, const mersenne_mod<P>& base,
+                                          const mersenne_mod<P>& seed = mersenne_mod<P>()) noexcept
+{
+    return polynomial_hash(std::span<const char>(text.data(), text.size()), base, seed);
+}
+
+/**
+ * @brief Hash de Karp-Rabin sobre una ventana deslizante de `window` símbolos
+ *
+ * push() añade símbolos hasta llenar la ventana; roll(out, in) la desplaza
+ * una posición con dos productos: h = h * b + in - out * b^window. value()
+ * coincide con polynomial_hash de los símbolos de la ventana.
+ */
+template <unsigned P> class rolling_hash
+{
+  public:
+    constexpr rolling_hash(const mersenne_mod<P>& base, std::size_t window) noexcept
+        : base_(base), out_factor_(base.pow(uint128_t(0, window))), window_(window)
+    {
+    }
+
+    /// Añade un símbolo sin sacar ninguno (llenado de la ventana)
+    template <std::integral T> constexpr void push(T in) noexcept
+    {
+        hash_ = hash_ * base_ + detail::mersenne_symbol<P>(in);
+    }
+
+    /// Saca `out` (el símbolo más antiguo) y añade `in`
+    template <std::integral T> constexpr void roll(T out, T in) noexcept
+    {
+        // in - out * b^window no depende de hash_: fuera de la cadena de latencia
+        hash_ = hash_ * base_ +
+                (detail::mersenne_symbol<P>(in) - detail::mersenne_symbol<P>(out) * out_factor_);
+    }
+
+    constexpr void reset() noexcept
+    {
+        hash_ = mersenne_mod<P>();
+    }
+
+    constexpr const mersenne_mod<P>& value() const noexcept
+    {
+        return hash_;
+    }
+
+    constexpr const mersenne_mod<P>& base() const noexcept
+    {
+        return base_;
+    }
+
+    constexpr std::size_t window() const noexcept
+    {
+        return window_;
+    }
+
+  private:
+    mersenne_mod<P> base_;
+    mersenne_mod<P> out_factor_; // base^window
+    mersenne_mod<P> hash_;
+    std::size_t window_;
+};
+
+} // namespace nstd
+
+#endif // UINT128_MERSENNE_HPP
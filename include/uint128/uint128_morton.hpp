@@ -0,0 +1,693 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_MORTON_HPP
+#define UINT128_MORTON_HPP
+
+/**
+ * @file uint128_morton.hpp
+ * @brief Claves espaciales de 128 bits: orden Z (Morton) y curva de Hilbert
+ *
+ * - `morton2_encode(x, y)`: dos coordenadas de 64 bits intercaladas (x en
+ *   los bits pares, y en los impares).
+ * - `morton3_encode(x, y, z)`: tres coordenadas de 42 bits (126 bits).
+ * - `morton4_encode(x, y, z, w)`: cuatro coordenadas de 32 bits.
+ * - `hilbert2_encode(x, y)`: índice en la curva de Hilbert de orden 64.
+ *
+ * Cada una tiene su decodificador y versiones por lotes sobre std::span.
+ * Ordenar por la clave uint128_t (p. ej. con una ordenación radix de 128
+ * bits) agrupa puntos cercanos sin comparar claves de varios campos.
+ *
+ * Morton usa PDEP/PEXT cuando la CPU los tiene rápidos
+ * (`intrinsics::cpu().fast_pdep`) y, si no, el esparcido por máscaras
+ * mágicas; las dos rutas dan el mismo resultado. Hilbert recorre una máquina
+ * de 4 estados con tablas de 4 bits por coordenada (16 pasos por clave).
+ *
+ * @code{.cpp}
+ * uint128_t key = nstd::morton2_encode(x, y);
+ * auto [x2, y2] = nstd::morton2_decode(key);
+ * nstd::hilbert2_encode(std::span(xs), std::span(ys), std::span(keys));
+ * @endcode
+ */
+
+#include "../intrinsics/cpu_features.hpp"
+#include "uint128_t.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace nstd
+{
+
+namespace detail
+{
+
+// =============================================================================
+// Esparcido por máscaras mágicas
+// =============================================================================
+
+// 32 bits -> bits pares de 64
+constexpr uint64_t morton_spread2(uint64_t x) noexcept
+{
+    x &= 0xFFFFFFFFULL;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+}
+
+constexpr uint64_t morton_compact2(uint64_t x) noexcept
+{
+    x &= 0x5555555555555555ULL;
+    x = (x | (x >> 1)) & 0x3333333333333333ULL;
+    x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+    return x;
+}
+
+// 21 bits -> bits 0, 3, ..., 60
+constexpr uint64_t morton_spread3(uint64_t x) noexcept
+{
+    x &= 0x1FFFFFULL;
+    x = (x | (x << 32)) & 0x001F00000000FFFFULL;
+    x = (x | (x << 16)) & 0x001F0000FF0000FFULL;
+    x = (x | (x << 8)) & 0x100F00F00F00F00FULL;
+    x = (x | (x << 4)) & 0x10C30C30C30C30C3ULL;
+    x = (x | (x << 2)) & 0x1249249249249249ULL;
+    return x;
+}
+
+constexpr uint64_t morton_compact3(uint64_t x) noexcept
+{
+    x &= 0x1249249249249249ULL;
+    x = (x | (x >> 2)) & 0x10C30C30C30C30C3ULL;
+    x = (x | (x >> 4)) & 0x100F00F00F00F00FULL;
+    x = (x | (x >> 8)) & 0x001F0000FF0000FFULL;
+    x = (x | (x >> 16)) & 0x001F00000000FFFFULL;
+    x = (x | (x >> 32)) & 0x00000000001FFFFFULL;
+    return x;
+}
+
+// 16 bits -> bits 0, 4, ..., 60
+constexpr uint64_t morton_spread4(uint64_t x) noexcept
+{
+    x &= 0xFFFFULL;
+    x = (x | (x << 24)) & 0x000000FF000000FFULL;
+    x = (x | (x << 12)) & 0x000F000F000F000FULL;
+    x = (x | (x << 6)) & 0x0303030303030303ULL;
+    x = (x | (x << 3)) & 0x1111111111111111ULL;
+    return x;
+}
+
+constexpr uint64_t morton_compact4(uint64_t x) noexcept
+{
+    x &= 0x1111111111111111ULL;
+    x = (x | (x >> 3)) & 0x0303030303030303ULL;
+    x = (x | (x >> 6)) & 0x000F000F000F000FULL;
+    x = (x | (x >> 12)) & 0x000000FF000000FFULL;
+    x = (x | (x >> 24)) & 0x000000000000FFFFULL;
+    return x;
+}
+
+constexpr uint128_t morton2_soft(uint64_t x, uint64_t y) noexcept
+{
+    return uint128_t(morton_spread2(x >> 32) | (morton_spread2(y >> 32) << 1),
+                     morton_spread2(x) | (morton_spread2(y) << 1));
+}
+
+constexpr std::array<uint64_t, 2> morton2_decode_soft(const uint128_t& key) noexcept
+{
+    const uint64_t lo = key.low();
+    const uint64_t hi = key.high();
+    return {morton_compact2(lo) | (morton_compact2(hi) << 32),
+            morton_compact2(lo >> 1) | (morton_compact2(hi >> 1) << 32)};
+}
+
+// La coordenada c de morton3 ocupa los bits 3i + c: los 21 bits bajos caen
+// en 0..62 y los 21 altos a partir del 63, a caballo entre las dos mitades
+constexpr void morton3_spread_into(uint64_t v, int c, uint64_t& lo, uint64_t& hi) noexcept
+{
+    const uint64_t a = morton_spread3(v);
+    const uint64_t b = morton_spread3(v >> 21);
+    const uint64_t wide_lo = a | (b << 63);
+    const uint64_t wide_hi = b >> 1;
+    lo |= wide_lo << c;
+    hi |= (wide_hi << c) | (c == 0 ? 0 : wide_lo >> (64 - c));
+}
+
+constexpr uint64_t morton3_compact_from(uint64_t lo, uint64_t hi, int c) noexcept
+{
+    const uint64_t low_part = c == 0 ? lo : (lo >> c) | (hi << (64 - c));
+    const uint64_t high_part = c == 0 ? (lo >> 63) | (hi << 1) : hi >> (c - 1);
+    return morton_compact3(low_part) | (morton_compact3(high_part) << 21);
+}
+
+constexpr uint128_t morton3_soft(uint64_t x, uint64_t y, uint64_t z) noexcept
+{
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    morton3_spread_into(x, 0, lo, hi);
+    morton3_spread_into(y, 1, lo, hi);
+    morton3_spread_into(z, 2, lo, hi);
+    return uint128_t(hi, lo);
+}
+
+constexpr std::array<uint64_t, 3> morton3_decode_soft(const uint128_t& key) noexcept
+{
+    const uint64_t lo = key.low();
+    const uint64_t hi = key.high();
+    return {morton3_compact_from(lo, hi, 0), morton3_compact_from(lo, hi, 1),
+            morton3_compact_from(lo, hi, 2)};
+}
+
+constexpr uint128_t morton4_soft(uint32_t x, uint32_t y, uint32_t z, uint32_t w) noexcept
+{
+    return uint128_t(morton_spread4(x >> 16) | (morton_spread4(y >> 16) << 1) |
+                         (morton_spread4(z >> 16) << 2) | (morton_spread4(w >> 16) << 3),
+                     morton_spread4(x) | (morton_spread4(y) << 1) | (morton_spread4(z) << 2) |
+                         (morton_spread4(w) << 3));
+}
+
+constexpr std::array<uint32_t, 4> morton4_decode_soft(const uint128_t& key) noexcept
+{
+    std::array<uint32_t, 4> c{};
+    for (int i = 0; i < 4; ++i) {
+        c[i] = static_cast<uint32_t>(morton_compact4(key.low() >> i) |
+                                     (morton_compact4(key.high() >> i) << 16));
+    }
+    return c;
+}
+
+// =============================================================================
+// PDEP / PEXT
+// =============================================================================
+
+// Máscaras de la coordenada c de morton3 en cada mitad y bits en la mitad baja
+struct morton3_masks {
+    uint64_t low;
+    uint64_t high;
+    int low_bits;
+};
+
+constexpr morton3_masks morton3_mask_for(int c) noexcept
+{
+    morton3_masks m{0, 0, 0};
+    for (int i = 0; i < 42; ++i) {
+        const int bit = 3 * i + c;
+        if (bit < 64) {
+            m.low |= uint64_t(1) << bit;
+            ++m.low_bits;
+        } else {
+            m.high |= uint64_t(1) << (bit - 64);
+        }
+    }
+    return m;
+}
+
+inline constexpr morton3_masks morton3_mask[3] = {morton3_mask_for(0), morton3_mask_for(1),
+                                                  morton3_mask_for(2)};
+
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+
+namespace morton_bmi2
+{
+
+constexpr uint64_t even = 0x5555555555555555ULL;
+constexpr uint64_t nibble = 0x1111111111111111ULL;
+
+INTRINSICS_TARGET("bmi2") inline uint128_t encode2(uint64_t x, uint64_t y) noexcept
+{
+    return uint128_t(_pdep_u64(x >> 32, even) | _pdep_u64(y >> 32, even << 1),
+                     _pdep_u64(x, even) | _pdep_u64(y, even << 1));
+}
+
+INTRINSICS_TARGET("bmi2") inline std::array<uint64_t, 2> decode2(const uint128_t& key) noexcept
+{
+    const uint64_t lo = key.low();
+    const uint64_t hi = key.high();
+    return {_pext_u64(lo, even) | (_pext_u64(hi, even) << 32),
+            _pext_u64(lo, even << 1) | (_pext_u64(hi, even << 1) << 32)};
+}
+
+INTRINSICS_TARGET("bmi2") inline uint128_t encode3(uint64_t x, uint64_t y, uint64_t z) noexcept
+{
+    const uint64_t c[3] = {x, y, z};
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    for (int i = 0; i < 3; ++i) {
+        lo |= _pdep_u64(c[i], morton3_mask[i].low);
+        hi |= _pdep_u64(c[i] >> morton3_mask[i].low_bits, morton3_mask[i].high);
+    }
+    return uint128_t(hi, lo);
+}
+
+INTRINSICS_TARGET("bmi2") inline std::array<uint64_t, 3> decode3(const uint128_t& key) noexcept
+{
+    std::array<uint64_t, 3> c{};
+    for (int i = 0; i < 3; ++i) {
+        c[i] = _pext_u64(key.low(), morton3_mask[i].low) |
+               (_pext_u64(key.high(), morton3_mask[i].high) << morton3_mask[i].low_bits);
+    }
+    return c;
+}
+
+INTRINSICS_TARGET("bmi2")
+inline uint128_t encode4(uint32_t x, uint32_t y, uint32_t z, uint32_t w) noexcept
+{
+    const uint32_t c[4] = {x, y, z, w};
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    for (int i = 0; i < 4; ++i) {
+        lo |= _pdep_u64(c[i], nibble << i);
+        hi |= _pdep_u64(c[i] >> 16, nibble << i);
+    }
+    return uint128_t(hi, lo);
+}
+
+INTRINSICS_TARGET("bmi2") inline std::array<uint32_t, 4> decode4(const uint128_t& key) noexcept
+{
+    std::array<uint32_t, 4> c{};
+    for (int i = 0; i < 4; ++i) {
+        c[i] = static_cast<uint32_t>(_pext_u64(key.low(), nibble << i) |
+                                     (_pext_u64(key.high(), nibble << i) << 16));
+    }
+    return c;
+}
+
+// Lotes: el bucle entero se compila con BMI2 para que los núcleos se expandan en línea
+INTRINSICS_TARGET("bmi2")
+inline void encode2_batch(const uint64_t* x, const uint64_t* y, uint128_t* out, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = encode2(x[i], y[i]);
+    }
+}
+
+INTRINSICS_TARGET("bmi2")
+inline void decode2_batch(const uint128_t* keys, uint64_t* x, uint64_t* y, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto c = decode2(keys[i]);
+        x[i] = c[0];
+        y[i] = c[1];
+    }
+}
+
+INTRINSICS_TARGET("bmi2")
+inline void encode3_batch(const uint64_t* x, const uint64_t* y, const uint64_t* z, uint128_t* out,
+                          std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = encode3(x[i], y[i], z[i]);
+    }
+}
+
+INTRINSICS_TARGET("bmi2")
+inline void decode3_batch(const uint128_t* keys, uint64_t* x, uint64_t* y, uint64_t* z,
+                          std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto c = decode3(keys[i]);
+        x[i] = c[0];
+        y[i] = c[1];
+        z[i] = c[2];
+    }
+}
+
+} // namespace morton_bmi2
+
+#endif
+
+inline bool morton_use_pdep() noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    return intrinsics::cpu().fast_pdep;
+#else
+    return false;
+#endif
+}
+
+// =============================================================================
+// Hilbert: máquina de 4 estados (intercambio de ejes, inversión de ambos)
+// =============================================================================
+
+// encode[estado, 4 bits de x, 4 bits de y] = 8 bits de índice | estado siguiente << 8
+// decode[estado, 8 bits de índice] = 4 bits de x | 4 bits de y << 4 | estado siguiente << 8
+struct hilbert_tables {
+    std::array<uint16_t, 1024> encode;
+    std::array<uint16_t, 1024> decode;
+};
+
+constexpr hilbert_tables make_hilbert_tables() noexcept
+{
+    hilbert_tables t{};
+    for (unsigned state = 0; state < 4; ++state) {
+        for (unsigned xy = 0; xy < 256; ++xy) {
+            // Codificación: (x, y) en el sistema de ejes del estado -> cuadrante
+            unsigned swap = state & 1;
+            unsigned flip = state >> 1;
+            unsigned digits = 0;
+            for (int b = 3; b >= 0; --b) {
+                unsigned rx = ((xy >> 4) >> b) & 1;
+                unsigned ry = (xy >> b) & 1;
+                rx ^= flip;
+                ry ^= flip;
+                if (swap != 0) {
+                    const unsigned tmp = rx;
+                    rx = ry;
+                    ry = tmp;
+                }
+                digits = (digits << 2) | ((3 * rx) ^ ry);
+                if (ry == 0) {
+                    swap ^= 1;
+                    flip ^= rx;
+                }
+            }
+            t.encode[state << 8 | xy] = static_cast<uint16_t>(digits | (swap | flip << 1) << 8);
+
+            // Decodificación: cuadrante -> (x, y)
+            swap = state & 1;
+            flip = state >> 1;
+            unsigned x = 0;
+            unsigned y = 0;
+            for (int b = 3; b >= 0; --b) {
+                const unsigned q = (xy >> (2 * b)) & 3;
+                const unsigned rx = q >> 1;
+                const unsigned ry = (q ^ rx) & 1;
+                unsigned bx = swap != 0 ? ry : rx;
+                unsigned by = swap != 0 ? rx : ry;
+                x |= (bx ^ flip) << b;
+                y |= (by ^ flip) << b;
+                if (ry == 0) {
+                    swap ^= 1;
+                    flip ^= rx;
+                }
+            }
+            t.decode[state << 8 | xy] = static_cast<uint16_t>(x | y << 4 | (swap | flip << 1) << 8);
+        }
+    }
+    return t;
+}
+
+inline constexpr hilbert_tables hilbert_table = make_hilbert_tables();
+
+} // namespace detail
+
+// =============================================================================
+// Morton
+// =============================================================================
+
+/**
+ * @brief Clave Morton 2D: x en los bits pares, y en los impares
+ */
+constexpr uint128_t morton2_encode(uint64_t x, uint64_t y) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (!std::is_constant_evaluated() && detail::morton_use_pdep()) {
+        return detail::morton_bmi2::encode2(x, y);
+    }
+#endif
+    return detail::morton2_soft(x, y);
+}
+
+/// @return {x, y}
+constexpr std::array<uint64_t, 2> morton2_decode(const uint128_t& key) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (!std::is_constant_evaluated() && detail::morton_use_pdep()) {
+        return detail::morton_bmi2::decode2(key);
+    }
+#endif
+    return detail::morton2_decode_soft(key);
+}
+
+/**
+ * @brief Clave Morton 3D: el bit i de x, y, z va a 3i, 3i+1, 3i+2
+ *
+ * Usa los 42 bits bajos de cada coordenada (126 bits de clave); los
+ * superiores se ignoran.
+ */
+constexpr uint128_t morton3_encode(uint64_t x, uint64_t y, uint64_t z) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (!std::is_constant_evaluated() && detail::morton_use_pdep()) {
+        return detail::morton_bmi2::encode3(x, y, z);
+    }
+#endif
+    return detail::morton3_soft(x, y, z);
+}
+
+/// @return {x, y, z}, cada una de 42 bits
+constexpr std::array<uint64_t, 3> morton3_decode(const uint128_t& key) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (!std::is_constant_evaluated() && detail::morton_use_pdep()) {
+        return detail::morton_bmi2::decode3(key);
+    }
+#endif
+    return detail::morton3_decode_soft(key);
+}
+
+/**
+ * @brief Clave Morton 4D: el bit i de x, y, z, w va a 4i, ..., 4i+3
+ */
+constexpr uint128_t morton4_encode(uint32_t x, uint32_t y, uint32_t z, uint32_t w) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (!std::is_constant_evaluated() && detail::morton_use_pdep()) {
+        return detail::morton_bmi2::encode4(x, y, z, w);
+    }
+#endif
+    return detail::morton4_soft(x, y, z, w);
+}
+
+/// @return {x, y, z, w}
+constexpr std::array<uint32_t, 4> morton4_decode(const uint128_t& key) noexcept
+{
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (!std::is_constant_evaluated() && detail::morton_use_pdep()) {
+        return detail::morton_bmi2::decode4(key);
+    }
+#endif
+    return detail::morton4_decode_soft(key);
+}
+
+// =============================================================================
+// Hilbert
+// =============================================================================
+
+/**
+ * @brief Índice de (x, y) en la curva de Hilbert 2D de orden 64
+ *
+ * Claves consecutivas corresponden a celdas adyacentes. La orientación es la
+ * del algoritmo clásico xy2d con n = 2^64: el índice 0 es (0, 0) y el
+ * último, (2^64 - 1, 0).
+ */
+constexpr uint128_t hilbert2_encode(uint64_t x, uint64_t y) noexcept
+{
+    const auto& table = detail::hilbert_table.encode;
+    unsigned state = 0;
+    uint64_t half[2] = {0, 0};
+    for (int h = 0; h < 2; ++h) {
+        for (int shift = 60 - 32 * h; shift >= 32 - 32 * h; shift -= 4) {
+            const unsigned xy = static_cast<unsigned>(((x >> shift) & 15) << 4 | ((y >> shift) & 15));
+            const unsigned e = table[state << 8 | xy];
+            half[h] = (half[h] << 8) | (e & 0xFF);
+            state = e >> 8;
+        }
+    }
+    return uint128_t(half[0], half[1]);
+}
+
+/// @return {x, y}
+constexpr std::array<uint64_t, 2> hilbert2_decode(const uint128_t& index) noexcept
+{
+    const auto& table = detail::hilbert_table.decode;
+    unsigned state = 0;
+    uint64_t x = 0;
+    uint64_t y = 0;
+    const uint64_t half[2] = {index.high(), index.low()};
+    for (int h = 0; h < 2; ++h) {
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            const unsigned d = table[state << 8 | static_cast<unsigned>((half[h] >> shift) & 0xFF)];
+            x = (x << 4) | (d & 15);
+            y = (y << 4) | ((d >> 4) & 15);
+            state = d >> 8;
+        }
+    }
+    return {x, y};
+}
+
+// =============================================================================
+// Lotes
+// =============================================================================
+
+namespace detail
+{
+
+inline void morton_check_sizes(std::size_t a, std::size_t b, const char* what)
+{
+    if (a != b) {
+        throw std::invalid_argument(what);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief out[i] = morton2_encode(x[i], y[i])
+ * @throws std::invalid_argument si los tamaños difieren
+ */
+inline void morton2_encode(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                           std::span<uint128_t> out)
+{
+    detail::morton_check_sizes(x.size(), y.size(), "morton2_encode: coordinate sizes differ");
+    detail::morton_check_sizes(x.size(), out.size(), "morton2_encode: output size differs");
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (detail::morton_use_pdep()) {
+        detail::morton_bmi2::encode2_batch(x.data(), y.data(), out.data(), out.size());
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = detail::morton2_soft(x[i], y[i]);
+    }
+}
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline void morton2_decode(std::span<const uint128_t> keys, std::span<uint64_t> x,
+                           std::span<uint64_t> y)
+{
+    detail::morton_check_sizes(keys.size(), x.size(), "morton2_decode: output size differs");
+    detail::morton_check_sizes(keys.size(), y.size(), "morton2_decode: output size differs");
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (detail::morton_use_pdep()) {
+        detail::morton_bmi2::decode2_batch(keys.data(), x.data(), y.data(), keys.size());
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto c = detail::morton2_decode_soft(keys[i]);
+        x[i] = c[0];
+        y[i] = c[1];
+    }
+}
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline void morton3_encode(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                           std::span<const uint64_t> z, std::span<uint128_t> out)
+{
+    detail::morton_check_sizes(x.size(), y.size(), "morton3_encode: coordinate sizes differ");
+    detail::morton_check_sizes(x.size(), z.size(), "morton3_encode: coordinate sizes differ");
+    detail::morton_check_sizes(x.size(), out.size(), "morton3_encode: output size differs");
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (detail::morton_use_pdep()) {
+        detail::morton_bmi2::encode3_batch(x.data(), y.data(), z.data(), out.data(), out.size());
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = detail::morton3_soft(x[i], y[i], z[i]);
+    }
+}
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline void morton3_decode(std::span<const uint128_t> keys, std::span<uint64_t> x,
+                           std::span<uint64_t> y, std::span<uint64_t> z)
+{
+    detail::morton_check_sizes(keys.size(), x.size(), "morton3_decode: output size differs");
+    detail::morton_check_sizes(keys.size(), y.size(), "morton3_decode: output size differs");
+    detail::morton_check_sizes(keys.size(), z.size(), "morton3_decode: output size differs");
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (detail::morton_use_pdep()) {
+        detail::morton_bmi2::decode3_batch(keys.data(), x.data(), y.data(), z.data(), keys.size());
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto c = detail::morton3_decode_soft(keys[i]);
+        x[i] = c[0];
+        y[i] = c[1];
+        z[i] = c[2];
+    }
+}
+
+/**
+ * @brief Morton 4D por lotes; cada punto es {x, y, z, w}
+ * @throws std::invalid_argument si los tamaños difieren
+ */
+inline void morton4_encode(std::span<const std::array<uint32_t, 4>> points, std::span<uint128_t> out)
+{
+    detail::morton_check_sizes(points.size(), out.size(), "morton4_encode: output size differs");
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        const auto& p = points[i];
+        out[i] = morton4_encode(p[0], p[1], p[2], p[3]);
+    }
+}
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline void morton4_decode(std::span<const uint128_t> keys, std::span<std::array<uint32_t, 4>> points)
+{
+    detail::morton_check_sizes(keys.size(), points.size(), "morton4_decode: output size differs");
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        points[i] = morton4_decode(keys[i]);
+    }
+}
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline void hilbert2_encode(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                            std::span<uint128_t> out)
+{
+    detail::morton_check_sizes(x.size(), y.size(), "hilbert2_encode: coordinate sizes differ");
+    detail::morton_check_sizes(x.size(), out.size(), "hilbert2_encode: output size differs");
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = hilbert2_encode(x[i], y[i]);
+    }
+}
+
+/// @throws std::invalid_argument si los tamaños difieren
+inline void hilbert2_decode(std::span<const uint128_t> keys, std::span<uint64_t> x,
+                            std::span<uint64_t> y)
+{
+    detail::morton_check_sizes(keys.size(), x.size(), "hilbert2_decode: output size differs");
+    detail::morton_check_sizes(keys.size(), y.size(), "hilbert2_decode: output size differs");
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto c = hilbert2_decode(keys[i]);
+        x[i] = c[0];
+        y[i] = c[1];
+    }
+}
+
+} // namespace nstd
+
+#endif // UINT128_MORTON_HPP
@@ -0,0 +1,409 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_MPMC_RING_HPP
+#define UINT128_MPMC_RING_HPP
+
+/**
+ * @file uint128_mpmc_ring.hpp
+ * @brief Colas acotadas sin cerrojos para valores de 128 bits
+ *
+ * - `mpmc_ring128`: varios productores y varios consumidores (esquema de
+ *   Vyukov). Cada posición del anillo tiene un número de secuencia que dice
+ *   si está libre u ocupada en la vuelta actual; las secuencias viven en un
+ *   array aparte, alineado a línea de caché, de modo que los datos quedan
+ *   compactos: 16 bytes por elemento, sin metadatos intercalados.
+ * - `spsc_ring128`: un productor y un consumidor. Sin secuencias: cada lado
+ *   publica su índice con un almacenamiento release y guarda una copia del
+ *   índice contrario para no leerlo en cada operación.
+ *
+ * Ambas ofrecen operaciones por lotes sobre std::span: un solo CAS (MPMC) o
+ * un solo almacenamiento (SPSC) reserva o publica todo el lote.
+ *
+ * Los índices de cabeza y cola son de 64 bits y no necesitan CAS de doble
+ * anchura; los datos se protegen con las secuencias. Por eso atomic128 no
+ * interviene en la ruta rápida.
+ *
+ * @code{.cpp}
+ * nstd::mpmc_ring128<> q(1024);
+ * q.push(uint128_t(id));                  // Productores
+ * uint128_t next = q.pop();               // Consumidores
+ * std::array<uint128_t, 32> batch;
+ * std::size_t n = q.try_pop(std::span(batch));
+ * @endcode
+ */
+
+#include "../int128/int128_t.hpp"
+#include "uint128_atomic.hpp"
+#include "uint128_t.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+
+namespace nstd
+{
+
+namespace detail
+{
+
+// Potencia de 2 >= requested (mínimo 2)
+inline std::size_t ring_capacity_for(std::size_t requested)
+{
+    if (requested == 0) {
+        throw std::invalid_argument("ring128: capacity must be positive");
+    }
+    return std::bit_ceil(requested < 2 ? std::size_t(2) : requested);
+}
+
+} // namespace detail
+
+/**
+ * @brief Cola acotada MPMC de valores de 128 bits
+ *
+ * try_push/try_pop no esperan nunca: devuelven false si la cola está llena o
+ * vacía. push/pop reintentan con espera exponencial. Las operaciones por lotes
+ * reservan el tramo con un único CAS y después esperan, como mucho, a que los
+ * hilos que ya tenían reservadas esas posiciones en la vuelta anterior
+ * terminen de copiar.
+ */
+template <atomic128_value T = uint128_t> class mpmc_ring128
+{
+  public:
+    using value_type = T;
+
+    /// @param capacity Redondeada a potencia de 2
+    /// @throws std::invalid_argument si capacity es 0
+    explicit mpmc_ring128(std::size_t capacity)
+        : capacity_(detail::ring_capacity_for(capacity)), mask_(capacity_ - 1),
+          sequences_(std::make_unique<sequence_line[]>((capacity_ + per_line - 1) / per_line)),
+          data_(std::make_unique<T[]>(capacity_))
+    {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            sequence(i).store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpmc_ring128(const mpmc_ring128&) = delete;
+    mpmc_ring128& operator=(const mpmc_ring128&) = delete;
+
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    /// Elementos aproximados (exacto sin operaciones en curso)
+    std::size_t size_approx() const noexcept
+    {
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? static_cast<std::size_t>(tail - head) : 0;
+    }
+
+    bool empty() const noexcept
+    {
+        return size_approx() == 0;
+    }
+
+    bool try_push(T value) noexcept
+    {
+        uint64_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            std::atomic<uint64_t>& seq = sequence(pos);
+            const uint64_t s = seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<int64_t>(s - pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    data_[pos & mask_] = value;
+                    seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Llena
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(T& out) noexcept
+    {
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            std::atomic<uint64_t>& seq = sequence(pos);
+            const uint64_t s = seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<int64_t>(s - (pos + 1));
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = data_[pos & mask_];
+                    seq.store(pos + capacity_, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Vacía
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void push(T value) noexcept
+    {
+        exponential_backoff backoff;
+        while (!try_push(value)) {
+            backoff();
+        }
+    }
+
+    T pop() noexcept
+    {
+        T out;
+        exponential_backoff backoff;
+        while (!try_pop(out)) {
+            backoff();
+        }
+        return out;
+    }
+
+    /// Encola hasta values.size() elementos en orden; devuelve cuántos
+    std::size_t try_push(std::span<const T> values) noexcept
+    {
+        if (values.empty()) {
+            return 0;
+        }
+        uint64_t pos = tail_.load(std::memory_order_relaxed);
+        uint64_t n = 0;
+        do {
+            // Cabeza atrasada = hueco subestimado: nunca se reserva de más
+            const uint64_t head = head_.load(std::memory_order_acquire);
+            const uint64_t used = pos - std::min(head, pos);
+            if (used >= capacity_) {
+                return 0;
+            }
+            n = std::min<uint64_t>(values.size(), capacity_ - used);
+        } while (!tail_.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed));
+
+        for (uint64_t i = 0; i < n; ++i) {
+            std::atomic<uint64_t>& seq = sequence(pos + i);
+            wait_for(seq, pos + i); // Consumidor de la vuelta anterior aún copiando
+            data_[(pos + i) & mask_] = values[i];
+            seq.store(pos + i + 1, std::memory_order_release);
+        }
+        return static_cast<std::size_t>(n);
+    }
+
+    /// Desencola hasta out.size() elementos en orden; devuelve cuántos
+    std::size_t try_pop(std::span<T> out) noexcept
+    {
+        if (out.empty()) {
+            return 0;
+        }
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        uint64_t n = 0;
+        do {
+            const uint64_t tail = tail_.load(std::memory_order_acquire);
+            if (tail <= pos) {
+                return 0;
+            }
+            n = std::min<uint64_t>(out.size(), tail - pos);
+        } while (!head_.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed));
+
+        for (uint64_t i = 0; i < n; ++i) {
+            std::atomic<uint64_t>& seq = sequence(pos + i);
+            wait_for(seq, pos + i + 1); // Productor aún copiando
+            out[i] = data_[(pos + i) & mask_];
+            seq.store(pos + i + capacity_, std::memory_order_release);
+        }
+        return static_cast<std::size_t>(n);
+    }
+
+  private:
+    static constexpr std::size_t per_line = 64 / sizeof(std::atomic<uint64_t>);
+
+    struct alignas(64) sequence_line {
+        std::atomic<uint64_t> seq[per_line];
+    };
+
+    std::atomic<uint64_t>& sequence(uint64_t pos) const noexcept
+    {
+        const std::size_t i = static_cast<std::size_t>(pos & mask_);
+        return sequences_[i / per_line].seq[i % per_line];
+    }
+
+    static void wait_for(const std::atomic<uint64_t>& seq, uint64_t expected) noexcept
+    {
+        exponential_backoff backoff;
+        while (seq.load(std::memory_order_acquire) != expected) {
+            backoff();
+        }
+    }
+
+    std::size_t capacity_;
+    std::size_t mask_;
+    std::unique_ptr<sequence_line[]> sequences_;
+    std::unique_ptr<T[]> data_;
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    alignas(64) std::atomic<uint64_t> head_{0};
+};
+
+/**
+ * @brief Cola acotada de un productor y un consumidor
+ *
+ * Sólo un hilo llama a las funciones push y sólo un hilo a las pop. Cada lado
+ * relee el índice contrario únicamente cuando su copia local indica cola
+ * llena o vacía.
+ */
+template <atomic128_value T = uint128_t> class spsc_ring128
+{
+  public:
+    using value_type = T;
+
+    /// @param capacity Redondeada a potencia de 2
+    /// @throws std::invalid_argument si capacity es 0
+    explicit spsc_ring128(std::size_t capacity)
+        : capacity_(detail::ring_capacity_for(capacity)), mask_(capacity_ - 1),
+          data_(std::make_unique<T[]>(capacity_))
+    {
+    }
+
+    spsc_ring128(const spsc_ring128&) = delete;
+    spsc_ring128& operator=(const spsc_ring128&) = delete;
+
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    std::size_t size_approx() const noexcept
+    {
+        const uint64_t head = consumer_.head.load(std::memory_order_acquire);
+        const uint64_t tail = producer_.tail.load(std::memory_order_acquire);
+        return static_cast<std::size_t>(tail - std::min(head, tail));
+    }
+
+    bool empty() const noexcept
+    {
+        return size_approx() == 0;
+    }
+
+    bool try_push(T value) noexcept
+    {
+        return try_push(std::span<const T>(&value, 1)) == 1;
+    }
+
+    bool try_pop(T& out) noexcept
+    {
+        return try_pop(std::span<T>(&out, 1)) == 1;
+    }
+
+    void push(T value) noexcept
+    {
+        exponential_backoff backoff;
+        while (!try_push(value)) {
+            backoff();
+        }
+    }
+
+    T pop() noexcept
+    {
+        T out;
+        exponential_backoff backoff;
+        while (!try_pop(out)) {
+            backoff();
+        }
+        return out;
+    }
+
+    /// Encola hasta values.size() elementos; una sola publicación por lote
+    std::size_t try_push(std::span<const T> values) noexcept
+    {
+        const uint64_t tail = producer_.tail.load(std::memory_order_relaxed);
+        uint64_t free = capacity_ - (tail - producer_.cached_head);
+        if (free < values.size()) {
+            producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+            free = capacity_ - (tail - producer_.cached_head);
+        }
+        const std::size_t n = std::min<std::size_t>(values.size(), free);
+        for (std::size_t i = 0; i < n; ++i) {
+            data_[(tail + i) & mask_] = values[i];
+        }
+        if (n != 0) {
+            producer_.tail.store(tail + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /// Desencola hasta out.size() elementos; una sola publicación por lote
+    std::size_t try_pop(std::span<T> out) noexcept
+    {
+        const uint64_t head = consumer_.head.load(std::memory_order_relaxed);
+        uint64_t available = consumer_.cached_tail - head;
+        if (available < out.size()) {
+            consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+            available = consumer_.cached_tail - head;
+        }
+        const std::size_t n = std::min<std::size_t>(out.size(), available);
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = data_[(head + i) & mask_];
+        }
+        if (n != 0) {
+            consumer_.head.store(head + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+  private:
+    // Cada lado escribe sólo en su línea: su índice publicado y la copia del
+    // índice contrario, que se relee sólo al ver la cola llena o vacía
+    struct alignas(64) producer_side {
+        std::atomic<uint64_t> tail{0};
+        uint64_t cached_head = 0;
+    };
+
+    struct alignas(64) consumer_side {
+        std::atomic<uint64_t> head{0};
+        uint64_t cached_tail = 0;
+    };
+
+    std::size_t capacity_;
+    std::size_t mask_;
+    std::unique_ptr<T[]> data_;
+    producer_side producer_;
+    consumer_side consumer_;
+};
+
+using mpmc_ring_uint128 = mpmc_ring128<uint128_t>;
+using mpmc_ring_int128 = mpmc_ring128<int128_t>;
+using spsc_ring_uint128 = spsc_ring128<uint128_t>;
+using spsc_ring_int128 = spsc_ring128<int128_t>;
+
+} // namespace nstd
+
+#endif // UINT128_MPMC_RING_HPP
@@ -97,15 +97,8 @@ constexpr uint128_t clamp(const uint128_t& v, const uint128_t& lo, const uint128
  */
 constexpr int popcount(uint128_t x) noexcept
 {
-    // Usar la implementación eficiente para cada parte
-    int count = 0;
-    if (x.high() != 0) {
-        count += intrinsics::popcount64(x.high());
-    }
-    if (x.low() != 0) {
-        count += intrinsics::popcount64(x.low());
-    }
-    return count;
+    // Sin ramas: popcnt(0) ya es 0 y comprobarlo solo añade saltos impredecibles
+    return intrinsics::popcount64(x.high()) + intrinsics::popcount64(x.low());
 }
 
 /**
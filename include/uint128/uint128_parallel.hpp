@@ -0,0 +1,656 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_PARALLEL_HPP
+#define UINT128_PARALLEL_HPP
+
+/**
+ * @file uint128_parallel.hpp
+ * @brief Reducciones paralelas (fork-join) para los algoritmos sobre rangos
+ *
+ * - `fork_join_pool`: hilos persistentes; run(p, f) ejecuta f(0..p-1) a la vez,
+ *   cada índice en un hilo distinto (el llamante ejecuta el 0)
+ * - `execution::par`: política que aceptan las sobrecargas paralelas de
+ *   uint128_algorithm / int128_algorithm (`gcd_range(nstd::execution::par, ...)`)
+ * - `parallel_reduce`: bloques contiguos, parciales alineados a línea de caché,
+ *   combinación en árbol (log2 p pasos, en paralelo) y parada temprana
+ * - `parallel_fold`: parallel_reduce elemento a elemento con valor absorbente
+ *   (gcd == 1, producto == 0, ...) que detiene al resto de hilos
+ * - Sobrecargas paralelas de uint128_algorithm / int128_algorithm (count_if,
+ *   sum, product, gcd_range, lcm_range, calculate_stats): sólo se declaran
+ *   aquí, así que los algoritmos secuenciales no arrastran <thread>
+ *
+ * Con `UINT128_USE_STD_EXECUTION` definido también se aceptan las políticas de
+ * `<execution>` (no se incluye por defecto: en libstdc++ con TBB instalado
+ * obliga a enlazar con -ltbb).
+ */
+
+#include "../int128/int128_algorithm.hpp"
+#include "uint128_algorithm.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(UINT128_USE_STD_EXECUTION)
+#include <execution>
+#endif
+
+namespace nstd
+{
+
+/// Tamaño de línea de caché usado para separar datos escritos por hilos distintos
+inline constexpr std::size_t cache_line_size = 64;
+
+// ============================================================================
+// POOL FORK-JOIN
+// ============================================================================
+
+/**
+ * @brief Pool de hilos persistentes para paralelismo fork-join
+ *
+ * run(p, f) invoca f(i) para i en [0, p) con cada índice en un hilo distinto,
+ * todos a la vez: f(i) puede esperar a f(j). Si no es posible (p == 1, o run()
+ * llamado desde dentro de otra tarea del pool) los índices se ejecutan en el
+ * hilo llamante en orden decreciente, de modo que f(i) sólo puede esperar a
+ * f(j) con j > i.
+ *
+ * Las llamadas concurrentes a run() desde hilos externos se serializan.
+ */
+class fork_join_pool
+{
+  public:
+    /// @param threads Hilos totales, incluido el llamante (0 = hardware_concurrency)
+    explicit fork_join_pool(unsigned threads = 0)
+    {
+        if (threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        workers_.reserve(threads - 1);
+        for (unsigned k = 1; k < threads; ++k) {
+            workers_.emplace_back([this, k] { worker_loop(k); });
+        }
+    }
+
+    fork_join_pool(const fork_join_pool&) = delete;
+    fork_join_pool& operator=(const fork_join_pool&) = delete;
+
+    ~fork_join_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& w : workers_) {
+            w.join();
+        }
+    }
+
+    /// Hilos disponibles para run(), incluido el llamante
+    unsigned size() const noexcept
+    {
+        return static_cast<unsigned>(workers_.size()) + 1;
+    }
+
+    /// Pool compartido del proceso (hardware_concurrency hilos)
+    static fork_join_pool& instance()
+    {
+        static fork_join_pool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Ejecuta f(0..participants-1) y espera a que terminen todas
+     * @pre f no lanza excepciones
+     */
+    template <typename F> void run(unsigned participants, F&& f)
+    {
+        participants = std::clamp(participants, 1u, size());
+        if (participants == 1 || inside_task()) {
+            for (unsigned i = participants; i-- > 0;) {
+                f(i);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> serialize(run_mutex_);
+        std::function<void(unsigned)> job = [&f](unsigned i) { f(i); };
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            participants_ = participants;
+            pending_ = participants - 1;
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        inside_task() = true;
+        f(0u);
+        inside_task() = false;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+        job_ = nullptr;
+    }
+
+  private:
+    static bool& inside_task() noexcept
+    {
+        thread_local bool flag = false;
+        return flag;
+    }
+
+    void worker_loop(unsigned index)
+    {
+        inside_task() = true;
+        unsigned long long seen = 0;
+        for (;;) {
+            std::function<void(unsigned)>* job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) {
+                    return;
+                }
+                seen = generation_;
+                if (index >= participants_) {
+                    continue;
+                }
+                job = job_;
+            }
+            (*job)(index);
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::function<void(unsigned)>* job_ = nullptr;
+    unsigned participants_ = 0;
+    unsigned pending_ = 0;
+    unsigned long long generation_ = 0;
+    bool stop_ = false;
+};
+
+// ============================================================================
+// POLÍTICA DE EJECUCIÓN
+// ============================================================================
+
+namespace execution
+{
+
+/**
+ * @brief Política paralela para las sobrecargas de los algoritmos
+ *
+ * @code{.cpp}
+ * auto g = gcd_range(nstd::execution::par, v.begin(), v.end());      // Pool global
+ * auto s = sum_uint128(nstd::execution::par(4), v.begin(), v.end()); // Máximo 4 hilos
+ * nstd::fork_join_pool pool(8);
+ * auto st = calculate_stats(nstd::execution::par.on(pool), v.begin(), v.end());
+ * @endcode
+ */
+struct parallel_policy {
+    unsigned threads = 0;                     ///< Máximo de hilos (0 = todos los del pool)
+    fork_join_pool* pool = nullptr;           ///< nullptr = fork_join_pool::instance()
+    std::size_t grain = std::size_t{1} << 14; ///< Mínimo de elementos por hilo
+
+    constexpr parallel_policy operator()(unsigned max_threads) const noexcept
+    {
+        parallel_policy p = *this;
+        p.threads = max_threads;
+        return p;
+    }
+
+    constexpr parallel_policy on(fork_join_pool& target) const noexcept
+    {
+        parallel_policy p = *this;
+        p.pool = &target;
+        return p;
+    }
+
+    constexpr parallel_policy with_grain(std::size_t elements) const noexcept
+    {
+        parallel_policy p = *this;
+        p.grain = elements > 0 ? elements : 1;
+        return p;
+    }
+};
+
+inline constexpr parallel_policy par{};
+
+} // namespace execution
+
+/**
+ * @brief Tipos aceptados como primer argumento de las sobrecargas paralelas
+ */
+template <typename P>
+concept execution_policy = std::same_as<std::remove_cvref_t<P>, execution::parallel_policy>
+#if defined(UINT128_USE_STD_EXECUTION)
+                           || std::is_execution_policy_v<std::remove_cvref_t<P>>
+#endif
+    ;
+
+/**
+ * @brief Traduce cualquier política aceptada a execution::parallel_policy
+ *
+ * std::execution::seq / unseq se traducen a un único hilo.
+ */
+template <execution_policy P> constexpr execution::parallel_policy to_parallel_policy(const P& p) noexcept
+{
+    if constexpr (std::same_as<std::remove_cvref_t<P>, execution::parallel_policy>) {
+        return p;
+    }
+#if defined(UINT128_USE_STD_EXECUTION)
+    else if constexpr (std::same_as<std::remove_cvref_t<P>, std::execution::sequenced_policy>
+#if defined(__cpp_lib_execution) && __cpp_lib_execution >= 201902L
+                       || std::same_as<std::remove_cvref_t<P>, std::execution::unsequenced_policy>
+#endif
+    ) {
+        return execution::par(1);
+    } else {
+        return execution::par;
+    }
+#endif
+}
+
+// ============================================================================
+// REDUCCIÓN EN ÁRBOL
+// ============================================================================
+
+namespace detail
+{
+
+/// Parcial de un hilo, en su propia línea de caché
+template <typename R> struct alignas(cache_line_size) reduce_slot {
+    R value{};
+    std::atomic<bool> ready{false};
+};
+
+} // namespace detail
+
+/**
+ * @brief Reduce [0, n) repartido en bloques contiguos entre hilos
+ *
+ * @param chunk `R chunk(std::size_t begin, std::size_t end, std::atomic<bool>& stop)`;
+ *        puede poner stop a true (p. ej. al encontrar un valor absorbente) y
+ *        debería consultarlo de vez en cuando para terminar antes
+ * @param merge `R merge(const R& left, const R& right)`; se aplica respetando
+ *        el orden de los bloques, así que basta con que sea asociativa
+ *
+ * Cada hilo i, tras reducir su bloque, combina en árbol: en el paso s
+ * (s = 1, 2, 4, ...) los hilos con i % 2s == 0 esperan al parcial i + s.
+ * Si chunk lanza, se detiene al resto y la excepción se relanza aquí.
+ */
+template <typename R, typename Chunk, typename Merge>
+R parallel_reduce(std::size_t n, const execution::parallel_policy& policy, Chunk chunk, Merge merge)
+{
+    fork_join_pool& pool = policy.pool != nullptr ? *policy.pool : fork_join_pool::instance();
+    std::size_t p = pool.size();
+    if (policy.threads != 0) {
+        p = std::min<std::size_t>(p, policy.threads);
+    }
+    p = std::min(p, std::max<std::size_t>(1, n / std::max<std::size_t>(1, policy.grain)));
+
+    std::atomic<bool> stop{false};
+    if (p <= 1) {
+        return chunk(std::size_t{0}, n, stop);
+    }
+
+    std::vector<detail::reduce_slot<R>> slots(p);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    pool.run(static_cast<unsigned>(p), [&](unsigned i) {
+        try {
+            slots[i].value = chunk(n * i / p, n * (i + 1) / p, stop);
+            for (std::size_t step = 1; step < p && i % (2 * step) == 0; step *= 2) {
+                const std::size_t partner = i + step;
+                if (partner >= p) {
+                    continue;
+                }
+                slots[partner].ready.wait(false, std::memory_order_acquire);
+                slots[i].value = merge(slots[i].value, slots[partner].value);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            stop.store(true, std::memory_order_relaxed);
+        }
+        slots[i].ready.store(true, std::memory_order_release);
+        slots[i].ready.notify_one();
+    });
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return slots[0].value;
+}
+
+/**
+ * @brief Pliegue paralelo de un rango de acceso aleatorio con parada temprana
+ *
+ * Cada hilo pliega su bloque con `op` desde `identity`; si el parcial cumple
+ * `absorbing` (op(x, absorbente) == absorbente para todo x) se avisa al resto,
+ * que abandona su bloque, y el resultado es ese valor.
+ */
+template <std::random_access_iterator RandomIt, typename T, typename Op, typename Absorbing>
+T parallel_fold(RandomIt first, RandomIt last, T identity, Op op, Absorbing absorbing,
+                const execution::parallel_policy& policy)
+{
+    constexpr std::size_t check_every = 1024;
+    const auto n = static_cast<std::size_t>(last - first);
+    return parallel_reduce<T>(
+        n, policy,
+        [&](std::size_t b, std::size_t e, std::atomic<bool>& stop) {
+            T acc = identity;
+            for (std::size_t i = b; i < e;) {
+                const std::size_t block_end = std::min(e, i + check_every);
+                for (; i < block_end; ++i) {
+                    acc = op(acc, first[static_cast<std::ptrdiff_t>(i)]);
+                }
+                if (absorbing(acc)) {
+                    stop.store(true, std::memory_order_relaxed);
+                    return acc;
+                }
+                if (stop.load(std::memory_order_relaxed)) {
+                    return acc; // Otro hilo encontró el absorbente: el resultado ya no depende de este
+                }
+            }
+            return acc;
+        },
+        [&](const T& a, const T& b) { return absorbing(a) ? a : op(a, b); });
+}
+
+// ===============================================================================
+// ALGORITMOS PARALELOS
+// ===============================================================================
+//
+// Sobrecargas de uint128_algorithm / int128_algorithm con una politica de
+// ejecucion como primer argumento (nstd::execution::par). Estan aqui y no en
+// los headers de algoritmos para que estos no dependan de <thread> ni del pool.
+// Reparten el rango en un bloque contiguo por hilo, combinan los parciales en
+// arbol y, cuando la operacion tiene valor absorbente (gcd == 1, lcm/producto
+// == 0), el primer hilo que lo alcanza detiene al resto.
+
+namespace uint128_algorithm
+{
+
+/**
+ * @brief count_if_uint128 repartido entre hilos
+ *
+ * @test test_parallel_algorithms
+ * @code{.cpp}
+ * auto n = count_if_uint128(nstd::execution::par, vec.begin(), vec.end(),
+ *     [](const uint128_t& x) { return x > uint128_t(100); });
+ * @endcode
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+std::size_t count_if_uint128(Policy&& policy, RandomIt first, RandomIt last,
+                             uint128_concepts::uint128_predicate auto pred)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, uint128_t>
+{
+    return nstd::parallel_reduce<std::size_t>(
+        static_cast<std::size_t>(last - first), nstd::to_parallel_policy(policy),
+        [&](std::size_t b, std::size_t e, std::atomic<bool>&) {
+            return count_if_uint128(first + b, first + e, pred);
+        },
+        std::plus<std::size_t>());
+}
+
+/**
+ * @brief sum_uint128 repartido entre hilos (mismo resultado modulo 2^128)
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+uint128_t sum_uint128(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, uint128_t>
+{
+    return nstd::parallel_fold(
+        first, last, uint128_t(0), std::plus<uint128_t>(), [](const uint128_t&) { return false; },
+        nstd::to_parallel_policy(policy));
+}
+
+/**
+ * @brief product_uint128 repartido entre hilos
+ *
+ * Se detiene en cuanto un bloque llega a 0 (un factor nulo o suficientes
+ * factores pares para que el producto modulo 2^128 se anule).
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+uint128_t product_uint128(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, uint128_t>
+{
+    return nstd::parallel_fold(
+        first, last, uint128_t(1), std::multiplies<uint128_t>(),
+        [](const uint128_t& x) { return x == uint128_t(0); }, nstd::to_parallel_policy(policy));
+}
+
+/**
+ * @brief gcd_range repartido entre hilos; termina en cuanto un bloque da 1
+ *
+ * @test test_parallel_algorithms
+ * @code{.cpp}
+ * auto g = gcd_range(nstd::execution::par, vec.begin(), vec.end());
+ * assert(g == gcd_range(vec.begin(), vec.end()));
+ * @endcode
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+uint128_t gcd_range(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, uint128_t>
+{
+    return nstd::parallel_fold(
+        first, last, uint128_t(0),
+        [](const uint128_t& a, const uint128_t& b) { return nstd::gcd(a, b); },
+        [](const uint128_t& x) { return x == uint128_t(1); }, nstd::to_parallel_policy(policy));
+}
+
+/**
+ * @brief lcm_range repartido entre hilos; termina en cuanto un bloque da 0
+ *
+ * @note Coincide con la version secuencial mientras el LCM quepa en 128 bits;
+ *       si desborda, el valor truncado depende del orden de combinacion.
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+uint128_t lcm_range(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, uint128_t>
+{
+    if (first == last)
+        return uint128_t(0);
+
+    return nstd::parallel_fold(
+        first, last, uint128_t(1),
+        [](const uint128_t& a, const uint128_t& b) { return nstd::lcm(a, b); },
+        [](const uint128_t& x) { return x == uint128_t(0); }, nstd::to_parallel_policy(policy));
+}
+
+/**
+ * @brief calculate_stats repartido entre hilos
+ *
+ * @test test_parallel_algorithms
+ * @code{.cpp}
+ * auto stats = calculate_stats(nstd::execution::par(4), vec.begin(), vec.end());
+ * @endcode
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+uint128_stats calculate_stats(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, uint128_t>
+{
+    return nstd::parallel_reduce<uint128_stats>(
+        static_cast<std::size_t>(last - first), nstd::to_parallel_policy(policy),
+        [&](std::size_t b, std::size_t e, std::atomic<bool>&) {
+            return calculate_stats(first + b, first + e);
+        },
+        [](const uint128_stats& a, const uint128_stats& b) {
+            if (a.count == 0)
+                return b;
+            if (b.count == 0)
+                return a;
+            return uint128_stats{std::min(a.min_value, b.min_value), std::max(a.max_value, b.max_value),
+                                 a.sum + b.sum, a.count + b.count};
+        });
+}
+
+} // namespace uint128_algorithm
+
+namespace int128_algorithm
+{
+
+/**
+ * @brief count_if_int128 repartido entre hilos
+ *
+ * @test test_parallel_algorithms
+ * @code{.cpp}
+ * auto negatives = count_if_int128(nstd::execution::par, vec.begin(), vec.end(),
+ *     [](const int128_t& x) { return x < int128_t(0); });
+ * @endcode
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+std::size_t count_if_int128(Policy&& policy, RandomIt first, RandomIt last,
+                            int128_concepts::int128_predicate auto pred)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, int128_t>
+{
+    return nstd::parallel_reduce<std::size_t>(
+        static_cast<std::size_t>(last - first), nstd::to_parallel_policy(policy),
+        [&](std::size_t b, std::size_t e, std::atomic<bool>&) {
+            return count_if_int128(first + b, first + e, pred);
+        },
+        std::plus<std::size_t>());
+}
+
+/**
+ * @brief sum_int128 repartido entre hilos (mismo resultado modulo 2^128)
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+int128_t sum_int128(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, int128_t>
+{
+    return nstd::parallel_fold(
+        first, last, int128_t(0), std::plus<int128_t>(), [](const int128_t&) { return false; },
+        nstd::to_parallel_policy(policy));
+}
+
+/**
+ * @brief product_int128 repartido entre hilos; termina en cuanto un bloque da 0
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+int128_t product_int128(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, int128_t>
+{
+    return nstd::parallel_fold(
+        first, last, int128_t(1), std::multiplies<int128_t>(),
+        [](const int128_t& x) { return x == int128_t(0); }, nstd::to_parallel_policy(policy));
+}
+
+/**
+ * @brief gcd_range repartido entre hilos; termina en cuanto un bloque da 1
+ *
+ * @test test_parallel_algorithms
+ * @code{.cpp}
+ * auto g = gcd_range(nstd::execution::par, vec.begin(), vec.end());
+ * assert(g == gcd_range(vec.begin(), vec.end()));
+ * @endcode
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+int128_t gcd_range(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, int128_t>
+{
+    return nstd::parallel_fold(
+        first, last, int128_t(0),
+        [](const int128_t& a, const int128_t& b) { return nstd::gcd(a, b.abs()); },
+        [](const int128_t& x) { return x == int128_t(1); }, nstd::to_parallel_policy(policy));
+}
+
+/**
+ * @brief lcm_range repartido entre hilos; termina en cuanto un bloque da 0
+ *
+ * @note Coincide con la version secuencial mientras el LCM quepa en 127 bits;
+ *       si desborda, el valor truncado depende del orden de combinacion.
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+int128_t lcm_range(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, int128_t>
+{
+    if (first == last)
+        return int128_t(0);
+
+    return nstd::parallel_fold(
+        first, last, int128_t(1),
+        [](const int128_t& a, const int128_t& b) { return nstd::lcm(a, b.abs()); },
+        [](const int128_t& x) { return x == int128_t(0); }, nstd::to_parallel_policy(policy));
+}
+
+/**
+ * @brief calculate_stats repartido entre hilos
+ *
+ * @test test_parallel_algorithms
+ * @code{.cpp}
+ * auto stats = calculate_stats(nstd::execution::par(4), vec.begin(), vec.end());
+ * @endcode
+ */
+template <nstd::execution_policy Policy, std::random_access_iterator RandomIt>
+int128_stats calculate_stats(Policy&& policy, RandomIt first, RandomIt last)
+    requires std::same_as<typename std::iterator_traits<RandomIt>::value_type, int128_t>
+{
+    return nstd::parallel_reduce<int128_stats>(
+        static_cast<std::size_t>(last - first), nstd::to_parallel_policy(policy),
+        [&](std::size_t b, std::size_t e, std::atomic<bool>&) {
+            return calculate_stats(first + b, first + e);
+        },
+        [](const int128_stats& a, const int128_stats& b) {
+            if (a.count == 0)
+                return b;
+            if (b.count == 0)
+                return a;
+            return int128_stats{std::min(a.min_value, b.min_value),
+                                std::max(a.max_value, b.max_value),
+                                a.sum + b.sum,
+                                a.count + b.count,
+                                a.negative_count + b.negative_count,
+                                a.positive_count + b.positive_count,
+                                a.zero_count + b.zero_count};
+        });
+}
+
+} // namespace int128_algorithm
+
+} // namespace nstd
+
+#endif // UINT128_PARALLEL_HPP
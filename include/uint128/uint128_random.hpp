@@ -0,0 +1,880 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_RANDOM_HPP
+#define UINT128_RANDOM_HPP
+
+/**
+ * @file uint128_random.hpp
+ * @brief Generadores pseudoaleatorios con estado o aritmética de 128 bits
+ *
+ * Los tres cumplen std::uniform_random_bit_generator (result_type = uint64_t),
+ * así que sirven con cualquier distribución de <random>:
+ * - `pcg64`: PCG64 DXSM (la variante por defecto de NumPy). LCG de 128 bits
+ *   con multiplicador de 64 bits y salida DXSM sobre la parte alta.
+ * - `lehmer128`: generador congruencial multiplicativo módulo 2^128; la
+ *   salida son los 64 bits altos del estado. Periodo 2^126.
+ * - `xoshiro256pp`: xoshiro256++ de Blackman y Vigna, con `next128()` y
+ *   `fill(std::span<uint128_t>)` para salida de 128 bits.
+ *
+ * `uniform_uint128_distribution` y `generate(span, bound)` producen valores
+ * uniformes en un rango de 128 bits sin sesgo y sin dividir en el caso normal
+ * (método de multiplicación y rechazo de Lemire).
+ *
+ * Además de operator():
+ * - `advance(n)` / `discard(n)` saltan n pasos en O(log n): productos de
+ *   128 bits para los congruenciales y x^n módulo el polinomio
+ *   característico para xoshiro. Con ellos se reparte una secuencia entre
+ *   hilos sin solapes (`rng.advance(i * chunk)`).
+ * - `fill(span)` genera en bloque con el estado en registros: dentro del
+ *   operator() el compilador no puede descartar que las escrituras en la
+ *   salida modifiquen el estado del propio generador.
+ *
+ * @code{.cpp}
+ * nstd::pcg64 rng(42);
+ * std::uniform_real_distribution<double> u(0.0, 1.0);
+ * double x = u(rng);
+ *
+ * std::vector<uint64_t> block(1 << 16);
+ * rng.fill(block);
+ *
+ * nstd::pcg64 worker = rng;
+ * worker.advance(uint128_t(1) << 64);   // Flujo disjunto para otro hilo
+ * @endcode
+ */
+
+#include "../intrinsics/arithmetic_operations.hpp"
+#include "../intrinsics/byte_operations.hpp"
+#include "uint128_t.hpp"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+
+namespace nstd
+{
+
+namespace detail
+{
+
+/// SplitMix64: expande una semilla de 64 bits en palabras de estado
+inline constexpr uint64_t splitmix64(uint64_t& x) noexcept
+{
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/// Multiplicador de 64 bits de PCG64 DXSM y de lehmer128
+inline constexpr uint64_t cheap_multiplier = 0xDA942042E4DD58B5ULL;
+
+/// (hi, lo) * m módulo 2^128
+inline constexpr void mul_u64(uint64_t& hi, uint64_t& lo, uint64_t m) noexcept
+{
+    uint64_t carry = 0;
+    const uint64_t l = intrinsics::umul128(lo, m, &carry);
+    hi = hi * m + carry;
+    lo = l;
+}
+
+/**
+ * @brief Coeficientes (a, c) de n pasos de x -> m x + k: x_n = a x_0 + c
+ *
+ * Brown, "Random Number Generation with Arbitrary Strides": exponenciación
+ * binaria de la función afín, O(log n) productos de 128 bits.
+ */
+inline void lcg_advance(uint128_t m, uint128_t k, uint128_t n, uint128_t& a,
+                        uint128_t& c) noexcept
+{
+    a = uint128_t(1);
+    c = uint128_t(0);
+    while (n != uint128_t(0)) {
+        if ((n.low() & 1) != 0) {
+            a *= m;
+            c = c * m + k;
+        }
+        k = (m + uint128_t(1)) * k;
+        m *= m;
+        n >>= 1;
+    }
+}
+
+} // namespace detail
+
+// ============================================================================
+// PCG64 DXSM
+// ============================================================================
+
+/**
+ * @brief PCG64 DXSM: LCG de 128 bits y permutación "double xorshift multiply"
+ *
+ * Misma secuencia que `numpy.random.PCG64DXSM` para el mismo (estado,
+ * incremento); la siembra a partir de un uint64_t usa SplitMix64 en lugar de
+ * la SeedSequence de NumPy. La salida se calcula sobre el estado previo al
+ * paso, así que la multiplicación de la salida y la del LCG se solapan.
+ */
+class pcg64
+{
+  public:
+    using result_type = uint64_t;
+    static constexpr uint64_t default_seed = 0xCAFEF00DD15EA5E5ULL;
+
+    pcg64() noexcept : pcg64(default_seed) {}
+
+    explicit pcg64(uint64_t seed_value) noexcept
+    {
+        seed(seed_value);
+    }
+
+    /// Estado inicial y flujo (cualquier valor; el incremento es 2 stream + 1)
+    pcg64(const uint128_t& initstate, const uint128_t& stream) noexcept
+    {
+        seed(initstate, stream);
+    }
+
+    void seed(uint64_t seed_value) noexcept
+    {
+        const uint64_t s0 = detail::splitmix64(seed_value);
+        const uint64_t s1 = detail::splitmix64(seed_value);
+        const uint64_t s2 = detail::splitmix64(seed_value);
+        const uint64_t s3 = detail::splitmix64(seed_value);
+        seed(uint128_t(s0, s1), uint128_t(s2, s3));
+    }
+
+    /// Igual que pcg_cm_srandom_r de NumPy
+    void seed(const uint128_t& initstate, const uint128_t& stream) noexcept
+    {
+        state_ = uint128_t(0);
+        inc_ = (stream << 1) | uint128_t(1);
+        step();
+        state_ += initstate;
+        step();
+    }
+
+    static constexpr result_type min() noexcept
+    {
+        return 0;
+    }
+
+    static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() noexcept
+    {
+        const uint64_t out = output(state_.high(), state_.low());
+        step();
+        return out;
+    }
+
+    /// Avanza n pasos en O(log n)
+    void advance(const uint128_t& n) noexcept
+    {
+        uint128_t a, c;
+        detail::lcg_advance(uint128_t(detail::cheap_multiplier), inc_, n, a, c);
+        state_ = a * state_ + c;
+    }
+
+    void discard(unsigned long long n) noexcept
+    {
+        advance(uint128_t(static_cast<uint64_t>(n)));
+    }
+
+    /// out[i] = (*this)() para cada i, con el estado en registros
+    void fill(std::span<uint64_t> out) noexcept
+    {
+        uint64_t hi = state_.high(), lo = state_.low();
+        const uint64_t inc_hi = inc_.high(), inc_lo = inc_.low();
+        for (uint64_t& x : out) {
+            x = output(hi, lo);
+            detail::mul_u64(hi, lo, detail::cheap_multiplier);
+            lo += inc_lo;
+            hi += inc_hi + (lo < inc_lo ? 1 : 0);
+        }
+        state_ = uint128_t(hi, lo);
+    }
+
+    const uint128_t& state() const noexcept
+    {
+        return state_;
+    }
+
+    const uint128_t& increment() const noexcept
+    {
+        return inc_;
+    }
+
+    friend bool operator==(const pcg64& a, const pcg64& b) noexcept
+    {
+        return a.state_ == b.state_ && a.inc_ == b.inc_;
+    }
+
+  private:
+    uint128_t state_;
+    uint128_t inc_;
+
+    static uint64_t output(uint64_t hi, uint64_t lo) noexcept
+    {
+        lo |= 1;
+        hi ^= hi >> 32;
+        hi *= detail::cheap_multiplier;
+        hi ^= hi >> 48;
+        return hi * lo;
+    }
+
+    void step() noexcept
+    {
+        uint64_t hi = state_.high(), lo = state_.low();
+        detail::mul_u64(hi, lo, detail::cheap_multiplier);
+        state_ = uint128_t(hi, lo) + inc_;
+    }
+};
+
+// ============================================================================
+// LEHMER 128
+// ============================================================================
+
+/**
+ * @brief Generador de Lehmer (MCG) módulo 2^128: x = x * m, salida x >> 64
+ *
+ * Un producto 128x64 por número; el más rápido de los tres. El estado es
+ * siempre impar (periodo 2^126). Los bits bajos de la salida son de menor
+ * calidad que los de PCG64: para bits sueltos mejor usar los altos.
+ */
+class lehmer128
+{
+  public:
+    using result_type = uint64_t;
+    static constexpr uint64_t default_seed = 0x853C49E6748FEA9BULL;
+
+    lehmer128() noexcept : lehmer128(default_seed) {}
+
+    explicit lehmer128(uint64_t seed_value) noexcept
+    {
+        seed(seed_value);
+    }
+
+    /// El bit 0 del estado se fuerza a 1
+    explicit lehmer128(const uint128_t& state) noexcept
+    {
+        seed(state);
+    }
+
+    void seed(uint64_t seed_value) noexcept
+    {
+        const uint64_t hi = detail::splitmix64(seed_value);
+        const uint64_t lo = detail::splitmix64(seed_value);
+        seed(uint128_t(hi, lo));
+    }
+
+    void seed(const uint128_t& state) noexcept
+    {
+        state_ = state | uint128_t(1);
+    }
+
+    static constexpr result_type min() noexcept
+    {
+        return 0;
+    }
+
+    static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() noexcept
+    {
+        uint64_t hi = state_.high(), lo = state_.low();
+        detail::mul_u64(hi, lo, detail::cheap_multiplier);
+        state_ = uint128_t(hi, lo);
+        return hi;
+    }
+
+    /// Avanza n pasos en O(log n): x = x * m^n
+    void advance(const uint128_t& n) noexcept
+    {
+        uint128_t a, c;
+        detail::lcg_advance(uint128_t(detail::cheap_multiplier), uint128_t(0), n, a, c);
+        state_ *= a;
+    }
+
+    void discard(unsigned long long n) noexcept
+    {
+        advance(uint128_t(static_cast<uint64_t>(n)));
+    }
+
+    void fill(std::span<uint64_t> out) noexcept
+    {
+        uint64_t hi = state_.high(), lo = state_.low();
+        for (uint64_t& x : out) {
+            detail::mul_u64(hi, lo, detail::cheap_multiplier);
+            x = hi;
+        }
+        state_ = uint128_t(hi, lo);
+    }
+
+    const uint128_t& state() const noexcept
+    {
+        return state_;
+    }
+
+    friend bool operator==(const lehmer128& a, const lehmer128& b) noexcept
+    {
+        return a.state_ == b.state_;
+    }
+
+  private:
+    uint128_t state_;
+};
+
+// ============================================================================
+// XOSHIRO256++
+// ============================================================================
+
+namespace detail
+{
+
+using xoshiro_state = std::array<uint64_t, 4>;
+
+/// Polinomio de grado < 256 sobre GF(2): coeficiente de x^i en el bit i % 64 de la palabra i / 64
+using gf2_poly256 = std::array<uint64_t, 4>;
+
+inline void xoshiro_step(xoshiro_state& s) noexcept
+{
+    const uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = intrinsics::rotl64(s[3], 45);
+}
+
+/**
+ * @brief Polinomio característico de la transición de xoshiro256 (grado 256)
+ *
+ * Se obtiene una sola vez con Berlekamp-Massey sobre 512 bits de una
+ * coordenada del estado: la transición es lineal en GF(2) y su polinomio es
+ * primitivo, así que el polinomio mínimo de cualquier secuencia no nula es
+ * el característico. Se devuelven los 256 coeficientes bajos (x^256 implícito).
+ */
+inline const gf2_poly256& xoshiro_charpoly() noexcept
+{
+    static const gf2_poly256 poly = [] {
+        constexpr std::size_t n = 512;
+        std::bitset<n> seq;
+        xoshiro_state s = {1, 2, 3, 4};
+        for (std::size_t i = 0; i < n; ++i) {
+            seq[i] = (s[0] & 1) != 0;
+            xoshiro_step(s);
+        }
+        // Berlekamp-Massey: c(x) es el polinomio de conexión, de grado L
+        std::bitset<n + 1> c, b;
+        c[0] = b[0] = true;
+        std::size_t L = 0, m = 1;
+        for (std::size_t k = 0; k < n; ++k) {
+            bool d = seq[k];
+            for (std::size_t i = 1; i <= L; ++i) {
+                d ^= c[i] && seq[k - i];
+            }
+            if (!d) {
+                ++m;
+            } else if (2 * L <= k) {
+                const auto t = c;
+                c ^= b << m;
+                L = k + 1 - L;
+                b = t;
+                m = 1;
+            } else {
+                c ^= b << m;
+                ++m;
+            }
+        }
+        // Polinomio característico = recíproco de c: coeficiente de x^(L - i) = c_i
+        gf2_poly256 p = {0, 0, 0, 0};
+        for (std::size_t i = 1; i <= L; ++i) {
+            p[(L - i) / 64] |= uint64_t(c[i]) << ((L - i) % 64);
+        }
+        return p;
+    }();
+    return poly;
+}
+
+/// r = r * x módulo p (x^256 = p)
+inline void xoshiro_mulx(gf2_poly256& r, const gf2_poly256& p) noexcept
+{
+    const uint64_t overflow = 0 - (r[3] >> 63);
+    r[3] = ((r[3] << 1) | (r[2] >> 63)) ^ (p[3] & overflow);
+    r[2] = ((r[2] << 1) | (r[1] >> 63)) ^ (p[2] & overflow);
+    r[1] = ((r[1] << 1) | (r[0] >> 63)) ^ (p[1] & overflow);
+    r[0] = (r[0] << 1) ^ (p[0] & overflow);
+}
+
+/// a * b módulo el polinomio característico (Horner sobre los bits de b, sin ramas)
+inline gf2_poly256 xoshiro_mulmod(const gf2_poly256& a, const gf2_poly256& b) noexcept
+{
+    const gf2_poly256& p = xoshiro_charpoly();
+    gf2_poly256 r = {0, 0, 0, 0};
+    for (std::size_t i = 256; i-- > 0;) {
+        xoshiro_mulx(r, p);
+        const uint64_t take = 0 - ((b[i / 64] >> (i % 64)) & 1);
+        for (std::size_t w = 0; w < 4; ++w) {
+            r[w] ^= a[w] & take;
+        }
+    }
+    return r;
+}
+
+/// s = q(T) s, con T la transición: Horner en el orden de jump() de Vigna
+inline void xoshiro_apply(xoshiro_state& s, const gf2_poly256& q) noexcept
+{
+    xoshiro_state acc = {0, 0, 0, 0};
+    for (std::size_t i = 0; i < 256; ++i) {
+        const uint64_t take = 0 - ((q[i / 64] >> (i % 64)) & 1);
+        for (std::size_t w = 0; w < 4; ++w) {
+            acc[w] ^= s[w] & take;
+        }
+        xoshiro_step(s);
+    }
+    s = acc;
+}
+
+/// Coeficientes de jump() y long_jump() del código de referencia: x^(2^128) y x^(2^192)
+inline constexpr gf2_poly256 xoshiro_jump = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                             0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+inline constexpr gf2_poly256 xoshiro_long_jump = {0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL,
+                                                  0x77710069854EE241ULL, 0x39109BB02ACBE635ULL};
+
+} // namespace detail
+
+/**
+ * @brief xoshiro256++ (Blackman y Vigna), con salida opcional de 128 bits
+ *
+ * `next128()` combina dos salidas consecutivas (la primera en la parte alta);
+ * uint128_t no es std::unsigned_integral, así que result_type sigue siendo
+ * uint64_t para cumplir std::uniform_random_bit_generator.
+ */
+class xoshiro256pp
+{
+  public:
+    using result_type = uint64_t;
+    static constexpr uint64_t default_seed = 0x9E3779B97F4A7C15ULL;
+
+    xoshiro256pp() noexcept : xoshiro256pp(default_seed) {}
+
+    explicit xoshiro256pp(uint64_t seed_value) noexcept
+    {
+        seed(seed_value);
+    }
+
+    /// Estado explícito; no debe ser todo ceros
+    explicit xoshiro256pp(const std::array<uint64_t, 4>& state) noexcept : s_(state) {}
+
+    /// Las cuatro palabras con SplitMix64, como recomiendan los autores
+    void seed(uint64_t seed_value) noexcept
+    {
+        for (uint64_t& w : s_) {
+            w = detail::splitmix64(seed_value);
+        }
+    }
+
+    static constexpr result_type min() noexcept
+    {
+        return 0;
+    }
+
+    static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() noexcept
+    {
+        return next(s_[0], s_[1], s_[2], s_[3]);
+    }
+
+    /// Dos salidas consecutivas: la primera en la parte alta
+    uint128_t next128() noexcept
+    {
+        const uint64_t hi = (*this)();
+        return uint128_t(hi, (*this)());
+    }
+
+    /**
+     * @brief Avanza n pasos en O(log n)
+     *
+     * Calcula x^n módulo el polinomio característico (128 cuadrados de
+     * polinomios de grado 256) y lo aplica al estado: del orden de 0.1 ms,
+     * independiente de n. Para repartir flujos entre hilos suele bastar con
+     * jump() / long_jump(), que cuestan 256 pasos.
+     */
+    void advance(const uint128_t& n) noexcept
+    {
+        detail::gf2_poly256 q = {1, 0, 0, 0};
+        const detail::gf2_poly256& p = detail::xoshiro_charpoly();
+        for (int bit = 127; bit >= 0; --bit) {
+            q = detail::xoshiro_mulmod(q, q);
+            if (((n >> bit).low() & 1) != 0) {
+                detail::xoshiro_mulx(q, p);
+            }
+        }
+        detail::xoshiro_apply(s_, q);
+    }
+
+    void discard(unsigned long long n) noexcept
+    {
+        advance(uint128_t(static_cast<uint64_t>(n)));
+    }
+
+    /// Equivale a 2^128 llamadas: 2^128 subsecuencias para cálculo paralelo
+    void jump() noexcept
+    {
+        detail::xoshiro_apply(s_, detail::xoshiro_jump);
+    }
+
+    /// Equivale a 2^192 llamadas
+    void long_jump() noexcept
+    {
+        detail::xoshiro_apply(s_, detail::xoshiro_long_jump);
+    }
+
+    void fill(std::span<uint64_t> out) noexcept
+    {
+        uint64_t s0 = s_[0], s1 = s_[1], s2 = s_[2], s3 = s_[3];
+        for (uint64_t& x : out) {
+            x = next(s0, s1, s2, s3);
+        }
+        s_ = {s0, s1, s2, s3};
+    }
+
+    /// out[i] = next128()
+    void fill(std::span<uint128_t> out) noexcept
+    {
+        uint64_t s0 = s_[0], s1 = s_[1], s2 = s_[2], s3 = s_[3];
+        for (uint128_t& x : out) {
+            const uint64_t hi = next(s0, s1, s2, s3);
+            x = uint128_t(hi, next(s0, s1, s2, s3));
+        }
+        s_ = {s0, s1, s2, s3};
+    }
+
+    const std::array<uint64_t, 4>& state() const noexcept
+    {
+        return s_;
+    }
+
+    friend bool operator==(const xoshiro256pp& a, const xoshiro256pp& b) noexcept
+    {
+        return a.s_ == b.s_;
+    }
+
+  private:
+    std::array<uint64_t, 4> s_;
+
+    static uint64_t next(uint64_t& s0, uint64_t& s1, uint64_t& s2, uint64_t& s3) noexcept
+    {
+        const uint64_t out = intrinsics::rotl64(s0 + s3, 23) + s0;
+        const uint64_t t = s1 << 17;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = intrinsics::rotl64(s3, 45);
+        return out;
+    }
+};
+
+
+// ============================================================================
+// DISTRIBUCIONES UNIFORMES
+// ============================================================================
+
+namespace detail
+{
+
+/// 128 bits aleatorios de cualquier URBG (dos llamadas si da 64 bits completos)
+template <std::uniform_random_bit_generator G> uint128_t random_bits128(G& g)
+{
+    if constexpr (G::min() == 0 && G::max() == std::numeric_limits<uint64_t>::max()) {
+        const uint64_t hi = static_cast<uint64_t>(g());
+        return uint128_t(hi, static_cast<uint64_t>(g()));
+    } else {
+        std::uniform_int_distribution<uint64_t> bits;
+        const uint64_t hi = bits(g);
+        return uint128_t(hi, bits(g));
+    }
+}
+
+/// a * b = hi * 2^128 + lo; dos productos 64x64 si b cabe en 64 bits, cuatro si no
+inline void mul_wide(const uint128_t& a, const uint128_t& b, uint128_t& hi, uint128_t& lo) noexcept
+{
+    uint64_t h00 = 0, h10 = 0;
+    const uint64_t l00 = intrinsics::umul128(a.low(), b.low(), &h00);
+    const uint64_t l10 = intrinsics::umul128(a.high(), b.low(), &h10);
+    if (b.high() == 0) {
+        const uint128_t mid = uint128_t(0, h00) + uint128_t(0, l10);
+        lo = uint128_t(mid.low(), l00);
+        hi = uint128_t(0, h10 + mid.high());
+        return;
+    }
+    uint64_t h01 = 0, h11 = 0;
+    const uint64_t l01 = intrinsics::umul128(a.low(), b.high(), &h01);
+    const uint64_t l11 = intrinsics::umul128(a.high(), b.high(), &h11);
+    const uint128_t mid = uint128_t(0, h00) + uint128_t(0, l01) + uint128_t(0, l10);
+    lo = uint128_t(mid.low(), l00);
+    hi = uint128_t(h11, l11) + uint128_t(0, h01) + uint128_t(0, h10) + uint128_t(0, mid.high());
+}
+
+/**
+ * @brief Uniforme en [0, n) con el método de Lemire (n > 0)
+ *
+ * x * n / 2^128 con x uniforme en [0, 2^128) está sesgado sólo cuando la
+ * parte baja del producto cae por debajo de 2^128 mod n. Esa comprobación
+ * exige un módulo, pero sólo se calcula si la parte baja es menor que n
+ * (probabilidad n / 2^128): el caso normal es un producto y una comparación.
+ */
+template <std::uniform_random_bit_generator G> uint128_t bounded_uniform(G& g, const uint128_t& n)
+{
+    uint128_t hi, lo;
+    mul_wide(random_bits128(g), n, hi, lo);
+    if (lo < n) {
+        const uint128_t threshold = (uint128_t(0) - n) % n;
+        while (lo < threshold) {
+            mul_wide(random_bits128(g), n, hi, lo);
+        }
+    }
+    return hi;
+}
+
+/// Uniforme en [a, a + span], span = b - a; span == 2^128 - 1 es el rango completo
+template <std::uniform_random_bit_generator G>
+uint128_t uniform_in(G& g, const uint128_t& a, const uint128_t& span)
+{
+    if (span == ~uint128_t(0)) {
+        return random_bits128(g);
+    }
+    return a + bounded_uniform(g, span + uint128_t(1));
+}
+
+/**
+ * @brief out[i] uniforme en [a, a + span]
+ *
+ * Con los generadores de este fichero (los que tienen fill) los bits se
+ * sacan por bloques con el estado en registros. El umbral de rechazo
+ * (2^128 mod n) se guarda en threshold la primera vez que hace falta: quien
+ * llama por tramos con el mismo span pasa la misma caché y lo calcula como
+ * mucho una vez en total.
+ */
+template <std::uniform_random_bit_generator G>
+void generate_uniform(std::span<uint128_t> out, const uint128_t& a, const uint128_t& span, G& g,
+                      std::optional<uint128_t>& threshold)
+{
+    if (span == ~uint128_t(0)) {
+        for (uint128_t& x : out) {
+            x = random_bits128(g);
+        }
+        return;
+    }
+    const uint128_t n = span + uint128_t(1);
+    if constexpr (requires(std::span<uint64_t> block) { g.fill(block); }) {
+        constexpr std::size_t chunk = 256;
+        uint64_t bits[2 * chunk];
+        for (std::size_t base = 0; base < out.size(); base += chunk) {
+            const std::size_t k = std::min(chunk, out.size() - base);
+            g.fill(std::span<uint64_t>(bits, 2 * k));
+            for (std::size_t i = 0; i < k; ++i) {
+                uint128_t hi, lo;
+                mul_wide(uint128_t(bits[2 * i], bits[2 * i + 1]), n, hi, lo);
+                if (lo < n) {
+                    if (!threshold) {
+                        threshold = (uint128_t(0) - n) % n;
+                    }
+                    while (lo < *threshold) {
+                        mul_wide(random_bits128(g), n, hi, lo);
+                    }
+                }
+                out[base + i] = a + hi;
+            }
+        }
+    } else {
+        for (uint128_t& x : out) {
+            x = a + bounded_uniform(g, n);
+        }
+    }
+}
+
+/// out[i] uniforme en [a, a + span]; el umbral se calcula como mucho una vez
+template <std::uniform_random_bit_generator G>
+void generate_uniform(std::span<uint128_t> out, const uint128_t& a, const uint128_t& span, G& g)
+{
+    std::optional<uint128_t> threshold;
+    generate_uniform(out, a, span, g, threshold);
+}
+
+} // namespace detail
+
+/**
+ * @brief Distribución uniforme de enteros en [a, b] para uint128_t
+ *
+ * Misma interfaz que std::uniform_int_distribution (que no admite uint128_t).
+ * Sin divisiones en el caso normal: ver detail::bounded_uniform. Acepta
+ * cualquier std::uniform_random_bit_generator; con generadores de 64 bits
+ * cada valor consume dos salidas.
+ */
+class uniform_uint128_distribution
+{
+  public:
+    using result_type = uint128_t;
+
+    class param_type
+    {
+      public:
+        using distribution_type = uniform_uint128_distribution;
+
+        param_type() noexcept : a_(0), b_(~uint128_t(0)) {}
+
+        /// @throws std::invalid_argument si a > b
+        explicit param_type(const uint128_t& a, const uint128_t& b = ~uint128_t(0)) : a_(a), b_(b)
+        {
+            if (a > b) {
+                throw std::invalid_argument("uniform_uint128_distribution: a > b");
+            }
+        }
+
+        const uint128_t& a() const noexcept
+        {
+            return a_;
+        }
+
+        const uint128_t& b() const noexcept
+        {
+            return b_;
+        }
+
+        friend bool operator==(const param_type& x, const param_type& y) noexcept
+        {
+            return x.a_ == y.a_ && x.b_ == y.b_;
+        }
+
+      private:
+        uint128_t a_;
+        uint128_t b_;
+    };
+
+    uniform_uint128_distribution() noexcept = default;
+
+    /// @throws std::invalid_argument si a > b
+    explicit uniform_uint128_distribution(const uint128_t& a, const uint128_t& b = ~uint128_t(0))
+        : p_(a, b)
+    {
+    }
+
+    explicit uniform_uint128_distribution(const param_type& p) noexcept : p_(p) {}
+
+    /// Sin estado interno: no hace nada
+    void reset() noexcept {}
+
+    template <std::uniform_random_bit_generator G> result_type operator()(G& g)
+    {
+        return (*this)(g, p_);
+    }
+
+    template <std::uniform_random_bit_generator G> result_type operator()(G& g, const param_type& p)
+    {
+        return detail::uniform_in(g, p.a(), p.b() - p.a());
+    }
+
+    /// out[i] = (*this)(g) en bloque
+    template <std::uniform_random_bit_generator G> void generate(std::span<uint128_t> out, G& g)
+    {
+        detail::generate_uniform(out, p_.a(), p_.b() - p_.a(), g);
+    }
+
+    const uint128_t& a() const noexcept
+    {
+        return p_.a();
+    }
+
+    const uint128_t& b() const noexcept
+    {
+        return p_.b();
+    }
+
+    param_type param() const noexcept
+    {
+        return p_;
+    }
+
+    void param(const param_type& p) noexcept
+    {
+        p_ = p;
+    }
+
+    result_type min() const noexcept
+    {
+        return p_.a();
+    }
+
+    result_type max() const noexcept
+    {
+        return p_.b();
+    }
+
+    friend bool operator==(const uniform_uint128_distribution& x,
+                           const uniform_uint128_distribution& y) noexcept
+    {
+        return x.p_ == y.p_;
+    }
+
+  private:
+    param_type p_;
+};
+
+/**
+ * @brief out[i] uniforme en [0, bound)
+ * @throws std::invalid_argument si bound == 0
+ */
+template <std::uniform_random_bit_generator G>
+void generate(std::span<uint128_t> out, const uint128_t& bound, G& g)
+{
+    if (bound == uint128_t(0)) {
+        throw std::invalid_argument("nstd::generate: bound must be positive");
+    }
+    detail::generate_uniform(out, uint128_t(0), bound - uint128_t(1), g);
+}
+
+} // namespace nstd
+
+#endif // UINT128_RANDOM_HPP
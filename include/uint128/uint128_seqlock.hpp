@@ -0,0 +1,206 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_SEQLOCK_HPP
+#define UINT128_SEQLOCK_HPP
+
+/**
+ * @file uint128_seqlock.hpp
+ * @brief Celda de 128 bits protegida por seqlock, optimizada para lectores
+ *
+ * `ThreadSafeUint128RW` usa std::shared_mutex: incluso un lector escribe el
+ * contador del cerrojo, y la línea de caché rebota entre núcleos. En
+ * `seqlock128` los lectores no escriben nunca memoria compartida: leen el
+ * número de secuencia, el valor y otra vez la secuencia, y repiten si ha
+ * cambiado o es impar (escritura en curso). Los escritores se serializan
+ * entre sí haciendo impar la secuencia con un CAS.
+ *
+ * Ordenación según H.-J. Boehm ("Can seqlocks get along with programming
+ * language memory models?", 2012): el valor son dos std::atomic<uint64_t>,
+ * escritos con release y leídos con acquire. Si un lector ve cualquier mitad
+ * nueva, sincroniza con el escritor y su segunda lectura de la secuencia ve
+ * el valor impar. En x86 son mov normales; no hay carreras de datos en el
+ * sentido de C++20 ni vallas sueltas (atomic_thread_fence), que
+ * ThreadSanitizer no modela.
+ *
+ * Frente a atomic128: donde existe una carga atómica de 16 bytes (vmovdqa en
+ * Intel/AMD con AVX) atomic128::load() también es de sólo lectura y algo más
+ * barata; sin ella (AArch64 sin LSE2, x86 sin AVX) atomic128 lee con un CAS
+ * que escribe la línea, y seqlock128 es la opción que escala.
+ *
+ * @code{.cpp}
+ * nstd::seqlock_uint128 rate(uint128_t(1000));
+ * uint128_t r = rate.load();              // Lectores: sin escrituras compartidas
+ * rate.store(uint128_t(1001));            // Escritor
+ * rate.update([](uint128_t v) { return v * uint128_t(2); });
+ * @endcode
+ */
+
+#include "../int128/int128_t.hpp"
+#include "uint128_atomic.hpp"
+#include "uint128_t.hpp"
+#include <atomic>
+#include <cstdint>
+
+namespace nstd
+{
+
+/**
+ * @brief Valor de 128 bits con lecturas optimistas y escrituras serializadas
+ *
+ * Secuencia y valor comparten una línea de caché: una lectura sin escrituras
+ * concurrentes toca una sola línea y no la invalida en otros núcleos.
+ */
+template <atomic128_value T> class alignas(64) seqlock128
+{
+  public:
+    using value_type = T;
+
+    constexpr seqlock128() noexcept = default;
+    constexpr explicit seqlock128(T value) noexcept : lo_(value.low()), hi_(value.high()) {}
+
+    seqlock128(const seqlock128&) = delete;
+    seqlock128& operator=(const seqlock128&) = delete;
+
+    /**
+     * @brief Un intento de lectura; false si coincidió con una escritura
+     */
+    bool try_load(T& out) const noexcept
+    {
+        const uint64_t s1 = seq_.load(std::memory_order_acquire);
+        if (s1 & 1) {
+            return false;
+        }
+        const uint64_t lo = lo_.load(std::memory_order_acquire);
+        const uint64_t hi = hi_.load(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) != s1) {
+            return false;
+        }
+        out = T(hi, lo);
+        return true;
+    }
+
+    /// Lectura consistente: reintenta mientras haya escrituras en curso
+    T load() const noexcept
+    {
+        T value;
+        exponential_backoff backoff({1, 64, true});
+        while (!try_load(value)) {
+            backoff();
+        }
+        return value;
+    }
+
+    operator T() const noexcept
+    {
+        return load();
+    }
+
+    void store(T value) noexcept
+    {
+        const uint64_t s = lock();
+        write(value);
+        unlock(s);
+    }
+
+    seqlock128& operator=(T value) noexcept
+    {
+        store(value);
+        return *this;
+    }
+
+    /**
+     * @brief Sustituye v por f(v) dentro de la sección de escritura; devuelve f(v)
+     *
+     * f se ejecuta con los demás escritores bloqueados y los lectores
+     * reintentando: debe ser breve y no lanzar.
+     */
+    template <typename F> T update(F f) noexcept
+    {
+        const uint64_t s = lock();
+        const T next = f(T(hi_.load(std::memory_order_relaxed), lo_.load(std::memory_order_relaxed)));
+        write(next);
+        unlock(s);
+        return next;
+    }
+
+    /// Suma delta; devuelve el valor anterior
+    T fetch_add(T delta) noexcept
+    {
+        return update([delta](T v) { return v + delta; }) - delta;
+    }
+
+    T fetch_sub(T delta) noexcept
+    {
+        return update([delta](T v) { return v - delta; }) + delta;
+    }
+
+    /// Número de escrituras completadas (la secuencia avanza 2 por escritura)
+    uint64_t version() const noexcept
+    {
+        return seq_.load(std::memory_order_acquire) >> 1;
+    }
+
+  private:
+    // Hace impar la secuencia; devuelve el valor par previo
+    uint64_t lock() noexcept
+    {
+        exponential_backoff backoff;
+        uint64_t s = seq_.load(std::memory_order_relaxed);
+        for (;;) {
+            if (!(s & 1) &&
+                seq_.compare_exchange_weak(s, s + 1, std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+                return s;
+            }
+            backoff();
+            s = seq_.load(std::memory_order_relaxed);
+        }
+    }
+
+    // release: la secuencia impar queda ordenada antes de cada mitad
+    void write(T value) noexcept
+    {
+        lo_.store(value.low(), std::memory_order_release);
+        hi_.store(value.high(), std::memory_order_release);
+    }
+
+    void unlock(uint64_t s) noexcept
+    {
+        seq_.store(s + 2, std::memory_order_release);
+    }
+
+    std::atomic<uint64_t> seq_{0};
+    std::atomic<uint64_t> lo_{0};
+    std::atomic<uint64_t> hi_{0};
+};
+
+using seqlock_uint128 = seqlock128<uint128_t>;
+using seqlock_int128 = seqlock128<int128_t>;
+
+} // namespace nstd
+
+#endif // UINT128_SEQLOCK_HPP
@@ -0,0 +1,341 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_SHARDED_COUNTER_HPP
+#define UINT128_SHARDED_COUNTER_HPP
+
+/**
+ * @file uint128_sharded_counter.hpp
+ * @brief Contador de 128 bits repartido en fragmentos por hilo o por CPU
+ *
+ * Para contadores con muchas más escrituras que lecturas (bytes transferidos,
+ * totales contables, nanosegundos acumulados): cada hilo incrementa su propio
+ * fragmento, alineado a línea de caché, sin competir con los demás; read()
+ * suma todos los fragmentos en aritmética módulo 2^128, que es exacta aunque
+ * algún fragmento haya desbordado.
+ *
+ * - `shard_selection::thread`: cada hilo vivo recibe un índice único y denso;
+ *   los primeros shard_count() hilos tienen fragmento exclusivo y escriben con
+ *   una carga y un almacenamiento de 16 bytes, sin instrucción `lock`. Los
+ *   hilos restantes comparten fragmentos de desbordamiento con fetch_add.
+ * - `shard_selection::cpu`: fragmento de la CPU actual (`sched_getcpu`) con
+ *   fetch_add; un hilo puede migrar, pero rara vez coinciden dos en la misma CPU.
+ *
+ * Con fold_interval > 0 cada escritor traslada su fragmento a un total común
+ * cada fold_interval incrementos, y approximate() lee sólo ese total.
+ *
+ * @code{.cpp}
+ * nstd::sharded_uint128_counter bytes;
+ * bytes.add(uint128_t(packet.size()));   // En cualquier hilo
+ * uint128_t total = bytes.read();         // Suma de los fragmentos
+ * @endcode
+ */
+
+#include "../int128/int128_t.hpp"
+#include "uint128_atomic.hpp"
+#include "uint128_t.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace nstd
+{
+
+/// Criterio para elegir el fragmento que incrementa cada llamada
+enum class shard_selection { thread, cpu };
+
+namespace detail
+{
+
+/**
+ * @brief Índices de hilo densos y reutilizables
+ *
+ * Cada hilo obtiene el menor índice libre en su primer uso y lo devuelve al
+ * terminar, de modo que los índices de los hilos vivos son siempre únicos.
+ */
+class thread_index_registry
+{
+  public:
+    static thread_index_registry& instance()
+    {
+        static thread_index_registry registry;
+        return registry;
+    }
+
+    unsigned acquire()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_.empty()) {
+            return next_++;
+        }
+        const unsigned id = free_.top();
+        free_.pop();
+        return id;
+    }
+
+    void release(unsigned id)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push(id);
+    }
+
+  private:
+    std::mutex mutex_;
+    std::priority_queue<unsigned, std::vector<unsigned>, std::greater<unsigned>> free_;
+    unsigned next_ = 0;
+};
+
+struct thread_index_holder {
+    // El registro se construye antes que el primer holder: se destruye después
+    thread_index_registry& registry = thread_index_registry::instance();
+    unsigned id = registry.acquire();
+
+    ~thread_index_holder()
+    {
+        registry.release(id);
+    }
+};
+
+/// Índice del hilo actual: único entre los hilos vivos
+inline unsigned this_thread_index()
+{
+    thread_local thread_index_holder holder;
+    return holder.id;
+}
+
+/// CPU en la que se ejecuta el hilo (índice de hilo si no se puede consultar)
+inline unsigned this_cpu_index()
+{
+#if defined(__linux__)
+    const int cpu = sched_getcpu();
+    if (cpu >= 0) {
+        return static_cast<unsigned>(cpu);
+    }
+#endif
+    return this_thread_index();
+}
+
+} // namespace detail
+
+/**
+ * @brief Contador de 128 bits con fragmentos por hilo o por CPU
+ *
+ * add() desde cualquier número de hilos; read() desde cualquier hilo. read()
+ * no es una instantánea: con escrituras en curso devuelve la suma de cada
+ * fragmento en algún instante de la lectura (nunca valores partidos). Con
+ * los escritores detenidos el resultado es exacto.
+ */
+template <atomic128_value T = uint128_t> class sharded_counter128
+{
+  public:
+    using value_type = T;
+
+    /**
+     * @param selection Fragmento por hilo o por CPU
+     * @param shards Fragmentos (0 = hardware_concurrency redondeado a potencia de 2)
+     * @param fold_interval Incrementos entre traslados al total común (0 = nunca)
+     */
+    explicit sharded_counter128(shard_selection selection = shard_selection::thread,
+                                std::size_t shards = 0, uint32_t fold_interval = 0)
+        : selection_(selection), shard_count_(shard_count_for(shards)),
+          fold_interval_(fold_interval),
+          shards_(std::make_unique<shard[]>(selection == shard_selection::thread ? 2 * shard_count_
+                                                                                  : shard_count_))
+    {
+    }
+
+    sharded_counter128(const sharded_counter128&) = delete;
+    sharded_counter128& operator=(const sharded_counter128&) = delete;
+
+    std::size_t shard_count() const noexcept
+    {
+        return shard_count_;
+    }
+
+    shard_selection selection() const noexcept
+    {
+        return selection_;
+    }
+
+    /// Suma delta (módulo 2^128)
+    void add(T delta) noexcept
+    {
+        if (selection_ == shard_selection::thread) {
+            const unsigned id = detail::this_thread_index();
+            if (id < shard_count_) {
+                add_exclusive(shards_[id], delta);
+            } else {
+                add_shared(shards_[shard_count_ + (id & (shard_count_ - 1))], delta);
+            }
+        } else {
+            add_shared(shards_[detail::this_cpu_index() & (shard_count_ - 1)], delta);
+        }
+    }
+
+    void sub(T delta) noexcept
+    {
+        add(T(0) - delta);
+    }
+
+    void increment() noexcept
+    {
+        add(T(1));
+    }
+
+    /**
+     * @brief Total común más todos los fragmentos
+     *
+     * Si un escritor traslada su fragmento mientras se suma, la lectura se
+     * repite: un traslado no se cuenta nunca dos veces ni se pierde.
+     */
+    T read() const noexcept
+    {
+        const std::size_t total = slots();
+        exponential_backoff backoff;
+        for (;;) {
+            const uint64_t generation = fold_generation_.load(std::memory_order_seq_cst);
+            if (folds_in_progress_.load(std::memory_order_seq_cst) != 0) {
+                backoff();
+                continue;
+            }
+            T sum = base_.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < total; ++i) {
+                sum += shards_[i].value.load(std::memory_order_acquire);
+            }
+            if (folds_in_progress_.load(std::memory_order_seq_cst) == 0 &&
+                fold_generation_.load(std::memory_order_seq_cst) == generation) {
+                return sum;
+            }
+        }
+    }
+
+    /// Sólo el total común: lectura de 16 bytes, retrasada respecto a read()
+    T approximate() const noexcept
+    {
+        return base_.load(std::memory_order_acquire);
+    }
+
+    /// Pone el contador a 0. @pre Ningún hilo está llamando a add()
+    void reset() noexcept
+    {
+        base_.store(T(0));
+        for (std::size_t i = 0; i < slots(); ++i) {
+            shards_[i].value.store(T(0));
+            shards_[i].pending.store(0, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    struct alignas(64) shard {
+        atomic128<T> value;
+        std::atomic<uint32_t> pending{0}; // Incrementos desde el último traslado
+    };
+
+    static std::size_t shard_count_for(std::size_t requested) noexcept
+    {
+        if (requested == 0) {
+            requested = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return std::bit_ceil(requested);
+    }
+
+    std::size_t slots() const noexcept
+    {
+        return selection_ == shard_selection::thread ? 2 * shard_count_ : shard_count_;
+    }
+
+    // Un único escritor: carga + almacenamiento, sin RMW
+    void add_exclusive(shard& s, T delta) noexcept
+    {
+        const T next = s.value.load(std::memory_order_relaxed) + delta;
+        if (fold_interval_ == 0) {
+            s.value.store(next, std::memory_order_release);
+            return;
+        }
+        const uint32_t pending = s.pending.load(std::memory_order_relaxed) + 1;
+        if (pending < fold_interval_) {
+            s.pending.store(pending, std::memory_order_relaxed);
+            s.value.store(next, std::memory_order_release);
+            return;
+        }
+        begin_fold();
+        base_.fetch_add(next);
+        s.value.store(T(0));
+        s.pending.store(0, std::memory_order_relaxed);
+        end_fold();
+    }
+
+    // Varios escritores posibles
+    void add_shared(shard& s, T delta) noexcept
+    {
+        s.value.fetch_add(delta, std::memory_order_release);
+        if (fold_interval_ != 0 &&
+            s.pending.fetch_add(1, std::memory_order_relaxed) + 1 >= fold_interval_) {
+            s.pending.store(0, std::memory_order_relaxed);
+            begin_fold();
+            base_.fetch_add(s.value.exchange(T(0)));
+            end_fold();
+        }
+    }
+
+    void begin_fold() noexcept
+    {
+        folds_in_progress_.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    void end_fold() noexcept
+    {
+        fold_generation_.fetch_add(1, std::memory_order_seq_cst);
+        folds_in_progress_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    shard_selection selection_;
+    std::size_t shard_count_;
+    uint32_t fold_interval_;
+    std::unique_ptr<shard[]> shards_; // thread: [exclusivos | desbordamiento]
+    alignas(64) atomic128<T> base_;
+    alignas(64) std::atomic<uint32_t> folds_in_progress_{0};
+    std::atomic<uint64_t> fold_generation_{0};
+};
+
+using sharded_uint128_counter = sharded_counter128<uint128_t>;
+using sharded_int128_counter = sharded_counter128<int128_t>;
+
+} // namespace nstd
+
+#endif // UINT128_SHARDED_COUNTER_HPP
@@ -0,0 +1,968 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_SIMD_HPP
+#define UINT128_SIMD_HPP
+
+/**
+ * @file uint128_simd.hpp
+ * @brief Kernels vectoriales sobre spans contiguos de uint128_t (formato AoS)
+ *
+ * A diferencia de uint128_soa.hpp, aquí los datos siguen en su disposición
+ * natural (`std::vector<uint128_t>`, arrays, ...). Cada bloque se carga con
+ * una carga "deinterleave" que separa mitades altas y bajas en dos registros
+ * (4 valores por iteración con AVX2, 8 con AVX-512), se opera por carril y se
+ * vuelve a intercalar al guardar.
+ *
+ * Kernels en `nstd::simd`:
+ * - add, sub, mul_lo (128x128 -> 128 bajos), mul (por escalar de 64 bits)
+ * - shift_left / shift_right por una constante
+ * - bit_and / bit_or / bit_xor / bit_andnot
+ * - compare -> máscara de bits (mismo formato que nstd::soa::compare)
+ * - popcount_sum, and_popcount, popcount_each, countl_zero_each,
+ *   bit_width_histogram
+ *
+ * La ruta se elige en runtime con intrinsics::active_simd_level().
+ * `out` puede ser el mismo span que una de las entradas.
+ */
+
+#include "../intrinsics/arithmetic_operations.hpp"
+#include "../intrinsics/cpu_features.hpp"
+#include "../intrinsics/simd_operations.hpp"
+#include "uint128_soa.hpp"
+#include "uint128_t.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace nstd
+{
+namespace simd
+{
+
+using soa::cmp_op;
+using soa::mask;
+using soa::test;
+
+namespace detail
+{
+
+inline void require_binary(std::span<const uint128_t> a, std::span<const uint128_t> b,
+                           std::span<uint128_t> out)
+{
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("nstd::simd: operand sizes differ");
+    }
+    if (out.size() < a.size()) {
+        throw std::invalid_argument("nstd::simd: output span too small");
+    }
+}
+
+inline void require_unary(std::span<const uint128_t> a, std::span<uint128_t> out)
+{
+    if (out.size() < a.size()) {
+        throw std::invalid_argument("nstd::simd: output span too small");
+    }
+}
+
+// ============================================================================
+// OPERACIONES ESCALARES POR ELEMENTO
+// ============================================================================
+
+inline uint128_t mul_by_u64(const uint128_t& a, uint64_t s) noexcept
+{
+    uint64_t hi = 0;
+    const uint64_t lo = intrinsics::umul128(a.low(), s, &hi);
+    return uint128_t(hi + a.high() * s, lo);
+}
+
+inline uint128_t shl(const uint128_t& a, unsigned s) noexcept
+{
+    return a.shift_left(static_cast<int>(s));
+}
+
+inline uint128_t shr(const uint128_t& a, unsigned s) noexcept
+{
+    return a.shift_right(static_cast<int>(s));
+}
+
+#if INTRINSICS_HAS_SIMD_128_LANES
+
+// ============================================================================
+// AVX2: funtores por carril y bucles genéricos (4 valores por iteración)
+// ============================================================================
+// Los funtores llevan el atributo target en operator() para que los bucles
+// plantilla (también con target) puedan inlinearlos.
+
+namespace avx2
+{
+
+namespace v = intrinsics::simd::avx2;
+
+struct add_op {
+    INTRINSICS_TARGET("avx2")
+    void operator()(__m256i ah, __m256i al, __m256i bh, __m256i bl, __m256i& rh, __m256i& rl) const noexcept
+    {
+        v::add128(ah, al, bh, bl, rh, rl);
+    }
+};
+
+struct sub_op {
+    INTRINSICS_TARGET("avx2")
+    void operator()(__m256i ah, __m256i al, __m256i bh, __m256i bl, __m256i& rh, __m256i& rl) const noexcept
+    {
+        v::sub128(ah, al, bh, bl, rh, rl);
+    }
+};
+
+struct mul_op {
+    INTRINSICS_TARGET("avx2")
+    void operator()(__m256i ah, __m256i al, __m256i bh, __m256i bl, __m256i& rh, __m256i& rl) const noexcept
+    {
+        v::mul128_lo(ah, al, bh, bl, rh, rl);
+    }
+};
+
+struct mul_scalar_op {
+    uint64_t s;
+    INTRINSICS_TARGET("avx2") void operator()(__m256i ah, __m256i al, __m256i& rh, __m256i& rl) const noexcept
+    {
+        const __m256i vs = _mm256_set1_epi64x(static_cast<long long>(s));
+        __m256i h;
+        v::mul64x64(al, vs, h, rl);
+        rh = _mm256_add_epi64(h, v::mullo64(ah, vs));
+    }
+};
+
+struct shl_op {
+    unsigned s;
+    INTRINSICS_TARGET("avx2") void operator()(__m256i ah, __m256i al, __m256i& rh, __m256i& rl) const noexcept
+    {
+        v::shl128(ah, al, s, rh, rl);
+    }
+};
+
+struct shr_op {
+    unsigned s;
+    INTRINSICS_TARGET("avx2") void operator()(__m256i ah, __m256i al, __m256i& rh, __m256i& rl) const noexcept
+    {
+        v::shr128(ah, al, s, rh, rl);
+    }
+};
+
+/// @return Elementos procesados (múltiplo de 4); el resto queda para la ruta escalar
+template <typename Op>
+INTRINSICS_TARGET("avx2")
+std::size_t binary(const uint128_t* a, const uint128_t* b, uint128_t* out, std::size_t n, Op op) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i ah, al, bh, bl, rh, rl;
+        v::load_deinterleave(a + i, ah, al);
+        v::load_deinterleave(b + i, bh, bl);
+        op(ah, al, bh, bl, rh, rl);
+        v::interleave_store(out + i, rh, rl);
+    }
+    return i;
+}
+
+template <typename Op>
+INTRINSICS_TARGET("avx2")
+std::size_t unary(const uint128_t* a, uint128_t* out, std::size_t n, Op op) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i ah, al, rh, rl;
+        v::load_deinterleave(a + i, ah, al);
+        op(ah, al, rh, rl);
+        v::interleave_store(out + i, rh, rl);
+    }
+    return i;
+}
+
+/// Las operaciones bit a bit no necesitan separar mitades: 2 valores por registro
+INTRINSICS_TARGET("avx2")
+inline std::size_t bitwise(const uint128_t* a, const uint128_t* b, uint128_t* out, std::size_t n,
+                           int op) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i z = op == 0   ? _mm256_and_si256(x, y)
+                          : op == 1 ? _mm256_or_si256(x, y)
+                          : op == 2 ? _mm256_xor_si256(x, y)
+                                    : _mm256_andnot_si256(y, x);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), z);
+    }
+    return i;
+}
+
+/// b_stride 0: b apunta a un único valor (comparación contra escalar)
+INTRINSICS_TARGET("avx2")
+inline std::size_t compare(const uint128_t* a, const uint128_t* b, std::size_t b_stride,
+                           std::size_t n, cmp_op op, uint64_t* m) noexcept
+{
+    const __m256i bh_scalar = _mm256_set1_epi64x(static_cast<long long>(b[0].high()));
+    const __m256i bl_scalar = _mm256_set1_epi64x(static_cast<long long>(b[0].low()));
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i ah, al, bh = bh_scalar, bl = bl_scalar;
+        v::load_deinterleave(a + i, ah, al);
+        if (b_stride != 0) {
+            v::load_deinterleave(b + i, bh, bl);
+        }
+        const auto lt = static_cast<uint64_t>(
+            _mm256_movemask_pd(_mm256_castsi256_pd(v::lt128(ah, al, bh, bl))));
+        const auto eq = static_cast<uint64_t>(
+            _mm256_movemask_pd(_mm256_castsi256_pd(v::eq128(ah, al, bh, bl))));
+        m[i / 64] |= soa::detail::combine(op, lt, eq, 0xF) << (i % 64);
+    }
+    return i;
+}
+
+} // namespace avx2
+
+// ============================================================================
+// AVX-512: 8 valores por iteración
+// ============================================================================
+
+namespace avx512
+{
+
+namespace v = intrinsics::simd::avx512;
+
+struct add_op {
+    INTRINSICS_TARGET("avx512f")
+    void operator()(__m512i ah, __m512i al, __m512i bh, __m512i bl, __m512i& rh, __m512i& rl) const noexcept
+    {
+        v::add128(ah, al, bh, bl, rh, rl);
+    }
+};
+
+struct sub_op {
+    INTRINSICS_TARGET("avx512f")
+    void operator()(__m512i ah, __m512i al, __m512i bh, __m512i bl, __m512i& rh, __m512i& rl) const noexcept
+    {
+        v::sub128(ah, al, bh, bl, rh, rl);
+    }
+};
+
+struct mul_op {
+    INTRINSICS_TARGET("avx512f")
+    void operator()(__m512i ah, __m512i al, __m512i bh, __m512i bl, __m512i& rh, __m512i& rl) const noexcept
+    {
+        v::mul128_lo(ah, al, bh, bl, rh, rl);
+    }
+};
+
+struct mul_scalar_op {
+    uint64_t s;
+    INTRINSICS_TARGET("avx512f") void operator()(__m512i ah, __m512i al, __m512i& rh, __m512i& rl) const noexcept
+    {
+        const __m512i vs = _mm512_set1_epi64(static_cast<long long>(s));
+        __m512i h;
+        v::mul64x64(al, vs, h, rl);
+        rh = _mm512_add_epi64(h, v::mullo64(ah, vs));
+    }
+};
+
+struct shl_op {
+    unsigned s;
+    INTRINSICS_TARGET("avx512f") void operator()(__m512i ah, __m512i al, __m512i& rh, __m512i& rl) const noexcept
+    {
+        v::shl128(ah, al, s, rh, rl);
+    }
+};
+
+struct shr_op {
+    unsigned s;
+    INTRINSICS_TARGET("avx512f") void operator()(__m512i ah, __m512i al, __m512i& rh, __m512i& rl) const noexcept
+    {
+        v::shr128(ah, al, s, rh, rl);
+    }
+};
+
+template <typename Op>
+INTRINSICS_TARGET("avx512f")
+std::size_t binary(const uint128_t* a, const uint128_t* b, uint128_t* out, std::size_t n, Op op) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i ah, al, bh, bl, rh, rl;
+        v::load_deinterleave(a + i, ah, al);
+        v::load_deinterleave(b + i, bh, bl);
+        op(ah, al, bh, bl, rh, rl);
+        v::interleave_store(out + i, rh, rl);
+    }
+    return i;
+}
+
+template <typename Op>
+INTRINSICS_TARGET("avx512f")
+std::size_t unary(const uint128_t* a, uint128_t* out, std::size_t n, Op op) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i ah, al, rh, rl;
+        v::load_deinterleave(a + i, ah, al);
+        op(ah, al, rh, rl);
+        v::interleave_store(out + i, rh, rl);
+    }
+    return i;
+}
+
+INTRINSICS_TARGET("avx512f")
+inline std::size_t bitwise(const uint128_t* a, const uint128_t* b, uint128_t* out, std::size_t n,
+                           int op) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m512i x = _mm512_loadu_si512(a + i);
+        const __m512i y = _mm512_loadu_si512(b + i);
+        // maskz_andnot: _mm512_andnot_si512 de GCC 12 parte de un vector sin inicializar
+        const __m512i z = op == 0   ? _mm512_and_si512(x, y)
+                          : op == 1 ? _mm512_or_si512(x, y)
+                          : op == 2 ? _mm512_xor_si512(x, y)
+                                    : _mm512_maskz_andnot_epi64(0xFF, y, x);
+        _mm512_storeu_si512(out + i, z);
+    }
+    return i;
+}
+
+INTRINSICS_TARGET("avx512f")
+inline std::size_t compare(const uint128_t* a, const uint128_t* b, std::size_t b_stride,
+                           std::size_t n, cmp_op op, uint64_t* m) noexcept
+{
+    const __m512i bh_scalar = _mm512_set1_epi64(static_cast<long long>(b[0].high()));
+    const __m512i bl_scalar = _mm512_set1_epi64(static_cast<long long>(b[0].low()));
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i ah, al, bh = bh_scalar, bl = bl_scalar;
+        v::load_deinterleave(a + i, ah, al);
+        if (b_stride != 0) {
+            v::load_deinterleave(b + i, bh, bl);
+        }
+        const auto lt = static_cast<uint64_t>(v::lt128(ah, al, bh, bl));
+        const auto eq = static_cast<uint64_t>(v::eq128(ah, al, bh, bl));
+        m[i / 64] |= soa::detail::combine(op, lt, eq, 0xFF) << (i % 64);
+    }
+    return i;
+}
+
+} // namespace avx512
+
+#endif // INTRINSICS_HAS_SIMD_128_LANES
+
+// Despacha a la ruta vectorial; devuelve cuántos elementos quedan resueltos
+#if INTRINSICS_HAS_SIMD_128_LANES
+#define UINT128_SIMD_DISPATCH(avx512_call, avx2_call)                                              \
+    [&]() -> std::size_t {                                                                         \
+        switch (intrinsics::active_simd_level()) {                                                 \
+        case intrinsics::simd_level::avx512:                                                       \
+            return avx512_call;                                                                    \
+        case intrinsics::simd_level::avx2:                                                         \
+            return avx2_call;                                                                      \
+        default:                                                                                   \
+            return 0;                                                                              \
+        }                                                                                          \
+    }()
+#else
+#define UINT128_SIMD_DISPATCH(avx512_call, avx2_call) std::size_t{0}
+#endif
+
+} // namespace detail
+
+// ============================================================================
+// API PÚBLICA
+// ============================================================================
+
+/**
+ * @brief out[i] = a[i] + b[i] (módulo 2^128)
+ * @throws std::invalid_argument si a y b difieren en tamaño o out es más corto
+ */
+inline void add(std::span<const uint128_t> a, std::span<const uint128_t> b, std::span<uint128_t> out)
+{
+    detail::require_binary(a, b, out);
+    const std::size_t n = a.size();
+    std::size_t i = UINT128_SIMD_DISPATCH(
+        detail::avx512::binary(a.data(), b.data(), out.data(), n, detail::avx512::add_op{}),
+        detail::avx2::binary(a.data(), b.data(), out.data(), n, detail::avx2::add_op{}));
+    for (; i < n; ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+/**
+ * @brief out[i] = a[i] - b[i] (módulo 2^128)
+ */
+inline void sub(std::span<const uint128_t> a, std::span<const uint128_t> b, std::span<uint128_t> out)
+{
+    detail::require_binary(a, b, out);
+    const std::size_t n = a.size();
+    std::size_t i = UINT128_SIMD_DISPATCH(
+        detail::avx512::binary(a.data(), b.data(), out.data(), n, detail::avx512::sub_op{}),
+        detail::avx2::binary(a.data(), b.data(), out.data(), n, detail::avx2::sub_op{}));
+    for (; i < n; ++i) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+/**
+ * @brief out[i] = a[i] * b[i] (128 bits bajos del producto)
+ *
+ * Sin multiplicador vectorial 64x64 -> 128, el producto se compone con
+ * vpmuludq (32x32 -> 64); el beneficio frente a MULX escalar es menor que en
+ * add/sub y depende de la microarquitectura (ver benchmark).
+ */
+inline void mul_lo(std::span<const uint128_t> a, std::span<const uint128_t> b, std::span<uint128_t> out)
+{
+    detail::require_binary(a, b, out);
+    const std::size_t n = a.size();
+    std::size_t i = UINT128_SIMD_DISPATCH(
+        detail::avx512::binary(a.data(), b.data(), out.data(), n, detail::avx512::mul_op{}),
+        detail::avx2::binary(a.data(), b.data(), out.data(), n, detail::avx2::mul_op{}));
+    for (; i < n; ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+/**
+ * @brief out[i] = a[i] * scalar (módulo 2^128)
+ */
+inline void mul(std::span<const uint128_t> a, uint64_t scalar, std::span<uint128_t> out)
+{
+    detail::require_unary(a, out);
+    const std::size_t n = a.size();
+    std::size_t i = UINT128_SIMD_DISPATCH(
+        detail::avx512::unary(a.data(), out.data(), n, detail::avx512::mul_scalar_op{scalar}),
+        detail::avx2::unary(a.data(), out.data(), n, detail::avx2::mul_scalar_op{scalar}));
+    for (; i < n; ++i) {
+        out[i] = detail::mul_by_u64(a[i], scalar);
+    }
+}
+
+/**
+ * @brief out[i] = a[i] << s (s >= 128 produce 0, como uint128_t::shift_left)
+ */
+inline void shift_left(std::span<const uint128_t> a, unsigned s, std::span<uint128_t> out)
+{
+    detail::require_unary(a, out);
+    const std::size_t n = a.size();
+    std::size_t i = 0;
+    if (s < 128) {
+        i = UINT128_SIMD_DISPATCH(
+            detail::avx512::unary(a.data(), out.data(), n, detail::avx512::shl_op{s}),
+            detail::avx2::unary(a.data(), out.data(), n, detail::avx2::shl_op{s}));
+    }
+    for (; i < n; ++i) {
+        out[i] = detail::shl(a[i], s);
+    }
+}
+
+/**
+ * @brief out[i] = a[i] >> s (lógico; s >= 128 produce 0)
+ */
+inline void shift_right(std::span<const uint128_t> a, unsigned s, std::span<uint128_t> out)
+{
+    detail::require_unary(a, out);
+    const std::size_t n = a.size();
+    std::size_t i = 0;
+    if (s < 128) {
+        i = UINT128_SIMD_DISPATCH(
+            detail::avx512::unary(a.data(), out.data(), n, detail::avx512::shr_op{s}),
+            detail::avx2::unary(a.data(), out.data(), n, detail::avx2::shr_op{s}));
+    }
+    for (; i < n; ++i) {
+        out[i] = detail::shr(a[i], s);
+    }
+}
+
+namespace detail
+{
+
+inline void bitwise(std::span<const uint128_t> a, std::span<const uint128_t> b,
+                    std::span<uint128_t> out, int op)
+{
+    require_binary(a, b, out);
+    const std::size_t n = a.size();
+    std::size_t i = UINT128_SIMD_DISPATCH(avx512::bitwise(a.data(), b.data(), out.data(), n, op),
+                                          avx2::bitwise(a.data(), b.data(), out.data(), n, op));
+    for (; i < n; ++i) {
+        out[i] = op == 0   ? (a[i] & b[i])
+                 : op == 1 ? (a[i] | b[i])
+                 : op == 2 ? (a[i] ^ b[i])
+                           : (a[i] & ~b[i]);
+    }
+}
+
+inline mask compare(std::span<const uint128_t> a, const uint128_t* b, std::size_t b_stride,
+                    cmp_op op)
+{
+    const std::size_t n = a.size();
+    mask m((n + 63) / 64, 0);
+    if (n == 0) {
+        return m;
+    }
+    std::size_t i = UINT128_SIMD_DISPATCH(avx512::compare(a.data(), b, b_stride, n, op, m.data()),
+                                          avx2::compare(a.data(), b, b_stride, n, op, m.data()));
+    for (; i < n; ++i) {
+        const uint128_t& y = b[i * b_stride];
+        const uint64_t lt = a[i] < y ? 1 : 0;
+        const uint64_t eq = a[i] == y ? 1 : 0;
+        m[i / 64] |= soa::detail::combine(op, lt, eq, 1) << (i % 64);
+    }
+    return m;
+}
+
+} // namespace detail
+
+/// out[i] = a[i] & b[i]
+inline void bit_and(std::span<const uint128_t> a, std::span<const uint128_t> b, std::span<uint128_t> out)
+{
+    detail::bitwise(a, b, out, 0);
+}
+
+/// out[i] = a[i] | b[i]
+inline void bit_or(std::span<const uint128_t> a, std::span<const uint128_t> b, std::span<uint128_t> out)
+{
+    detail::bitwise(a, b, out, 1);
+}
+
+/// out[i] = a[i] ^ b[i]
+inline void bit_xor(std::span<const uint128_t> a, std::span<const uint128_t> b, std::span<uint128_t> out)
+{
+    detail::bitwise(a, b, out, 2);
+}
+
+/// out[i] = a[i] & ~b[i]
+inline void bit_andnot(std::span<const uint128_t> a, std::span<const uint128_t> b, std::span<uint128_t> out)
+{
+    detail::bitwise(a, b, out, 3);
+}
+
+/**
+ * @brief Compara elemento a elemento: bit i de la máscara = (a[i] op b[i])
+ * @throws std::invalid_argument si los tamaños difieren
+ */
+inline mask compare(std::span<const uint128_t> a, std::span<const uint128_t> b, cmp_op op)
+{
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("nstd::simd: operand sizes differ");
+    }
+    return detail::compare(a, b.data(), 1, op);
+}
+
+/**
+ * @brief Compara cada elemento contra un escalar: bit i = (a[i] op value)
+ */
+inline mask compare(std::span<const uint128_t> a, const uint128_t& value, cmp_op op)
+{
+    return detail::compare(a, &value, 0, op);
+}
+
+// ============================================================================
+// ESTADÍSTICAS DE BITS
+// ============================================================================
+
+namespace detail
+{
+
+inline void require_counts(std::span<const uint128_t> a, std::span<uint8_t> out)
+{
+    if (out.size() < a.size()) {
+        throw std::invalid_argument("nstd::simd: output span too small");
+    }
+}
+
+inline int clz128(const uint128_t& x) noexcept
+{
+    if (x.high() != 0) {
+        return intrinsics::clz64(x.high());
+    }
+    return x.low() != 0 ? 64 + intrinsics::clz64(x.low()) : 128;
+}
+
+#if INTRINSICS_HAS_SIMD_128_LANES
+
+// Bucles escalares con POPCNT / LZCNT por atributo target: el binario base
+// (x86-64 sin -m...) no los emite, y sirven de cola a las rutas vectoriales
+namespace hw
+{
+
+INTRINSICS_TARGET("popcnt") inline uint64_t popcount_sum(const uint128_t* a, std::size_t n) noexcept
+{
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += _mm_popcnt_u64(a[i].high()) + _mm_popcnt_u64(a[i].low());
+    }
+    return sum;
+}
+
+INTRINSICS_TARGET("popcnt")
+inline uint64_t and_popcount(const uint128_t* a, const uint128_t* b, std::size_t n) noexcept
+{
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += _mm_popcnt_u64(a[i].high() & b[i].high()) + _mm_popcnt_u64(a[i].low() & b[i].low());
+    }
+    return sum;
+}
+
+INTRINSICS_TARGET("popcnt")
+inline void popcount_each(const uint128_t* a, uint8_t* out, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<uint8_t>(_mm_popcnt_u64(a[i].high()) + _mm_popcnt_u64(a[i].low()));
+    }
+}
+
+// lzcnt(0) = 64: la parte baja solo cuenta si la alta es cero (h == 64)
+INTRINSICS_TARGET("lzcnt")
+inline void countl_zero_each(const uint128_t* a, uint8_t* out, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const uint64_t h = _lzcnt_u64(a[i].high());
+        out[i] = static_cast<uint8_t>(h + (_lzcnt_u64(a[i].low()) & (0 - (h >> 6))));
+    }
+}
+
+} // namespace hw
+
+namespace avx2
+{
+
+// Harley-Seal sobre bloques de 32 valores (16 registros de 256 bits)
+INTRINSICS_TARGET("avx2,popcnt") inline uint64_t popcount_sum(const uint128_t* a, std::size_t n) noexcept
+{
+    const std::size_t blocks = n / 32;
+    return v::popcount_harley_seal(a, blocks) + hw::popcount_sum(a + blocks * 32, n - blocks * 32);
+}
+
+// 8 valores por iteración: los contadores de 64 bits se empaquetan a bytes
+INTRINSICS_TARGET("avx2,popcnt")
+inline void popcount_each(const uint128_t* a, uint8_t* out, std::size_t n) noexcept
+{
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i h0, l0, h1, l1;
+        v::load_deinterleave(a + i, h0, l0);
+        v::load_deinterleave(a + i + 4, h1, l1);
+        const __m256i c0 = _mm256_add_epi64(v::popcount_epi64(h0), v::popcount_epi64(l0));
+        const __m256i c1 = _mm256_add_epi64(v::popcount_epi64(h1), v::popcount_epi64(l1));
+        const __m128i d0 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(c0, even));
+        const __m128i d1 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(c1, even));
+        const __m128i w = _mm_packus_epi32(d0, d1);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(w, w));
+    }
+    hw::popcount_each(a + i, out + i, n - i);
+}
+
+// Carga del registro k de a & b para harley_seal
+struct load_and {
+    const __m256i* a;
+    const __m256i* b;
+    INTRINSICS_TARGET("avx2") __m256i operator()(std::size_t k) const noexcept
+    {
+        return _mm256_and_si256(_mm256_loadu_si256(a + k), _mm256_loadu_si256(b + k));
+    }
+};
+
+INTRINSICS_TARGET("avx2,popcnt")
+inline uint64_t and_popcount(const uint128_t* a, const uint128_t* b, std::size_t n) noexcept
+{
+    const std::size_t blocks = n / 32;
+    const std::size_t done = blocks * 32;
+    return v::harley_seal(load_and{reinterpret_cast<const __m256i*>(a), reinterpret_cast<const __m256i*>(b)},
+                          blocks) +
+           hw::and_popcount(a + done, b + done, n - done);
+}
+
+} // namespace avx2
+
+namespace avx512
+{
+
+// _mm512_reduce_add_epi64, _mm512_castsi512_si256 y _mm512_cvtepi64_epi8 de
+// GCC 12 parten de un _mm*_undefined_*() y disparan -Wuninitialized; las
+// formas maskz con la máscara completa emiten la misma instrucción
+INTRINSICS_TARGET("avx512f")
+inline uint64_t reduce_add_epi64(__m512i x) noexcept
+{
+    const __m256i s = _mm256_add_epi64(_mm512_maskz_extracti64x4_epi64(0xF, x, 0),
+                                       _mm512_maskz_extracti64x4_epi64(0xF, x, 1));
+    const __m128i t = _mm_add_epi64(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1));
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(t)) + static_cast<uint64_t>(_mm_extract_epi64(t, 1));
+}
+
+INTRINSICS_TARGET("avx512f")
+inline __m128i cvtepi64_epi8(__m512i x) noexcept
+{
+    return _mm512_maskz_cvtepi64_epi8(0xFF, x);
+}
+
+INTRINSICS_TARGET("avx512f,avx512vpopcntdq,popcnt")
+inline uint64_t and_popcount(const uint128_t* a, const uint128_t* b, std::size_t n) noexcept
+{
+    const __m512i* p = reinterpret_cast<const __m512i*>(a);
+    const __m512i* q = reinterpret_cast<const __m512i*>(b);
+    __m512i acc0 = _mm512_setzero_si512(), acc1 = acc0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8, p += 2, q += 2) {
+        const __m512i x0 = _mm512_and_si512(_mm512_loadu_si512(p), _mm512_loadu_si512(q));
+        const __m512i x1 = _mm512_and_si512(_mm512_loadu_si512(p + 1), _mm512_loadu_si512(q + 1));
+        acc0 = _mm512_add_epi64(acc0, v::popcount_epi64(x0));
+        acc1 = _mm512_add_epi64(acc1, v::popcount_epi64(x1));
+    }
+    return static_cast<uint64_t>(reduce_add_epi64(_mm512_add_epi64(acc0, acc1))) +
+           hw::and_popcount(a + i, b + i, n - i);
+}
+
+// VPOPCNTQ no necesita separar mitades para la suma; cuatro acumuladores
+// (16 valores por iteración) ocultan la latencia de la suma
+INTRINSICS_TARGET("avx512f,avx512vpopcntdq,popcnt")
+inline uint64_t popcount_sum(const uint128_t* a, std::size_t n) noexcept
+{
+    const __m512i* p = reinterpret_cast<const __m512i*>(a);
+    __m512i acc0 = _mm512_setzero_si512(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16, p += 4) {
+        acc0 = _mm512_add_epi64(acc0, v::popcount_epi64(_mm512_loadu_si512(p)));
+        acc1 = _mm512_add_epi64(acc1, v::popcount_epi64(_mm512_loadu_si512(p + 1)));
+        acc2 = _mm512_add_epi64(acc2, v::popcount_epi64(_mm512_loadu_si512(p + 2)));
+        acc3 = _mm512_add_epi64(acc3, v::popcount_epi64(_mm512_loadu_si512(p + 3)));
+    }
+    const __m512i acc = _mm512_add_epi64(_mm512_add_epi64(acc0, acc1), _mm512_add_epi64(acc2, acc3));
+    return static_cast<uint64_t>(reduce_add_epi64(acc)) + hw::popcount_sum(a + i, n - i);
+}
+
+INTRINSICS_TARGET("avx512f,avx512vpopcntdq,popcnt")
+inline void popcount_each(const uint128_t* a, uint8_t* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i hi, lo;
+        v::load_deinterleave(a + i, hi, lo);
+        const __m512i c = _mm512_add_epi64(v::popcount_epi64(hi), v::popcount_epi64(lo));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), cvtepi64_epi8(c));
+    }
+    hw::popcount_each(a + i, out + i, n - i);
+}
+
+// VPLZCNTQ por mitades; la baja se suma en los carriles con la alta a cero
+INTRINSICS_TARGET("avx512f,avx512cd,lzcnt")
+inline void countl_zero_each(const uint128_t* a, uint8_t* out, std::size_t n) noexcept
+{
+    const __m512i sixty_four = _mm512_set1_epi64(64);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i hi, lo;
+        v::load_deinterleave(a + i, hi, lo);
+        const __m512i zh = _mm512_lzcnt_epi64(hi);
+        const __mmask8 high_zero = _mm512_cmpeq_epi64_mask(zh, sixty_four);
+        const __m512i z = _mm512_mask_add_epi64(zh, high_zero, zh, _mm512_lzcnt_epi64(lo));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), cvtepi64_epi8(z));
+    }
+    hw::countl_zero_each(a + i, out + i, n - i);
+}
+
+} // namespace avx512
+
+#endif // INTRINSICS_HAS_SIMD_128_LANES
+
+inline uint64_t popcount_sum(const uint128_t* a, std::size_t n) noexcept
+{
+#if INTRINSICS_HAS_SIMD_128_LANES
+    const auto level = intrinsics::active_simd_level();
+    if (level == intrinsics::simd_level::avx512 && intrinsics::cpu().avx512_vpopcntdq) {
+        return avx512::popcount_sum(a, n);
+    }
+    if (level != intrinsics::simd_level::scalar) {
+        return avx2::popcount_sum(a, n);
+    }
+    if (intrinsics::cpu().popcnt) {
+        return hw::popcount_sum(a, n);
+    }
+#endif
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += static_cast<uint64_t>(intrinsics::popcount64(a[i].high()) +
+                                     intrinsics::popcount64(a[i].low()));
+    }
+    return sum;
+}
+
+inline uint64_t and_popcount(const uint128_t* a, const uint128_t* b, std::size_t n) noexcept
+{
+#if INTRINSICS_HAS_SIMD_128_LANES
+    const auto level = intrinsics::active_simd_level();
+    if (level == intrinsics::simd_level::avx512 && intrinsics::cpu().avx512_vpopcntdq) {
+        return avx512::and_popcount(a, b, n);
+    }
+    if (level != intrinsics::simd_level::scalar) {
+        return avx2::and_popcount(a, b, n);
+    }
+    if (intrinsics::cpu().popcnt) {
+        return hw::and_popcount(a, b, n);
+    }
+#endif
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += static_cast<uint64_t>(intrinsics::popcount64(a[i].high() & b[i].high()) +
+                                     intrinsics::popcount64(a[i].low() & b[i].low()));
+    }
+    return sum;
+}
+
+inline void popcount_each(const uint128_t* a, uint8_t* out, std::size_t n) noexcept
+{
+#if INTRINSICS_HAS_SIMD_128_LANES
+    const auto level = intrinsics::active_simd_level();
+    if (level == intrinsics::simd_level::avx512 && intrinsics::cpu().avx512_vpopcntdq) {
+        return avx512::popcount_each(a, out, n);
+    }
+    if (level != intrinsics::simd_level::scalar) {
+        return avx2::popcount_each(a, out, n);
+    }
+    if (intrinsics::cpu().popcnt) {
+        return hw::popcount_each(a, out, n);
+    }
+#endif
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<uint8_t>(intrinsics::popcount64(a[i].high()) +
+                                      intrinsics::popcount64(a[i].low()));
+    }
+}
+
+// AVX2 no tiene lzcnt por carril: ahí la ruta es LZCNT escalar
+inline void countl_zero_each(const uint128_t* a, uint8_t* out, std::size_t n) noexcept
+{
+#if INTRINSICS_HAS_SIMD_128_LANES
+    const auto& cpu = intrinsics::cpu();
+    if (intrinsics::active_simd_level() == intrinsics::simd_level::avx512 && cpu.avx512cd && cpu.lzcnt) {
+        return avx512::countl_zero_each(a, out, n);
+    }
+    if (cpu.lzcnt) {
+        return hw::countl_zero_each(a, out, n);
+    }
+#endif
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<uint8_t>(clz128(a[i]));
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Suma de popcount(a[i]) sobre todo el span
+ *
+ * AVX-512 con VPOPCNTDQ: VPOPCNTQ con cuatro acumuladores. AVX2: Harley-Seal
+ * por bloques de 32 valores. Escalar: POPCNT si la CPU lo tiene.
+ */
+inline uint64_t popcount_sum(std::span<const uint128_t> a) noexcept
+{
+    return detail::popcount_sum(a.data(), a.size());
+}
+
+/**
+ * @brief Suma de popcount(a[i] & b[i]) sin escribir el AND intermedio
+ * @throws std::invalid_argument si los tamaños difieren
+ */
+inline uint64_t and_popcount(std::span<const uint128_t> a, std::span<const uint128_t> b)
+{
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("nstd::simd: operand sizes differ");
+    }
+    return detail::and_popcount(a.data(), b.data(), a.size());
+}
+
+/**
+ * @brief out[i] = popcount(a[i]) (0..128)
+ * @throws std::invalid_argument si out es más corto que a
+ */
+inline void popcount_each(std::span<const uint128_t> a, std::span<uint8_t> out)
+{
+    detail::require_counts(a, out);
+    detail::popcount_each(a.data(), out.data(), a.size());
+}
+
+/**
+ * @brief out[i] = countl_zero(a[i]) (0..128; 128 para el cero)
+ *
+ * VPLZCNTQ con AVX-512CD; si no, LZCNT escalar sin ramas.
+ * @throws std::invalid_argument si out es más corto que a
+ */
+inline void countl_zero_each(std::span<const uint128_t> a, std::span<uint8_t> out)
+{
+    detail::require_counts(a, out);
+    detail::countl_zero_each(a.data(), out.data(), a.size());
+}
+
+/**
+ * @brief hist[w] = número de elementos con bit_width(a[i]) == w (w = 0..128)
+ *
+ * Por bloques: countl_zero_each sobre un buffer local y cuatro histogramas
+ * parciales, para que valores repetidos no encadenen incrementos sobre la
+ * misma cubeta.
+ */
+inline std::array<std::size_t, 129> bit_width_histogram(std::span<const uint128_t> a) noexcept
+{
+    constexpr std::size_t block = 1024;
+    uint8_t lz[block];
+    std::array<std::array<std::size_t, 129>, 4> partial{};
+    for (std::size_t base = 0; base < a.size(); base += block) {
+        const std::size_t n = std::min(block, a.size() - base);
+        detail::countl_zero_each(a.data() + base, lz, n);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            ++partial[0][lz[i]];
+            ++partial[1][lz[i + 1]];
+            ++partial[2][lz[i + 2]];
+            ++partial[3][lz[i + 3]];
+        }
+        for (; i < n; ++i) {
+            ++partial[0][lz[i]];
+        }
+    }
+    std::array<std::size_t, 129> hist{};
+    for (std::size_t w = 0; w <= 128; ++w) {
+        hist[w] = partial[0][128 - w] + partial[1][128 - w] + partial[2][128 - w] + partial[3][128 - w];
+    }
+    return hist;
+}
+
+#undef UINT128_SIMD_DISPATCH
+
+} // namespace simd
+} // namespace nstd
+
+#endif // UINT128_SIMD_HPP
@@ -0,0 +1,1182 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_SOA_HPP
+#define UINT128_SOA_HPP
+
+/**
+ * @file uint128_soa.hpp
+ * @brief Contenedor structure-of-arrays para columnas de uint128_t con kernels vectoriales
+ *
+ * `uint128_t` guarda `data[2]` intercalado (lo, hi, lo, hi, ...), así que un
+ * registro SIMD siempre mezcla mitades altas y bajas. `uint128_soa_vector`
+ * guarda dos arrays separados `hi[]` y `lo[]` alineados a 64 bytes, de modo
+ * que cada carril de 64 bits de un registro es la misma mitad de valores
+ * consecutivos y el acarreo entre mitades es una comparación por carril.
+ *
+ * Kernels elemento a elemento en `nstd::soa`:
+ * - add / sub (acarreo/préstamo de la mitad baja a la alta)
+ * - bit_and / bit_or / bit_xor, shift_left / shift_right
+ * - compare -> máscara de bits, min / max
+ * - popcount por elemento y popcount_sum
+ *
+ * Cada kernel tiene versión escalar, AVX2 y AVX-512, elegida en tiempo de
+ * ejecución (intrinsics::active_simd_level()); no hace falta compilar con
+ * `-march=native`.
+ */
+
+#include "../intrinsics/cpu_features.hpp"
+#include "../intrinsics/simd_operations.hpp"
+#include "uint128_t.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace nstd
+{
+
+/**
+ * @brief Vector de uint128_t en formato structure-of-arrays
+ *
+ * Las mitades se exponen con hi_data()/lo_data() para kernels propios. Los
+ * elementos se leen y escriben por valor (get/set/operator[] const), ya que
+ * no existe un uint128_t contiguo al que devolver referencia.
+ *
+ * Example:
+ * @code
+ * std::vector<uint128_t> prices = load();
+ * nstd::uint128_soa_vector a(prices), b(deltas), out;
+ * nstd::soa::add(a, b, out);
+ * std::vector<uint128_t> result = out.to_vector();
+ * @endcode
+ */
+class uint128_soa_vector
+{
+  public:
+    static constexpr std::size_t alignment = 64;                      ///< Bytes (línea de caché / ZMM)
+    static constexpr std::size_t block = alignment / sizeof(uint64_t); ///< Elementos por línea
+
+    using value_type = uint128_t;
+    using size_type = std::size_t;
+
+  private:
+    struct aligned_delete {
+        void operator()(uint64_t* p) const noexcept
+        {
+            ::operator delete[](p, std::align_val_t{alignment});
+        }
+    };
+    using buffer = std::unique_ptr<uint64_t[], aligned_delete>;
+
+    buffer hi_;
+    buffer lo_;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+
+    static buffer allocate(std::size_t n)
+    {
+        if (n == 0) {
+            return buffer();
+        }
+        void* p = ::operator new[](n * sizeof(uint64_t), std::align_val_t{alignment});
+        return buffer(static_cast<uint64_t*>(p));
+    }
+
+    // Capacidad en múltiplos de una línea de caché completa
+    static constexpr std::size_t round_capacity(std::size_t n) noexcept
+    {
+        return (n + block - 1) / block * block;
+    }
+
+    void reallocate(std::size_t new_capacity)
+    {
+        buffer hi = allocate(new_capacity);
+        buffer lo = allocate(new_capacity);
+        if (size_ != 0) {
+            std::memcpy(hi.get(), hi_.get(), size_ * sizeof(uint64_t));
+            std::memcpy(lo.get(), lo_.get(), size_ * sizeof(uint64_t));
+        }
+        hi_ = std::move(hi);
+        lo_ = std::move(lo);
+        capacity_ = new_capacity;
+    }
+
+  public:
+    // ------------------------------------------------------------------ construcción
+
+    uint128_soa_vector() noexcept = default;
+
+    /**
+     * @brief Crea n elementos a cero
+     */
+    explicit uint128_soa_vector(std::size_t n)
+    {
+        resize(n);
+    }
+
+    uint128_soa_vector(std::size_t n, const uint128_t& value)
+    {
+        resize(n);
+        std::fill_n(hi_.get(), n, value.high());
+        std::fill_n(lo_.get(), n, value.low());
+    }
+
+    /**
+     * @brief Convierte desde formato AoS (separando mitades)
+     */
+    explicit uint128_soa_vector(std::span<const uint128_t> values)
+    {
+        assign(values);
+    }
+
+    explicit uint128_soa_vector(const std::vector<uint128_t>& values)
+        : uint128_soa_vector(std::span<const uint128_t>(values))
+    {
+    }
+
+    uint128_soa_vector(const uint128_soa_vector& other)
+    {
+        reallocate(round_capacity(other.size_));
+        size_ = other.size_;
+        if (size_ != 0) {
+            std::memcpy(hi_.get(), other.hi_.get(), size_ * sizeof(uint64_t));
+            std::memcpy(lo_.get(), other.lo_.get(), size_ * sizeof(uint64_t));
+        }
+    }
+
+    uint128_soa_vector(uint128_soa_vector&& other) noexcept
+        : hi_(std::move(other.hi_)), lo_(std::move(other.lo_)),
+          size_(std::exchange(other.size_, 0)), capacity_(std::exchange(other.capacity_, 0))
+    {
+    }
+
+    uint128_soa_vector& operator=(const uint128_soa_vector& other)
+    {
+        if (this != &other) {
+            uint128_soa_vector tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    uint128_soa_vector& operator=(uint128_soa_vector&& other) noexcept
+    {
+        if (this != &other) {
+            hi_ = std::move(other.hi_);
+            lo_ = std::move(other.lo_);
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, 0);
+        }
+        return *this;
+    }
+
+    ~uint128_soa_vector() = default;
+
+    // ------------------------------------------------------------------ capacidad
+
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    void reserve(std::size_t n)
+    {
+        if (n > capacity_) {
+            reallocate(round_capacity(n));
+        }
+    }
+
+    /**
+     * @brief Cambia el tamaño; los elementos nuevos valen 0
+     */
+    void resize(std::size_t n)
+    {
+        if (n > capacity_) {
+            reallocate(round_capacity(std::max(n, capacity_ * 2)));
+        }
+        if (n > size_) {
+            std::fill(hi_.get() + size_, hi_.get() + n, uint64_t{0});
+            std::fill(lo_.get() + size_, lo_.get() + n, uint64_t{0});
+        }
+        size_ = n;
+    }
+
+    void clear() noexcept
+    {
+        size_ = 0;
+    }
+
+    void push_back(const uint128_t& value)
+    {
+        if (size_ == capacity_) {
+            reallocate(round_capacity(capacity_ == 0 ? block : capacity_ * 2));
+        }
+        hi_[size_] = value.high();
+        lo_[size_] = value.low();
+        ++size_;
+    }
+
+    // ------------------------------------------------------------------ acceso
+
+    uint128_t get(std::size_t i) const noexcept
+    {
+        return uint128_t(hi_[i], lo_[i]);
+    }
+
+    void set(std::size_t i, const uint128_t& value) noexcept
+    {
+        hi_[i] = value.high();
+        lo_[i] = value.low();
+    }
+
+    uint128_t operator[](std::size_t i) const noexcept
+    {
+        return get(i);
+    }
+
+    uint128_t at(std::size_t i) const
+    {
+        if (i >= size_) {
+            throw std::out_of_range("uint128_soa_vector::at: index out of range");
+        }
+        return get(i);
+    }
+
+    /// Mitades altas (alineadas a 64 bytes)
+    uint64_t* hi_data() noexcept
+    {
+        return hi_.get();
+    }
+    const uint64_t* hi_data() const noexcept
+    {
+        return hi_.get();
+    }
+    /// Mitades bajas (alineadas a 64 bytes)
+    uint64_t* lo_data() noexcept
+    {
+        return lo_.get();
+    }
+    const uint64_t* lo_data() const noexcept
+    {
+        return lo_.get();
+    }
+
+    // ------------------------------------------------------------------ conversión AoS
+
+    /**
+     * @brief Reemplaza el contenido con valores en formato AoS
+     */
+    void assign(std::span<const uint128_t> values);
+
+    /**
+     * @brief Copia el contenido a formato AoS
+     */
+    void copy_to(std::span<uint128_t> out) const;
+
+    std::vector<uint128_t> to_vector() const
+    {
+        std::vector<uint128_t> out(size_);
+        copy_to(out);
+        return out;
+    }
+
+    friend bool operator==(const uint128_soa_vector& a, const uint128_soa_vector& b) noexcept
+    {
+        if (a.size_ != b.size_) {
+            return false;
+        }
+        return a.size_ == 0 ||
+               (std::memcmp(a.hi_.get(), b.hi_.get(), a.size_ * sizeof(uint64_t)) == 0 &&
+                std::memcmp(a.lo_.get(), b.lo_.get(), a.size_ * sizeof(uint64_t)) == 0);
+    }
+};
+
+namespace soa
+{
+
+/**
+ * @brief Predicado de compare()
+ */
+enum class cmp_op { eq, ne, lt, le, gt, ge };
+
+/**
+ * @brief Máscara de resultados de compare(): bit (i % 64) de la palabra i / 64
+ */
+using mask = std::vector<uint64_t>;
+
+/**
+ * @brief Consulta el bit del elemento i en una máscara de compare()
+ */
+inline bool test(const mask& m, std::size_t i) noexcept
+{
+    return (m[i / 64] >> (i % 64)) & 1;
+}
+
+namespace detail
+{
+
+// Combina las máscaras lt/eq de un bloque según el predicado
+inline constexpr uint64_t combine(cmp_op op, uint64_t lt, uint64_t eq, uint64_t lanes) noexcept
+{
+    switch (op) {
+    case cmp_op::eq:
+        return eq;
+    case cmp_op::ne:
+        return ~eq & lanes;
+    case cmp_op::lt:
+        return lt;
+    case cmp_op::le:
+        return lt | eq;
+    case cmp_op::gt:
+        return ~(lt | eq) & lanes;
+    case cmp_op::ge:
+        return ~lt & lanes;
+    }
+    return 0;
+}
+
+} // namespace detail
+
+// ============================================================================
+// KERNELS ESCALARES (referencia y colas de las rutas vectoriales)
+// ============================================================================
+
+namespace scalar
+{
+
+inline void add(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi, const uint64_t* blo,
+                uint64_t* rhi, uint64_t* rlo, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const uint64_t lo = alo[i] + blo[i];
+        rhi[i] = ahi[i] + bhi[i] + (lo < alo[i] ? 1 : 0);
+        rlo[i] = lo;
+    }
+}
+
+inline void sub(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi, const uint64_t* blo,
+                uint64_t* rhi, uint64_t* rlo, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const uint64_t borrow = alo[i] < blo[i] ? 1 : 0;
+        rlo[i] = alo[i] - blo[i];
+        rhi[i] = ahi[i] - bhi[i] - borrow;
+    }
+}
+
+template <typename Op>
+inline void bitwise(const uint64_t* a, const uint64_t* b, uint64_t* r, std::size_t n, Op op) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = op(a[i], b[i]);
+    }
+}
+
+inline void shift_left(const uint64_t* hi, const uint64_t* lo, unsigned s, uint64_t* rhi,
+                       uint64_t* rlo, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        if (s == 0) {
+            rhi[i] = hi[i];
+            rlo[i] = lo[i];
+        } else if (s < 64) {
+            rhi[i] = (hi[i] << s) | (lo[i] >> (64 - s));
+            rlo[i] = lo[i] << s;
+        } else {
+            rhi[i] = lo[i] << (s - 64);
+            rlo[i] = 0;
+        }
+    }
+}
+
+inline void shift_right(const uint64_t* hi, const uint64_t* lo, unsigned s, uint64_t* rhi,
+                        uint64_t* rlo, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        if (s == 0) {
+            rhi[i] = hi[i];
+            rlo[i] = lo[i];
+        } else if (s < 64) {
+            rlo[i] = (lo[i] >> s) | (hi[i] << (64 - s));
+            rhi[i] = hi[i] >> s;
+        } else {
+            rlo[i] = hi[i] >> (s - 64);
+            rhi[i] = 0;
+        }
+    }
+}
+
+/// Escribe en mask los bits [first, first + n); b_stride 0 = comparar contra un escalar
+inline void compare(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi,
+                    const uint64_t* blo, std::size_t b_stride, std::size_t first, std::size_t n,
+                    cmp_op op, uint64_t* mask) noexcept
+{
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::size_t i = first + k;
+        const uint64_t bh = bhi[i * b_stride];
+        const uint64_t bl = blo[i * b_stride];
+        const uint64_t lt = (ahi[i] < bh || (ahi[i] == bh && alo[i] < bl)) ? 1 : 0;
+        const uint64_t eq = (ahi[i] == bh && alo[i] == bl) ? 1 : 0;
+        mask[i / 64] |= detail::combine(op, lt, eq, 1) << (i % 64);
+    }
+}
+
+/// want_min: true = mínimo, false = máximo
+inline void minmax(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi,
+                   const uint64_t* blo, uint64_t* rhi, uint64_t* rlo, std::size_t n,
+                   bool want_min) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const bool a_lt_b = ahi[i] < bhi[i] || (ahi[i] == bhi[i] && alo[i] < blo[i]);
+        const bool take_a = (a_lt_b == want_min);
+        const uint64_t h = take_a ? ahi[i] : bhi[i];
+        const uint64_t l = take_a ? alo[i] : blo[i];
+        rhi[i] = h;
+        rlo[i] = l;
+    }
+}
+
+inline void popcount(const uint64_t* hi, const uint64_t* lo, uint8_t* out, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<uint8_t>(intrinsics::popcount64(hi[i]) + intrinsics::popcount64(lo[i]));
+    }
+}
+
+inline uint64_t popcount_sum(const uint64_t* hi, const uint64_t* lo, std::size_t n) noexcept
+{
+    uint64_t total = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        total += static_cast<uint64_t>(intrinsics::popcount64(hi[i]) + intrinsics::popcount64(lo[i]));
+    }
+    return total;
+}
+
+inline void deinterleave(const uint128_t* src, uint64_t* hi, uint64_t* lo, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        hi[i] = src[i].high();
+        lo[i] = src[i].low();
+    }
+}
+
+inline void interleave(const uint64_t* hi, const uint64_t* lo, uint128_t* dst, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = uint128_t(hi[i], lo[i]);
+    }
+}
+
+} // namespace scalar
+
+#if INTRINSICS_HAS_SIMD_128_LANES
+
+// ============================================================================
+// KERNELS AVX2 (4 elementos por iteración)
+// ============================================================================
+
+namespace avx2
+{
+
+namespace v = intrinsics::simd::avx2;
+
+#define UINT128_SOA_LOAD(p) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+#define UINT128_SOA_STORE(p, x) _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x)
+
+INTRINSICS_TARGET("avx2")
+inline void add(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi, const uint64_t* blo,
+                uint64_t* rhi, uint64_t* rlo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i h, l;
+        v::add128(UINT128_SOA_LOAD(ahi + i), UINT128_SOA_LOAD(alo + i), UINT128_SOA_LOAD(bhi + i),
+                  UINT128_SOA_LOAD(blo + i), h, l);
+        UINT128_SOA_STORE(rhi + i, h);
+        UINT128_SOA_STORE(rlo + i, l);
+    }
+    scalar::add(ahi + i, alo + i, bhi + i, blo + i, rhi + i, rlo + i, n - i);
+}
+
+INTRINSICS_TARGET("avx2")
+inline void sub(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi, const uint64_t* blo,
+                uint64_t* rhi, uint64_t* rlo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i h, l;
+        v::sub128(UINT128_SOA_LOAD(ahi + i), UINT128_SOA_LOAD(alo + i), UINT128_SOA_LOAD(bhi + i),
+                  UINT128_SOA_LOAD(blo + i), h, l);
+        UINT128_SOA_STORE(rhi + i, h);
+        UINT128_SOA_STORE(rlo + i, l);
+    }
+    scalar::sub(ahi + i, alo + i, bhi + i, blo + i, rhi + i, rlo + i, n - i);
+}
+
+/// op: 0 = and, 1 = or, 2 = xor
+INTRINSICS_TARGET("avx2")
+inline void bitwise(const uint64_t* a, const uint64_t* b, uint64_t* r, std::size_t n, int op) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = UINT128_SOA_LOAD(a + i);
+        const __m256i y = UINT128_SOA_LOAD(b + i);
+        const __m256i z = op == 0   ? _mm256_and_si256(x, y)
+                          : op == 1 ? _mm256_or_si256(x, y)
+                                    : _mm256_xor_si256(x, y);
+        UINT128_SOA_STORE(r + i, z);
+    }
+    for (; i < n; ++i) {
+        r[i] = op == 0 ? (a[i] & b[i]) : op == 1 ? (a[i] | b[i]) : (a[i] ^ b[i]);
+    }
+}
+
+INTRINSICS_TARGET("avx2")
+inline void shift(const uint64_t* hi, const uint64_t* lo, unsigned s, bool left, uint64_t* rhi,
+                  uint64_t* rlo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i h, l;
+        if (left) {
+            v::shl128(UINT128_SOA_LOAD(hi + i), UINT128_SOA_LOAD(lo + i), s, h, l);
+        } else {
+            v::shr128(UINT128_SOA_LOAD(hi + i), UINT128_SOA_LOAD(lo + i), s, h, l);
+        }
+        UINT128_SOA_STORE(rhi + i, h);
+        UINT128_SOA_STORE(rlo + i, l);
+    }
+    if (left) {
+        scalar::shift_left(hi + i, lo + i, s, rhi + i, rlo + i, n - i);
+    } else {
+        scalar::shift_right(hi + i, lo + i, s, rhi + i, rlo + i, n - i);
+    }
+}
+
+INTRINSICS_TARGET("avx2")
+inline void compare(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi,
+                    const uint64_t* blo, std::size_t b_stride, std::size_t n, cmp_op op,
+                    uint64_t* mask) noexcept
+{
+    const __m256i bh_scalar = _mm256_set1_epi64x(static_cast<long long>(bhi[0]));
+    const __m256i bl_scalar = _mm256_set1_epi64x(static_cast<long long>(blo[0]));
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i ah = UINT128_SOA_LOAD(ahi + i);
+        const __m256i al = UINT128_SOA_LOAD(alo + i);
+        const __m256i bh = b_stride ? UINT128_SOA_LOAD(bhi + i) : bh_scalar;
+        const __m256i bl = b_stride ? UINT128_SOA_LOAD(blo + i) : bl_scalar;
+        const auto lt = static_cast<uint64_t>(
+            _mm256_movemask_pd(_mm256_castsi256_pd(v::lt128(ah, al, bh, bl))));
+        const auto eq = static_cast<uint64_t>(
+            _mm256_movemask_pd(_mm256_castsi256_pd(v::eq128(ah, al, bh, bl))));
+        mask[i / 64] |= detail::combine(op, lt, eq, 0xF) << (i % 64);
+    }
+    scalar::compare(ahi, alo, bhi, blo, b_stride, i, n - i, op, mask);
+}
+
+INTRINSICS_TARGET("avx2")
+inline void minmax(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi,
+                   const uint64_t* blo, uint64_t* rhi, uint64_t* rlo, std::size_t n,
+                   bool want_min) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i ah = UINT128_SOA_LOAD(ahi + i);
+        const __m256i al = UINT128_SOA_LOAD(alo + i);
+        const __m256i bh = UINT128_SOA_LOAD(bhi + i);
+        const __m256i bl = UINT128_SOA_LOAD(blo + i);
+        // take_b: donde b es el elegido (b < a para min, a < b para max)
+        const __m256i take_b = want_min ? v::lt128(bh, bl, ah, al) : v::lt128(ah, al, bh, bl);
+        UINT128_SOA_STORE(rhi + i, _mm256_blendv_epi8(ah, bh, take_b));
+        UINT128_SOA_STORE(rlo + i, _mm256_blendv_epi8(al, bl, take_b));
+    }
+    scalar::minmax(ahi + i, alo + i, bhi + i, blo + i, rhi + i, rlo + i, n - i, want_min);
+}
+
+INTRINSICS_TARGET("avx2")
+inline void popcount(const uint64_t* hi, const uint64_t* lo, uint8_t* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    alignas(32) uint64_t counts[4];
+    for (; i + 4 <= n; i += 4) {
+        const __m256i c = _mm256_add_epi64(v::popcount_epi64(UINT128_SOA_LOAD(hi + i)),
+                                           v::popcount_epi64(UINT128_SOA_LOAD(lo + i)));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts), c);
+        for (int k = 0; k < 4; ++k) {
+            out[i + k] = static_cast<uint8_t>(counts[k]);
+        }
+    }
+    scalar::popcount(hi + i, lo + i, out + i, n - i);
+}
+
+INTRINSICS_TARGET("avx2")
+inline uint64_t popcount_sum(const uint64_t* hi, const uint64_t* lo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_add_epi64(acc, v::popcount_epi64(UINT128_SOA_LOAD(hi + i)));
+        acc = _mm256_add_epi64(acc, v::popcount_epi64(UINT128_SOA_LOAD(lo + i)));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::popcount_sum(hi + i, lo + i, n - i);
+}
+
+INTRINSICS_TARGET("avx2")
+inline void deinterleave(const uint128_t* src, uint64_t* hi, uint64_t* lo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i h, l;
+        v::load_deinterleave(src + i, h, l);
+        UINT128_SOA_STORE(hi + i, h);
+        UINT128_SOA_STORE(lo + i, l);
+    }
+    scalar::deinterleave(src + i, hi + i, lo + i, n - i);
+}
+
+INTRINSICS_TARGET("avx2")
+inline void interleave(const uint64_t* hi, const uint64_t* lo, uint128_t* dst, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        v::interleave_store(dst + i, UINT128_SOA_LOAD(hi + i), UINT128_SOA_LOAD(lo + i));
+    }
+    scalar::interleave(hi + i, lo + i, dst + i, n - i);
+}
+
+#undef UINT128_SOA_LOAD
+#undef UINT128_SOA_STORE
+
+} // namespace avx2
+
+// ============================================================================
+// KERNELS AVX-512 (8 elementos por iteración)
+// ============================================================================
+
+// Falsos positivos de GCC 12 en avx512fintrin.h (ver simd_operations.hpp)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace avx512
+{
+
+namespace v = intrinsics::simd::avx512;
+
+INTRINSICS_TARGET("avx512f")
+inline void add(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi, const uint64_t* blo,
+                uint64_t* rhi, uint64_t* rlo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i h, l;
+        v::add128(_mm512_loadu_si512(ahi + i), _mm512_loadu_si512(alo + i),
+                  _mm512_loadu_si512(bhi + i), _mm512_loadu_si512(blo + i), h, l);
+        _mm512_storeu_si512(rhi + i, h);
+        _mm512_storeu_si512(rlo + i, l);
+    }
+    scalar::add(ahi + i, alo + i, bhi + i, blo + i, rhi + i, rlo + i, n - i);
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void sub(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi, const uint64_t* blo,
+                uint64_t* rhi, uint64_t* rlo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i h, l;
+        v::sub128(_mm512_loadu_si512(ahi + i), _mm512_loadu_si512(alo + i),
+                  _mm512_loadu_si512(bhi + i), _mm512_loadu_si512(blo + i), h, l);
+        _mm512_storeu_si512(rhi + i, h);
+        _mm512_storeu_si512(rlo + i, l);
+    }
+    scalar::sub(ahi + i, alo + i, bhi + i, blo + i, rhi + i, rlo + i, n - i);
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void bitwise(const uint64_t* a, const uint64_t* b, uint64_t* r, std::size_t n, int op) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i x = _mm512_loadu_si512(a + i);
+        const __m512i y = _mm512_loadu_si512(b + i);
+        const __m512i z = op == 0   ? _mm512_and_si512(x, y)
+                          : op == 1 ? _mm512_or_si512(x, y)
+                                    : _mm512_xor_si512(x, y);
+        _mm512_storeu_si512(r + i, z);
+    }
+    for (; i < n; ++i) {
+        r[i] = op == 0 ? (a[i] & b[i]) : op == 1 ? (a[i] | b[i]) : (a[i] ^ b[i]);
+    }
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void shift(const uint64_t* hi, const uint64_t* lo, unsigned s, bool left, uint64_t* rhi,
+                  uint64_t* rlo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i h, l;
+        if (left) {
+            v::shl128(_mm512_loadu_si512(hi + i), _mm512_loadu_si512(lo + i), s, h, l);
+        } else {
+            v::shr128(_mm512_loadu_si512(hi + i), _mm512_loadu_si512(lo + i), s, h, l);
+        }
+        _mm512_storeu_si512(rhi + i, h);
+        _mm512_storeu_si512(rlo + i, l);
+    }
+    if (left) {
+        scalar::shift_left(hi + i, lo + i, s, rhi + i, rlo + i, n - i);
+    } else {
+        scalar::shift_right(hi + i, lo + i, s, rhi + i, rlo + i, n - i);
+    }
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void compare(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi,
+                    const uint64_t* blo, std::size_t b_stride, std::size_t n, cmp_op op,
+                    uint64_t* mask) noexcept
+{
+    const __m512i bh_scalar = _mm512_set1_epi64(static_cast<long long>(bhi[0]));
+    const __m512i bl_scalar = _mm512_set1_epi64(static_cast<long long>(blo[0]));
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i ah = _mm512_loadu_si512(ahi + i);
+        const __m512i al = _mm512_loadu_si512(alo + i);
+        const __m512i bh = b_stride ? _mm512_loadu_si512(bhi + i) : bh_scalar;
+        const __m512i bl = b_stride ? _mm512_loadu_si512(blo + i) : bl_scalar;
+        const auto lt = static_cast<uint64_t>(v::lt128(ah, al, bh, bl));
+        const auto eq = static_cast<uint64_t>(v::eq128(ah, al, bh, bl));
+        mask[i / 64] |= detail::combine(op, lt, eq, 0xFF) << (i % 64);
+    }
+    scalar::compare(ahi, alo, bhi, blo, b_stride, i, n - i, op, mask);
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void minmax(const uint64_t* ahi, const uint64_t* alo, const uint64_t* bhi,
+                   const uint64_t* blo, uint64_t* rhi, uint64_t* rlo, std::size_t n,
+                   bool want_min) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i ah = _mm512_loadu_si512(ahi + i);
+        const __m512i al = _mm512_loadu_si512(alo + i);
+        const __m512i bh = _mm512_loadu_si512(bhi + i);
+        const __m512i bl = _mm512_loadu_si512(blo + i);
+        const __mmask8 take_b = want_min ? v::lt128(bh, bl, ah, al) : v::lt128(ah, al, bh, bl);
+        _mm512_storeu_si512(rhi + i, _mm512_mask_blend_epi64(take_b, ah, bh));
+        _mm512_storeu_si512(rlo + i, _mm512_mask_blend_epi64(take_b, al, bl));
+    }
+    scalar::minmax(ahi + i, alo + i, bhi + i, blo + i, rhi + i, rlo + i, n - i, want_min);
+}
+
+// Requiere AVX512_VPOPCNTDQ; sin ella se usa la ruta AVX2
+INTRINSICS_TARGET("avx512f,avx512vpopcntdq")
+inline void popcount(const uint64_t* hi, const uint64_t* lo, uint8_t* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i c = _mm512_add_epi64(v::popcount_epi64(_mm512_loadu_si512(hi + i)),
+                                           v::popcount_epi64(_mm512_loadu_si512(lo + i)));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm512_cvtepi64_epi8(c));
+    }
+    scalar::popcount(hi + i, lo + i, out + i, n - i);
+}
+
+INTRINSICS_TARGET("avx512f,avx512vpopcntdq")
+inline uint64_t popcount_sum(const uint64_t* hi, const uint64_t* lo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    __m512i acc = _mm512_setzero_si512();
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm512_add_epi64(acc, v::popcount_epi64(_mm512_loadu_si512(hi + i)));
+        acc = _mm512_add_epi64(acc, v::popcount_epi64(_mm512_loadu_si512(lo + i)));
+    }
+    return static_cast<uint64_t>(_mm512_reduce_add_epi64(acc)) +
+           scalar::popcount_sum(hi + i, lo + i, n - i);
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void deinterleave(const uint128_t* src, uint64_t* hi, uint64_t* lo, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i h, l;
+        v::load_deinterleave(src + i, h, l);
+        _mm512_storeu_si512(hi + i, h);
+        _mm512_storeu_si512(lo + i, l);
+    }
+    scalar::deinterleave(src + i, hi + i, lo + i, n - i);
+}
+
+INTRINSICS_TARGET("avx512f")
+inline void interleave(const uint64_t* hi, const uint64_t* lo, uint128_t* dst, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        v::interleave_store(dst + i, _mm512_loadu_si512(hi + i), _mm512_loadu_si512(lo + i));
+    }
+    scalar::interleave(hi + i, lo + i, dst + i, n - i);
+}
+
+} // namespace avx512
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // INTRINSICS_HAS_SIMD_128_LANES
+
+// ============================================================================
+// API PÚBLICA
+// ============================================================================
+
+namespace detail
+{
+
+inline void require_same_size(const uint128_soa_vector& a, const uint128_soa_vector& b)
+{
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("nstd::soa: operand sizes differ");
+    }
+}
+
+// Carga/almacenamiento de AoS sobre uint64_t exige la disposición lo, hi
+static_assert(sizeof(uint128_t) == 2 * sizeof(uint64_t), "uint128_t debe ocupar 16 bytes");
+
+} // namespace detail
+
+#if INTRINSICS_HAS_SIMD_128_LANES
+#define UINT128_SOA_DISPATCH(call)                                                                 \
+    switch (intrinsics::active_simd_level()) {                                                     \
+    case intrinsics::simd_level::avx512:                                                           \
+        avx512::call;                                                                              \
+        break;                                                                                     \
+    case intrinsics::simd_level::avx2:                                                             \
+        avx2::call;                                                                                \
+        break;                                                                                     \
+    default:                                                                                       \
+        scalar::call;                                                                              \
+        break;                                                                                     \
+    }
+#else
+#define UINT128_SOA_DISPATCH(call) scalar::call;
+#endif
+
+/**
+ * @brief out[i] = a[i] + b[i] (módulo 2^128)
+ * @throws std::invalid_argument si los tamaños difieren
+ * @note out puede ser el mismo objeto que a o b
+ */
+inline void add(const uint128_soa_vector& a, const uint128_soa_vector& b, uint128_soa_vector& out)
+{
+    detail::require_same_size(a, b);
+    out.resize(a.size());
+    UINT128_SOA_DISPATCH(add(a.hi_data(), a.lo_data(), b.hi_data(), b.lo_data(), out.hi_data(),
+                             out.lo_data(), a.size()))
+}
+
+/**
+ * @brief out[i] = a[i] - b[i] (módulo 2^128)
+ * @throws std::invalid_argument si los tamaños difieren
+ */
+inline void sub(const uint128_soa_vector& a, const uint128_soa_vector& b, uint128_soa_vector& out)
+{
+    detail::require_same_size(a, b);
+    out.resize(a.size());
+    UINT128_SOA_DISPATCH(sub(a.hi_data(), a.lo_data(), b.hi_data(), b.lo_data(), out.hi_data(),
+                             out.lo_data(), a.size()))
+}
+
+namespace detail
+{
+
+inline void bitwise(const uint128_soa_vector& a, const uint128_soa_vector& b,
+                    uint128_soa_vector& out, int op)
+{
+    require_same_size(a, b);
+    out.resize(a.size());
+#if INTRINSICS_HAS_SIMD_128_LANES
+    switch (intrinsics::active_simd_level()) {
+    case intrinsics::simd_level::avx512:
+        avx512::bitwise(a.hi_data(), b.hi_data(), out.hi_data(), a.size(), op);
+        avx512::bitwise(a.lo_data(), b.lo_data(), out.lo_data(), a.size(), op);
+        return;
+    case intrinsics::simd_level::avx2:
+        avx2::bitwise(a.hi_data(), b.hi_data(), out.hi_data(), a.size(), op);
+        avx2::bitwise(a.lo_data(), b.lo_data(), out.lo_data(), a.size(), op);
+        return;
+    default:
+        break;
+    }
+#endif
+    auto f = [op](uint64_t x, uint64_t y) { return op == 0 ? (x & y) : op == 1 ? (x | y) : (x ^ y); };
+    scalar::bitwise(a.hi_data(), b.hi_data(), out.hi_data(), a.size(), f);
+    scalar::bitwise(a.lo_data(), b.lo_data(), out.lo_data(), a.size(), f);
+}
+
+inline void shift(const uint128_soa_vector& a, unsigned s, bool left, uint128_soa_vector& out)
+{
+    out.resize(a.size());
+    if (s >= 128) {
+        std::fill_n(out.hi_data(), out.size(), uint64_t{0});
+        std::fill_n(out.lo_data(), out.size(), uint64_t{0});
+        return;
+    }
+#if INTRINSICS_HAS_SIMD_128_LANES
+    switch (intrinsics::active_simd_level()) {
+    case intrinsics::simd_level::avx512:
+        avx512::shift(a.hi_data(), a.lo_data(), s, left, out.hi_data(), out.lo_data(), a.size());
+        return;
+    case intrinsics::simd_level::avx2:
+        avx2::shift(a.hi_data(), a.lo_data(), s, left, out.hi_data(), out.lo_data(), a.size());
+        return;
+    default:
+        break;
+    }
+#endif
+    if (left) {
+        scalar::shift_left(a.hi_data(), a.lo_data(), s, out.hi_data(), out.lo_data(), a.size());
+    } else {
+        scalar::shift_right(a.hi_data(), a.lo_data(), s, out.hi_data(), out.lo_data(), a.size());
+    }
+}
+
+inline mask compare(const uint128_soa_vector& a, const uint64_t* bhi, const uint64_t* blo,
+                    std::size_t b_stride, cmp_op op)
+{
+    mask m((a.size() + 63) / 64, 0);
+    if (a.empty()) {
+        return m;
+    }
+#if INTRINSICS_HAS_SIMD_128_LANES
+    switch (intrinsics::active_simd_level()) {
+    case intrinsics::simd_level::avx512:
+        avx512::compare(a.hi_data(), a.lo_data(), bhi, blo, b_stride, a.size(), op, m.data());
+        return m;
+    case intrinsics::simd_level::avx2:
+        avx2::compare(a.hi_data(), a.lo_data(), bhi, blo, b_stride, a.size(), op, m.data());
+        return m;
+    default:
+        break;
+    }
+#endif
+    scalar::compare(a.hi_data(), a.lo_data(), bhi, blo, b_stride, 0, a.size(), op, m.data());
+    return m;
+}
+
+inline void minmax(const uint128_soa_vector& a, const uint128_soa_vector& b,
+                   uint128_soa_vector& out, bool want_min)
+{
+    require_same_size(a, b);
+    out.resize(a.size());
+    UINT128_SOA_DISPATCH(minmax(a.hi_data(), a.lo_data(), b.hi_data(), b.lo_data(), out.hi_data(),
+                                out.lo_data(), a.size(), want_min))
+}
+
+} // namespace detail
+
+/// out[i] = a[i] & b[i]
+inline void bit_and(const uint128_soa_vector& a, const uint128_soa_vector& b, uint128_soa_vector& out)
+{
+    detail::bitwise(a, b, out, 0);
+}
+
+/// out[i] = a[i] | b[i]
+inline void bit_or(const uint128_soa_vector& a, const uint128_soa_vector& b, uint128_soa_vector& out)
+{
+    detail::bitwise(a, b, out, 1);
+}
+
+/// out[i] = a[i] ^ b[i]
+inline void bit_xor(const uint128_soa_vector& a, const uint128_soa_vector& b, uint128_soa_vector& out)
+{
+    detail::bitwise(a, b, out, 2);
+}
+
+/**
+ * @brief out[i] = a[i] << s (s >= 128 produce 0, como uint128_t::shift_left)
+ */
+inline void shift_left(const uint128_soa_vector& a, unsigned s, uint128_soa_vector& out)
+{
+    detail::shift(a, s, true, out);
+}
+
+/**
+ * @brief out[i] = a[i] >> s (lógico; s >= 128 produce 0)
+ */
+inline void shift_right(const uint128_soa_vector& a, unsigned s, uint128_soa_vector& out)
+{
+    detail::shift(a, s, false, out);
+}
+
+/**
+ * @brief Compara elemento a elemento: bit i de la máscara = (a[i] op b[i])
+ * @throws std::invalid_argument si los tamaños difieren
+ */
+inline mask compare(const uint128_soa_vector& a, const uint128_soa_vector& b, cmp_op op)
+{
+    detail::require_same_size(a, b);
+    return detail::compare(a, b.hi_data(), b.lo_data(), 1, op);
+}
+
+/**
+ * @brief Compara cada elemento contra un escalar: bit i = (a[i] op value)
+ */
+inline mask compare(const uint128_soa_vector& a, const uint128_t& value, cmp_op op)
+{
+    const uint64_t hi = value.high();
+    const uint64_t lo = value.low();
+    return detail::compare(a, &hi, &lo, 0, op);
+}
+
+/// out[i] = min(a[i], b[i])
+inline void min(const uint128_soa_vector& a, const uint128_soa_vector& b, uint128_soa_vector& out)
+{
+    detail::minmax(a, b, out, true);
+}
+
+/// out[i] = max(a[i], b[i])
+inline void max(const uint128_soa_vector& a, const uint128_soa_vector& b, uint128_soa_vector& out)
+{
+    detail::minmax(a, b, out, false);
+}
+
+/**
+ * @brief out[i] = popcount(a[i]) (0..128)
+ */
+inline void popcount(const uint128_soa_vector& a, std::vector<uint8_t>& out)
+{
+    out.resize(a.size());
+#if INTRINSICS_HAS_SIMD_128_LANES
+    const auto level = intrinsics::active_simd_level();
+    if (level == intrinsics::simd_level::avx512 && intrinsics::cpu().avx512_vpopcntdq) {
+        avx512::popcount(a.hi_data(), a.lo_data(), out.data(), a.size());
+        return;
+    }
+    if (level != intrinsics::simd_level::scalar) {
+        avx2::popcount(a.hi_data(), a.lo_data(), out.data(), a.size());
+        return;
+    }
+#endif
+    scalar::popcount(a.hi_data(), a.lo_data(), out.data(), a.size());
+}
+
+/**
+ * @brief Suma de popcount de todos los elementos
+ */
+inline uint64_t popcount_sum(const uint128_soa_vector& a) noexcept
+{
+#if INTRINSICS_HAS_SIMD_128_LANES
+    const auto level = intrinsics::active_simd_level();
+    if (level == intrinsics::simd_level::avx512 && intrinsics::cpu().avx512_vpopcntdq) {
+        return avx512::popcount_sum(a.hi_data(), a.lo_data(), a.size());
+    }
+    if (level != intrinsics::simd_level::scalar) {
+        return avx2::popcount_sum(a.hi_data(), a.lo_data(), a.size());
+    }
+#endif
+    return scalar::popcount_sum(a.hi_data(), a.lo_data(), a.size());
+}
+
+} // namespace soa
+
+// ============================================================================
+// CONVERSIÓN AoS <-> SoA
+// ============================================================================
+
+inline void uint128_soa_vector::assign(std::span<const uint128_t> values)
+{
+    clear();
+    resize(values.size());
+    if (values.empty()) {
+        return;
+    }
+    const uint128_t* src = values.data();
+#if INTRINSICS_HAS_SIMD_128_LANES
+    switch (intrinsics::active_simd_level()) {
+    case intrinsics::simd_level::avx512:
+        soa::avx512::deinterleave(src, hi_data(), lo_data(), size_);
+        return;
+    case intrinsics::simd_level::avx2:
+        soa::avx2::deinterleave(src, hi_data(), lo_data(), size_);
+        return;
+    default:
+        break;
+    }
+#endif
+    soa::scalar::deinterleave(src, hi_data(), lo_data(), size_);
+}
+
+inline void uint128_soa_vector::copy_to(std::span<uint128_t> out) const
+{
+    if (out.size() < size_) {
+        throw std::invalid_argument("uint128_soa_vector::copy_to: output span too small");
+    }
+    if (size_ == 0) {
+        return;
+    }
+#if INTRINSICS_HAS_SIMD_128_LANES
+    switch (intrinsics::active_simd_level()) {
+    case intrinsics::simd_level::avx512:
+        soa::avx512::interleave(hi_data(), lo_data(), out.data(), size_);
+        return;
+    case intrinsics::simd_level::avx2:
+        soa::avx2::interleave(hi_data(), lo_data(), out.data(), size_);
+        return;
+    default:
+        break;
+    }
+#endif
+    soa::scalar::interleave(hi_data(), lo_data(), out.data(), size_);
+}
+
+#undef UINT128_SOA_DISPATCH
+
+} // namespace nstd
+
+#endif // UINT128_SOA_HPP
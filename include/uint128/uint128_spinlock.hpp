@@ -0,0 +1,157 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_SPINLOCK_HPP
+#define UINT128_SPINLOCK_HPP
+
+/**
+ * @file uint128_spinlock.hpp
+ * @brief Spin-locks para los envoltorios ThreadSafe*SpinLock
+ *
+ * - `ttas_spinlock`: test-and-test-and-set. Mientras el cerrojo está tomado
+ *   sólo se lee (la línea de caché se comparte en lugar de rebotar) y los
+ *   reintentos se espacian con espera exponencial; saturada la espera, se
+ *   cede el hilo.
+ * - `ticket_spinlock`: cola FIFO con dos contadores; cada hilo espera en
+ *   proporción a su distancia al turno actual. Justo, pero sensible a que
+ *   el sistema expulse al hilo que tiene el turno: tras un número acotado de
+ *   pausas cede el hilo en cada comprobación. Con más hilos que núcleos cada
+ *   cesión del turno cuesta un cambio de contexto (µs): úsese con a lo sumo
+ *   un hilo por núcleo.
+ *
+ * Ambos cumplen Lockable (lock/try_lock/unlock) y sirven con std::lock_guard.
+ * La política de espera es un parámetro de plantilla (backoff_policy).
+ */
+
+#include "uint128_atomic.hpp"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace nstd
+{
+
+/// Espera por defecto de los spin-locks: de 1 a 256 pausas y luego yield
+inline constexpr backoff_policy spinlock_backoff{1, 256, true};
+
+/**
+ * @brief Spin-lock test-and-test-and-set con espera exponencial
+ */
+template <backoff_policy Policy = spinlock_backoff> class basic_ttas_spinlock
+{
+  public:
+    constexpr basic_ttas_spinlock() noexcept = default;
+    basic_ttas_spinlock(const basic_ttas_spinlock&) = delete;
+    basic_ttas_spinlock& operator=(const basic_ttas_spinlock&) = delete;
+
+    void lock() noexcept
+    {
+        while (locked_.exchange(true, std::memory_order_acquire)) {
+            exponential_backoff backoff(Policy);
+            while (locked_.load(std::memory_order_relaxed)) {
+                backoff();
+            }
+        }
+    }
+
+    bool try_lock() noexcept
+    {
+        return !locked_.load(std::memory_order_relaxed) &&
+               !locked_.exchange(true, std::memory_order_acquire);
+    }
+
+    void unlock() noexcept
+    {
+        locked_.store(false, std::memory_order_release);
+    }
+
+  private:
+    std::atomic<bool> locked_{false};
+};
+
+/**
+ * @brief Spin-lock de tickets (FIFO)
+ *
+ * Cada espera es de Policy.initial_spins pausas por hilo por delante en la
+ * cola, con un máximo de Policy.max_spins; pasadas Policy.max_spins pausas en
+ * total, si Policy.yield_when_saturated, cada comprobación cede el hilo.
+ */
+template <backoff_policy Policy = spinlock_backoff> class basic_ticket_spinlock
+{
+  public:
+    constexpr basic_ticket_spinlock() noexcept = default;
+    basic_ticket_spinlock(const basic_ticket_spinlock&) = delete;
+    basic_ticket_spinlock& operator=(const basic_ticket_spinlock&) = delete;
+
+    void lock() noexcept
+    {
+        const uint32_t ticket = next_.fetch_add(1, std::memory_order_relaxed);
+        uint32_t spun = 0;
+        for (;;) {
+            const uint32_t serving = serving_.load(std::memory_order_acquire);
+            if (serving == ticket) {
+                return;
+            }
+            if (Policy.yield_when_saturated && spun >= Policy.max_spins) {
+                std::this_thread::yield();
+                continue;
+            }
+            const uint32_t ahead = ticket - serving;
+            uint32_t spins = ahead * Policy.initial_spins;
+            spins = spins < Policy.max_spins ? spins : Policy.max_spins;
+            for (uint32_t i = 0; i < spins; ++i) {
+                intrinsics::cpu_relax();
+            }
+            spun += spins ? spins : 1;
+        }
+    }
+
+    bool try_lock() noexcept
+    {
+        // next_ sólo se escribe con fetch_add relajados: la sincronización con
+        // el unlock() anterior la da la carga acquire de serving_
+        uint32_t serving = serving_.load(std::memory_order_acquire);
+        return next_.compare_exchange_strong(serving, serving + 1, std::memory_order_relaxed,
+                                             std::memory_order_relaxed);
+    }
+
+    void unlock() noexcept
+    {
+        // Sólo el poseedor escribe serving_
+        serving_.store(serving_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+  private:
+    std::atomic<uint32_t> next_{0};
+    std::atomic<uint32_t> serving_{0};
+};
+
+using ttas_spinlock = basic_ttas_spinlock<>;
+using ticket_spinlock = basic_ticket_spinlock<>;
+
+} // namespace nstd
+
+#endif // UINT128_SPINLOCK_HPP
@@ -739,18 +739,15 @@ class uint128_t
      */
     constexpr uint128_t shift_left(int positions) const noexcept
     {
-        if (positions <= 0)
-            return *this;
-        if (positions >= 128)
-            return uint128_t(0, 0);
-
-        if (positions >= 64) {
-            return uint128_t(data[0] << (positions - 64), 0);
-        } else {
-            const uint64_t new_high = (data[1] << positions) | (data[0] >> (64 - positions));
-            const uint64_t new_low = data[0] << positions;
-            return uint128_t(new_high, new_low);
-        }
+        // Sin saltos dependientes de `positions`: SHLD/SHL y máscaras. Con
+        // ternarios GCC vuelve a generar saltos, por eso se selecciona con AND
+        const unsigned n =
+            static_cast<unsigned>(positions) & ~static_cast<unsigned>(positions >> 31); // max(p, 0)
+        const uint64_t keep = uint64_t(0) - static_cast<uint64_t>((n >> 7) == 0);
+        const uint64_t wide = uint64_t(0) - static_cast<uint64_t>((n >> 6) & 1);
+        const uint64_t low = data[0] << (n & 63);
+        const uint64_t high = intrinsics::funnel_shl64(data[1], data[0], n);
+        return uint128_t(((low & wide) | (high & ~wide)) & keep, low & ~wide & keep);
     }
 
     /**
@@ -764,19 +761,14 @@ class uint128_t
      */
     constexpr uint128_t shift_right(int positions) const noexcept
     {
-        if (positions <= 0) {
-            return *this;
-        }
-        if (positions >= 128) {
-            return uint128_t(0, 0);
-        }
-        if (positions >= 64) {
-            return uint128_t(0, data[1] >> (positions - 64));
-        } else {
-            const uint64_t new_low = (data[0] >> positions) | (data[1] << (64 - positions));
-            const uint64_t new_high = data[1] >> positions;
-            return uint128_t(new_high, new_low);
-        }
+        // Sin saltos dependientes de `positions`: SHRD/SHR y máscaras
+        const unsigned n =
+            static_cast<unsigned>(positions) & ~static_cast<unsigned>(positions >> 31); // max(p, 0)
+        const uint64_t keep = uint64_t(0) - static_cast<uint64_t>((n >> 7) == 0);
+        const uint64_t wide = uint64_t(0) - static_cast<uint64_t>((n >> 6) & 1);
+        const uint64_t high = data[1] >> (n & 63);
+        const uint64_t low = intrinsics::funnel_shr64(data[1], data[0], n);
+        return uint128_t(high & ~wide & keep, ((high & wide) | (low & ~wide)) & keep);
     }
 
     // COMPARISON OPERATORS
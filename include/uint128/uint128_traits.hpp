@@ -27,7 +27,10 @@
 #ifndef UINT128_TRAITS_HPP
 #define UINT128_TRAITS_HPP
 
+#include "../intrinsics/arithmetic_operations.hpp"
 #include "uint128_t.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <type_traits>
 
@@ -123,14 +126,62 @@ template <> struct common_type<uint128_t, uint128_t> {
 // HASH - ESPECIALIZACIÓN
 // ===============================================================================
 
+namespace hash_detail
+{
+
+// Constantes de mezcla (wyhash/rapidhash): impares y con buena dispersión de bits
+inline constexpr uint64_t secret0 = 0x2d358dccaa6c78a5ULL;
+inline constexpr uint64_t secret1 = 0x8bb84b93962eacc9ULL;
+inline constexpr uint64_t secret2 = 0x4b33a62ed433d4a3ULL;
+
+/**
+ * @brief Multiplica 64x64 -> 128 bits y pliega el producto con XOR
+ *
+ * Núcleo de wyhash/rapidhash: cada bit de entrada afecta a la mitad alta
+ * del producto, así que el plegado difunde bits bajos hacia arriba y viceversa.
+ */
+inline constexpr uint64_t mix(uint64_t a, uint64_t b) noexcept
+{
+    uint64_t high = 0;
+    const uint64_t low = intrinsics::umul128(a, b, &high);
+    return low ^ high;
+}
+
+} // namespace hash_detail
+
+/**
+ * @brief Hash de 128 -> 64 bits por multiplicación-plegado (estilo wyhash/rapidhash)
+ *
+ * Sustituye al antiguo `hash(high) ^ (hash(low) << 1)`, que con el hash
+ * identidad de libstdc++ colisionaba masivamente en claves estructuradas
+ * (prefijos IPv6 /64, IDs secuenciales en cualquiera de las dos mitades).
+ * Dos multiplicaciones 64x64 -> 128 bits en total; es constexpr.
+ *
+ * @param high 64 bits superiores de la clave
+ * @param low 64 bits inferiores de la clave
+ * @param seed Semilla opcional (p. ej. para tablas resistentes a colisiones)
+ * @return Hash de 64 bits con avalancha completa sobre ambas mitades
+ */
+inline constexpr uint64_t hash128(uint64_t high, uint64_t low, uint64_t seed = 0) noexcept
+{
+    const uint64_t s = seed ^ hash_detail::mix(seed ^ hash_detail::secret0, hash_detail::secret1);
+    uint64_t a = low ^ hash_detail::secret1;
+    uint64_t b = high ^ s;
+    a = intrinsics::umul128(a, b, &b);
+    // El producto se anula con low == secret1 o high == s, sea cual sea la
+    // otra mitad: las palabras originales se vuelven a mezclar (rapidhash)
+    a ^= low;
+    b ^= high;
+    return hash_detail::mix(a ^ hash_detail::secret0 ^ 16u, b ^ hash_detail::secret2);
+}
+
 /**
  * @brief Especialización de nstd::hash para uint128_t
  */
 template <> struct hash<uint128_t> {
-    size_t operator()(const uint128_t& value) const noexcept
+    constexpr size_t operator()(const uint128_t& value) const noexcept
     {
-        std::hash<uint64_t> hasher;
-        return hasher(value.high()) ^ (hasher(value.low()) << 1);
+        return static_cast<size_t>(hash128(value.high(), value.low()));
     }
 };
 
@@ -152,4 +203,22 @@ template <typename T> using make_signed_t = typename make_signed<T>::type;
 template <typename T> using make_unsigned_t = typename make_unsigned<T>::type;
 
 } // namespace nstd
+
+// ===============================================================================
+// STD::HASH - ESPECIALIZACIÓN
+// ===============================================================================
+// std::hash sí admite especializaciones para tipos de usuario en todas las STL
+// (incluidas libc++ y MSVC STL), así que no depende de UINT128_USING_LIBCPP.
+// Permite usar std::unordered_map<uint128_t, V> sin pasar el hasher explícitamente.
+
+namespace std
+{
+template <> struct hash<nstd::uint128_t> {
+    constexpr size_t operator()(const nstd::uint128_t& value) const noexcept
+    {
+        return nstd::hash<nstd::uint128_t>{}(value);
+    }
+};
+} // namespace std
+
 #endif // UINT128_TRAITS_HPP
\ No newline at end of file
@@ -0,0 +1,327 @@
+/*
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef UINT128_WIDE_HPP
+#define UINT128_WIDE_HPP
+
+/**
+ * @file uint128_wide.hpp
+ * @brief Aritmética de ancho fijo sobre limbs de 64 bits (detail::wide)
+ *
+ * Base de los acumuladores anchos de uint128_accumulator.hpp y de las medias
+ * correctamente redondeadas (`ratio_to_double`) de uint128_stats e
+ * int128_stats. Sin dependencias de hilos: los algoritmos secuenciales
+ * pueden incluirla sin arrastrar el pool fork-join.
+ */
+
+#include "../intrinsics/arithmetic_operations.hpp"
+#include "uint128_t.hpp"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace nstd
+{
+
+// ============================================================================
+// ARITMÉTICA DE ANCHO FIJO (limbs de 64 bits, little-endian)
+// ============================================================================
+
+namespace detail
+{
+namespace wide
+{
+
+template <std::size_t N> using limbs = std::array<uint64_t, N>;
+
+/// a += v·2^(64·pos); devuelve el acarreo que sale por arriba
+template <std::size_t N> constexpr uint64_t add_at(limbs<N>& a, std::size_t pos, uint64_t v) noexcept
+{
+    for (std::size_t i = pos; i < N && v != 0; ++i) {
+        a[i] += v;
+        v = a[i] < v ? 1 : 0;
+    }
+    return v;
+}
+
+/// a -= v·2^(64·pos); devuelve el préstamo que sale por arriba
+template <std::size_t N> constexpr uint64_t sub_at(limbs<N>& a, std::size_t pos, uint64_t v) noexcept
+{
+    for (std::size_t i = pos; i < N && v != 0; ++i) {
+        const uint64_t before = a[i];
+        a[i] -= v;
+        v = before < v ? 1 : 0;
+    }
+    return v;
+}
+
+template <std::size_t N> constexpr void add(limbs<N>& a, const limbs<N>& b) noexcept
+{
+    uint64_t c = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        const uint64_t t = b[i] + c;
+        c = t < c ? 1 : 0;
+        a[i] += t;
+        c += a[i] < t ? 1 : 0;
+    }
+}
+
+template <std::size_t N> constexpr void sub(limbs<N>& a, const limbs<N>& b) noexcept
+{
+    uint64_t borrow = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        const uint64_t t = b[i] + borrow;
+        borrow = (t < borrow || a[i] < t) ? 1 : 0;
+        a[i] -= t;
+    }
+}
+
+template <std::size_t N> constexpr void negate(limbs<N>& a) noexcept
+{
+    for (auto& x : a) {
+        x = ~x;
+    }
+    add_at(a, 0, 1);
+}
+
+template <std::size_t N> constexpr bool is_zero(const limbs<N>& a) noexcept
+{
+    for (auto x : a) {
+        if (x != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N> constexpr int compare(const limbs<N>& a, const limbs<N>& b) noexcept
+{
+    for (std::size_t i = N; i-- > 0;) {
+        if (a[i] != b[i]) {
+            return a[i] < b[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+template <std::size_t N> constexpr unsigned bit_width(const limbs<N>& a) noexcept
+{
+    for (std::size_t i = N; i-- > 0;) {
+        if (a[i] != 0) {
+            return static_cast<unsigned>(64 * i) + static_cast<unsigned>(std::bit_width(a[i]));
+        }
+    }
+    return 0;
+}
+
+template <std::size_t N> constexpr bool test_bit(const limbs<N>& a, unsigned k) noexcept
+{
+    return k < 64 * N && ((a[k / 64] >> (k % 64)) & 1) != 0;
+}
+
+/// ¿Hay algún bit a 1 por debajo de la posición k?
+template <std::size_t N> constexpr bool any_below(const limbs<N>& a, unsigned k) noexcept
+{
+    for (std::size_t i = 0; i < N && 64 * i < k; ++i) {
+        const unsigned in_limb = k - static_cast<unsigned>(64 * i);
+        const uint64_t m = in_limb >= 64 ? ~uint64_t{0} : ((uint64_t{1} << in_limb) - 1);
+        if ((a[i] & m) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <std::size_t N> constexpr limbs<N> shl(const limbs<N>& a, unsigned s) noexcept
+{
+    limbs<N> r{};
+    const std::size_t w = s / 64;
+    const unsigned b = s % 64;
+    for (std::size_t i = N; i-- > w;) {
+        r[i] = a[i - w] << b;
+        if (b != 0 && i - w > 0) {
+            r[i] |= a[i - w - 1] >> (64 - b);
+        }
+    }
+    return r;
+}
+
+template <std::size_t N> constexpr limbs<N> shr(const limbs<N>& a, unsigned s) noexcept
+{
+    limbs<N> r{};
+    const std::size_t w = s / 64;
+    const unsigned b = s % 64;
+    for (std::size_t i = 0; i + w < N; ++i) {
+        r[i] = a[i + w] >> b;
+        if (b != 0 && i + w + 1 < N) {
+            r[i] |= a[i + w + 1] << (64 - b);
+        }
+    }
+    return r;
+}
+
+/// Extiende con ceros o trunca a N limbs
+template <std::size_t N, std::size_t M> constexpr limbs<N> resize(const limbs<M>& a) noexcept
+{
+    limbs<N> r{};
+    for (std::size_t i = 0; i < N && i < M; ++i) {
+        r[i] = a[i];
+    }
+    return r;
+}
+
+/// Producto completo N x M limbs -> N + M limbs
+template <std::size_t N, std::size_t M>
+constexpr limbs<N + M> mul(const limbs<N>& a, const limbs<M>& b) noexcept
+{
+    limbs<N + M> r{};
+    for (std::size_t i = 0; i < N; ++i) {
+        uint64_t carry = 0;
+        for (std::size_t j = 0; j < M; ++j) {
+            uint64_t hi = 0;
+            const uint64_t lo = intrinsics::umul128(a[i], b[j], &hi);
+            uint64_t t = r[i + j] + lo;
+            uint64_t c = t < lo ? 1 : 0;
+            t += carry;
+            c += t < carry ? 1 : 0;
+            r[i + j] = t;
+            carry = hi + c; // hi <= 2^64 - 2: no desborda
+        }
+        r[i + M] = carry;
+    }
+    return r;
+}
+
+/// Producto completo 128 x 128 -> 256 bits (cuatro multiplicaciones 64 x 64)
+constexpr void mul_2x2(const limbs<2>& a, const limbs<2>& b, uint64_t p[4]) noexcept
+{
+    uint64_t h00 = 0, h01 = 0, h10 = 0, h11 = 0;
+    const uint64_t l00 = intrinsics::umul128(a[0], b[0], &h00);
+    const uint64_t l01 = intrinsics::umul128(a[0], b[1], &h01);
+    const uint64_t l10 = intrinsics::umul128(a[1], b[0], &h10);
+    const uint64_t l11 = intrinsics::umul128(a[1], b[1], &h11);
+
+    p[0] = l00;
+    uint64_t mid = h00 + l01;
+    uint64_t c = mid < l01 ? 1 : 0;
+    mid += l10;
+    c += mid < l10 ? 1 : 0;
+    p[1] = mid;
+
+    uint64_t high = h01 + h10;
+    uint64_t c2 = high < h10 ? 1 : 0;
+    high += l11;
+    c2 += high < l11 ? 1 : 0;
+    high += c;
+    c2 += high < c ? 1 : 0;
+    p[2] = high;
+    p[3] = h11 + c2; // El producto cabe en 256 bits: no desborda
+}
+
+/// a /= d en el sitio; devuelve el resto
+template <std::size_t N> constexpr uint64_t div_u64(limbs<N>& a, uint64_t d) noexcept
+{
+    uint64_t r = 0;
+    for (std::size_t i = N; i-- > 0;) {
+        a[i] = intrinsics::div128_64(r, a[i], d, &r);
+    }
+    return r;
+}
+
+/**
+ * @brief División binaria con resto (restauración bit a bit)
+ * @pre den != 0 y bit_width(den) < 64·N
+ */
+template <std::size_t N>
+constexpr void divmod(const limbs<N>& num, const limbs<N>& den, limbs<N>& q, limbs<N>& r) noexcept
+{
+    q = limbs<N>{};
+    r = limbs<N>{};
+    for (unsigned k = bit_width(num); k-- > 0;) {
+        r = shl(r, 1);
+        r[0] |= (num[k / 64] >> (k % 64)) & 1;
+        if (compare(r, den) >= 0) {
+            sub(r, den);
+            q[k / 64] |= uint64_t{1} << (k % 64);
+        }
+    }
+}
+
+/**
+ * @brief num / den como double correctamente redondeado (al par más cercano)
+ *
+ * Se calcula un cociente entero de al menos 66 bits escalando el numerador;
+ * los bits descartados más el resto (sticky) deciden el redondeo, así que no
+ * hay doble redondeo.
+ *
+ * @pre den != 0
+ */
+template <std::size_t L, std::size_t M>
+double ratio_to_double(const limbs<L>& num, const limbs<M>& den) noexcept
+{
+    constexpr std::size_t K = L + M + 2;
+    const unsigned bn = bit_width(num);
+    if (bn == 0) {
+        return 0.0;
+    }
+    const unsigned bd = bit_width(den);
+    const unsigned s = (bn < bd + 66) ? (bd + 66 - bn) : 0;
+
+    limbs<K> q{}, r{};
+    divmod(shl(resize<K>(num), s), resize<K>(den), q, r);
+
+    const unsigned w = bit_width(q); // >= 66
+    const unsigned drop = w - 53;
+    uint64_t mant = shr(q, drop)[0];
+    const bool guard = test_bit(q, drop - 1);
+    const bool sticky = any_below(q, drop - 1) || !is_zero(r);
+    if (guard && (sticky || (mant & 1) != 0)) {
+        ++mant; // Puede llegar a 2^53: sigue siendo exacto
+    }
+    return std::ldexp(static_cast<double>(mant), static_cast<int>(drop) - static_cast<int>(s));
+}
+
+/// Magnitud de un uint128_t/int128_t como 2 limbs
+template <typename T> constexpr limbs<2> magnitude(const T& v) noexcept
+{
+    limbs<2> m{v.low(), v.high()};
+    if constexpr (std::is_same_v<T, int128_t>) {
+        if ((v.high() >> 63) != 0) {
+            negate(m);
+        }
+    }
+    return m;
+}
+
+} // namespace wide
+} // namespace detail
+
+} // namespace nstd
+
+#endif // UINT128_WIDE_HPP
@@ -4,8 +4,10 @@
  */
 
 #include "int128/int128_algorithm.hpp"
+#include "uint128/uint128_parallel.hpp"
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 
 using namespace nstd;
@@ -65,6 +67,26 @@ void test_find_if_int128()
     std::cout << " [PASS]\n";
 }
 
+void test_count_if_int128()
+{
+    std::cout << "Test: count_if_int128...";
+
+    std::vector<int128_t> vec = {int128_t(-15), int128_t(-5), int128_t(0), int128_t(10),
+                                 -int128_t(1, 0)};
+
+    // Contar negativos (incluye -2^64)
+    auto negatives =
+        count_if_int128(vec.begin(), vec.end(), [](const int128_t& x) { return x < int128_t(0); });
+    assert(negatives == 3);
+
+    // Ninguno mayor que 100
+    auto none =
+        count_if_int128(vec.begin(), vec.end(), [](const int128_t& x) { return x > int128_t(100); });
+    assert(none == 0);
+
+    std::cout << " [PASS]\n";
+}
+
 // ===============================================================================
 // TESTS DE TRANSFORMACION
 // ===============================================================================
@@ -386,6 +408,69 @@ void test_calculate_stats()
     auto stats_empty = calculate_stats(empty.begin(), empty.end());
     assert(stats_empty.count == 0);
 
+    // Media con |suma| por encima de 2^64 (antes se truncaba a los 64 bits bajos)
+    std::vector<int128_t> big = {-int128_t(1, 0), -int128_t(3, 0)};
+    auto stats_big = calculate_stats(big.begin(), big.end());
+    assert(stats_big.mean() == -36893488147419103232.0); // -2^65
+
+    std::cout << " [PASS]\n";
+}
+
+// ===============================================================================
+// TESTS DE ALGORITMOS PARALELOS
+// ===============================================================================
+
+void test_parallel_algorithms()
+{
+    std::cout << "Test: algoritmos paralelos...";
+
+    // Pool propio y grano pequeno: varios hilos aunque la maquina tenga un nucleo
+    fork_join_pool pool(4);
+    const auto par = execution::par.on(pool).with_grain(64);
+
+    std::vector<int128_t> vec(10007);
+    uint64_t x = 0x9E3779B97F4A7C15ull;
+    for (auto& v : vec) {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        v = int128_t(x >> 44, x) * int128_t((x & 1) ? -10 : 10); // Multiplos de 10 con signo
+    }
+    vec[17] = int128_t(0);
+
+    for (unsigned threads : {1u, 2u, 3u, 4u}) {
+        const auto p = par(threads);
+        assert(sum_int128(p, vec.begin(), vec.end()) == sum_int128(vec.begin(), vec.end()));
+        assert(product_int128(p, vec.begin(), vec.end()) == int128_t(0));
+        assert(gcd_range(p, vec.begin(), vec.end()) == gcd_range(vec.begin(), vec.end()));
+
+        auto is_negative = [](const int128_t& v) { return v < int128_t(0); };
+        assert(count_if_int128(p, vec.begin(), vec.end(), is_negative) ==
+               count_if_int128(vec.begin(), vec.end(), is_negative));
+
+        auto ps = calculate_stats(p, vec.begin(), vec.end());
+        auto ss = calculate_stats(vec.begin(), vec.end());
+        assert(ps.min_value == ss.min_value && ps.max_value == ss.max_value);
+        assert(ps.sum == ss.sum && ps.count == ss.count);
+        assert(ps.negative_count == ss.negative_count && ps.zero_count == ss.zero_count);
+        assert(ps.positive_count == ss.positive_count);
+    }
+
+    // LCM sin desbordamiento, con signos alternos
+    std::vector<int128_t> divisors(5000);
+    const int small[] = {8, -9, 5, -7, 11, -13, 16, -12};
+    for (std::size_t i = 0; i < divisors.size(); ++i)
+        divisors[i] = int128_t(small[i % 8]);
+    assert(lcm_range(par, divisors.begin(), divisors.end()) == int128_t(720720));
+    assert(lcm_range(par, divisors.begin(), divisors.end()) ==
+           lcm_range(divisors.begin(), divisors.end()));
+    assert(gcd_range(par, divisors.begin(), divisors.end()) == int128_t(1));
+
+    // Rangos vacios: mismos valores que la version secuencial
+    std::vector<int128_t> empty;
+    assert(gcd_range(par, empty.begin(), empty.end()) == int128_t(0));
+    assert(lcm_range(par, empty.begin(), empty.end()) == int128_t(0));
+    assert(sum_int128(par, empty.begin(), empty.end()) == int128_t(0));
+    assert(calculate_stats(par, empty.begin(), empty.end()).count == 0);
+
     std::cout << " [PASS]\n";
 }
 
@@ -401,6 +486,7 @@ int main()
 
     test_binary_search_int128();
     test_find_if_int128();
+    test_count_if_int128();
     test_transform_int128();
     test_for_each_int128();
     test_accumulate_int128();
@@ -415,6 +501,7 @@ int main()
     test_partition_by_sign();
     test_max_abs_value();
     test_calculate_stats();
+    test_parallel_algorithms();
 
     std::cout << "\n========================================\n";
     std::cout << "  [OK] Todos los tests pasaron\n";
@@ -0,0 +1,167 @@
+/*
+ * Tests extraídos para int128_random.hpp
+ * uniform_int128_distribution: rangos negativos y que cruzan el cero,
+ * extremos de numeric_limits, rango completo, generate en bloque y
+ * parámetros inválidos
+ */
+
+#include "../include/int128/int128_limits.hpp"
+#include "../include/int128/int128_random.hpp"
+#include "../include/int128/int128_t.hpp"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace nstd;
+
+using limits = nstd::numeric_limits<int128_t>;
+
+// =============================================================================
+// TEST: rangos con signo
+// =============================================================================
+bool test_signed_ranges()
+{
+    std::cout << "\n=== TEST: rangos con signo ===\n";
+
+    pcg64 rng(7);
+
+    // [-3, 3]: los siete valores aparecen con frecuencias parecidas
+    uniform_int128_distribution small(int128_t(-3), int128_t(3));
+    std::size_t counts[7] = {};
+    constexpr std::size_t samples = 70000;
+    for (std::size_t i = 0; i < samples; ++i) {
+        const int128_t v = small(rng);
+        assert(v >= int128_t(-3) && v <= int128_t(3));
+        ++counts[static_cast<std::size_t>((v + int128_t(3)).low())];
+    }
+    for (std::size_t c : counts) {
+        assert(c > samples / 7 - 1000 && c < samples / 7 + 1000);
+    }
+
+    // Rango enteramente negativo, pegado al mínimo
+    uniform_int128_distribution bottom(limits::min(), limits::min() + int128_t(1));
+    bool seen_min = false, seen_next = false;
+    for (int i = 0; i < 200; ++i) {
+        const int128_t v = bottom(rng);
+        assert(v == limits::min() || v == limits::min() + int128_t(1));
+        seen_min |= v == limits::min();
+        seen_next |= v != limits::min();
+    }
+    assert(seen_min && seen_next);
+
+    // Rango completo: la mitad de los valores son negativos
+    uniform_int128_distribution full;
+    assert(full.min() == limits::min() && full.max() == limits::max());
+    std::size_t negative = 0;
+    for (std::size_t i = 0; i < samples; ++i) {
+        negative += full(rng) < int128_t(0) ? 1 : 0;
+    }
+    assert(negative > samples / 2 - 1500 && negative < samples / 2 + 1500);
+
+    // Cotas grandes a ambos lados del cero con un generador de 32 bits
+    std::mt19937 mt(8);
+    const int128_t lo = -(int128_t(1) << 100);
+    const int128_t hi = int128_t(1) << 90;
+    uniform_int128_distribution wide(lo, hi);
+    for (int i = 0; i < 1000; ++i) {
+        const int128_t v = wide(mt);
+        assert(v >= lo && v <= hi);
+    }
+
+    assert(uniform_int128_distribution(int128_t(-5), int128_t(-5))(rng) == int128_t(-5));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: generate en bloque
+// =============================================================================
+bool test_generate()
+{
+    std::cout << "\n=== TEST: generate en bloque ===\n";
+
+    uniform_int128_distribution d(int128_t(-1000), int128_t(1000));
+    std::vector<int128_t> out(1000); // Más de un tramo del buffer interno
+
+    pcg64 rng(9);
+    d.generate(out, rng);
+    bool any_negative = false, any_positive = false;
+    for (const auto& v : out) {
+        assert(v >= int128_t(-1000) && v <= int128_t(1000));
+        any_negative |= v < int128_t(0);
+        any_positive |= v > int128_t(0);
+    }
+    assert(any_negative && any_positive);
+
+    std::mt19937_64 mt(10);
+    d.param(uniform_int128_distribution::param_type(limits::max() - int128_t(9)));
+    d.generate(out, mt);
+    for (const auto& v : out) {
+        assert(v >= limits::max() - int128_t(9));
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: parámetros
+// =============================================================================
+bool test_parameters()
+{
+    std::cout << "\n=== TEST: parámetros ===\n";
+
+    uniform_int128_distribution d(int128_t(-2), int128_t(2));
+    assert(d.a() == int128_t(-2) && d.b() == int128_t(2));
+    assert(d == uniform_int128_distribution(d.param()));
+    assert(!(d == uniform_int128_distribution()));
+
+    bool thrown = false;
+    try {
+        uniform_int128_distribution bad(int128_t(1), int128_t(-1));
+        (void)bad;
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  int128_random.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_signed_ranges);
+    RUN_TEST(test_generate);
+    RUN_TEST(test_parameters);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
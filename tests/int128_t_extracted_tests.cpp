@@ -361,6 +361,19 @@ void test_int128_right_shift()
         // Arithmetic right shift for signed
         assert(result.low() == (val >> shift));
     }
+
+    // Negative values: sign extension across the word boundary and past 127
+    for (int i = 0; i < 1000; ++i) {
+        const int64_t high = static_cast<int64_t>(rng() | (1ULL << 63));
+        const int shift = 64 + static_cast<int>(rng() % 64);
+        [[maybe_unused]] int128_t result = int128_t(static_cast<uint64_t>(high), rng()) >> shift;
+        assert(result.high() == ~0ULL);
+        assert(result.low() == static_cast<uint64_t>(high >> (shift - 64)));
+    }
+    assert((int128_t(-5) >> 128) == int128_t(-1));
+    assert((int128_t(-5) >> 1000) == int128_t(-1));
+    assert((int128_t(5) >> 1000) == int128_t(0));
+    assert((int128_t(-5) >> -3) == int128_t(-5));
     std::cout << "test_int128_right_shift passed" << std::endl;
 }
 
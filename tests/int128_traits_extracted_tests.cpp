@@ -342,6 +342,41 @@ bool test_hash()
     return true;
 }
 
+// =============================================================================
+// TEST: std::hash (especialización en namespace std)
+// =============================================================================
+bool test_std_hash()
+{
+    std::cout << "\n=== TEST: std::hash<int128_t> ===\n";
+
+    std::hash<int128_t> std_hasher;
+    nstd::hash<int128_t> nstd_hasher;
+
+    int128_t neg(-1);
+    int128_t pos(0, 1);
+    assert(std_hasher(neg) == nstd_hasher(neg) && "std::hash debe delegar en nstd::hash");
+    assert(std_hasher(pos) == nstd_hasher(pos) && "std::hash debe delegar en nstd::hash");
+
+    // Con el XOR antiguo hash(x) == hash(-x - 1) para todo x (high ^ low se conserva
+    // al complementar ambas mitades) y (h, l) colisionaba con (l, h)
+    assert(std_hasher(int128_t(5)) != std_hasher(int128_t(-6)));
+    assert(std_hasher(int128_t(1, 2)) != std_hasher(int128_t(2, 1)));
+
+    // unordered_map sin argumento de hash explícito
+    std::unordered_map<int128_t, int> map;
+    for (int i = -500; i < 500; ++i) {
+        map[int128_t(i)] = i;
+    }
+    assert(map.size() == 1000);
+    for (int i = -500; i < 500; ++i) {
+        assert(map.at(int128_t(i)) == i);
+    }
+
+    std::cout << "  std::unordered_map<int128_t, int> funciona sin hash explícito\n";
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
 // =============================================================================
 // TEST: numeric_limits
 // =============================================================================
@@ -426,6 +461,7 @@ int main()
 
     // Tests de hash
     RUN_TEST(test_hash);
+    RUN_TEST(test_std_hash);
 
     // Tests de numeric_limits
     RUN_TEST(test_numeric_limits);
@@ -0,0 +1,294 @@
+/*
+ * Tests extraídos para uint128_accumulator.hpp
+ * Acumuladores anchos, sumas/productos exactos, media y varianza correctamente
+ * redondeadas, y variantes vectoriales y multihilo
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/uint128/uint128_accumulator.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+std::mt19937_64 rng(0xacc);
+
+const int128_t int_min(uint64_t{1} << 63, 0);
+const int128_t int_max(~uint64_t{0} >> 1, ~uint64_t{0});
+
+const intrinsics::simd_level levels[] = {intrinsics::simd_level::scalar,
+                                         intrinsics::simd_level::avx2,
+                                         intrinsics::simd_level::avx512};
+
+// Ejecuta f para cada ruta soportada por la CPU
+template <typename F> void for_each_level(F f)
+{
+    for (auto level : levels) {
+        if (static_cast<int>(level) > static_cast<int>(intrinsics::best_simd_level())) {
+            continue;
+        }
+        intrinsics::force_simd_level(level);
+        f();
+    }
+    intrinsics::reset_simd_level();
+}
+
+// Compilación en tiempo de compilación: max + 1 acarrea al tercer limb
+static_assert(accumulator192(uint128_t::max()).add(uint128_t(1)).limb(2) == 1);
+static_assert(int_accumulator192(int128_t(-1)).is_negative());
+
+// =============================================================================
+// TEST: acarreo y préstamo más allá de 128 bits
+// =============================================================================
+bool test_carry()
+{
+    std::cout << "\n=== TEST: acarreo sobre 128 bits ===\n";
+
+    // 1000 · (2^128 − 1) = 999·2^128 + (2^128 − 1000)
+    std::vector<uint128_t> maxes(1000, uint128_t::max());
+    const auto acc = accumulate_exact(maxes.begin(), maxes.end());
+    assert(acc.limb(0) == ~uint64_t{0} - 999);
+    assert(acc.limb(1) == ~uint64_t{0});
+    assert(acc.limb(2) == 999);
+    assert(!acc.fits());
+
+    // 2^128 en decimal
+    accumulator192 two128(uint128_t::max());
+    two128 += uint128_t(1);
+    assert(two128.to_string() == "340282366920938463463374607431768211456");
+    assert(accumulator192().to_string() == "0");
+    assert(two128.to_double() == 340282366920938463463374607431768211456.0);
+
+    // Restar vuelve al rango de uint128_t
+    two128 -= uint128_t(1);
+    assert(two128.fits() && two128.truncated() == uint128_t::max());
+
+    // Con signo: 3·min() = −3·2^127
+    std::vector<int128_t> mins(3, int_min);
+    const auto s = accumulate_exact(mins.begin(), mins.end());
+    assert(s.is_negative() && !s.fits());
+    assert(s.to_string() == "-510423550381407695195061911147652317184");
+    int_accumulator192 back(s);
+    back += int_accumulator192(int_max) + int_accumulator192(int_max);
+    back += int128_t(2);
+    assert(back.fits() && back.truncated() == int_min);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: ruta vectorial frente a la escalar, uint128_t e int128_t
+// =============================================================================
+bool test_span_sum()
+{
+    std::cout << "\n=== TEST: accumulate_exact(span) ===\n";
+
+    for (std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{4099}}) {
+        std::vector<uint128_t> u(n);
+        std::vector<int128_t> s(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            // Mitades altas grandes para forzar acarreos y negativos frecuentes
+            u[i] = uint128_t(rng() | (uint64_t{1} << 63), rng());
+            s[i] = int128_t(rng(), rng());
+        }
+        const auto u_ref = accumulate_exact(u.begin(), u.end());
+        const auto s_ref = accumulate_exact(s.begin(), s.end());
+        for_each_level([&] {
+            assert(accumulate_exact(std::span<const uint128_t>(u)) == u_ref);
+            assert(accumulate_exact(std::span<const int128_t>(s)) == s_ref);
+        });
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: conversión a double correctamente redondeada
+// =============================================================================
+bool test_rounding()
+{
+    std::cout << "\n=== TEST: redondeo correcto ===\n";
+
+    const uint64_t p53 = uint64_t{1} << 53;
+    assert(accumulator192(uint128_t(p53 + 1)).to_double() == 9007199254740992.0);  // empate -> par
+    assert(accumulator192(uint128_t(p53 + 3)).to_double() == 9007199254740996.0);  // empate -> par
+    assert(int_accumulator192(int128_t(-static_cast<int64_t>(p53 + 5))).to_double() ==
+           -9007199254740996.0);
+
+    // Con numerador y denominador exactos en double, IEEE ya redondea bien
+    for (int i = 0; i < 10000; ++i) {
+        const uint64_t num = rng() >> 11;
+        const uint64_t den = (rng() >> 11) | 1;
+        const wide_fraction<3, false> f{accumulator192(uint128_t(num)), den};
+        assert(f.to_double() == static_cast<double>(num) / static_cast<double>(den));
+        assert(f.quotient().truncated() == uint128_t(num / den));
+        assert(f.remainder() == num % den);
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: producto escalar exacto
+// =============================================================================
+bool test_inner_product()
+{
+    std::cout << "\n=== TEST: inner_product_exact ===\n";
+
+    // 4 · 2^127 · 2^127 = 2^256
+    const uint128_t p127(uint64_t{1} << 63, 0);
+    std::vector<uint128_t> a(4, p127);
+    const auto ip = inner_product_exact(a.begin(), a.end(), a.begin());
+    assert(ip.limb(4) == 1 && ip.limb(3) == 0 && ip.limb(0) == 0);
+
+    // Multiplicar por 1 equivale a sumar
+    std::vector<uint128_t> u(257), ones(257, uint128_t(1));
+    for (auto& x : u) {
+        x = uint128_t(rng(), rng());
+    }
+    const auto by_one = inner_product_exact(u.begin(), u.end(), ones.begin());
+    const auto sum = accumulate_exact(u.begin(), u.end());
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert(by_one.limb(i) == sum.limb(i));
+    }
+
+    // Con signo: (−2^64)·(2^64) + (2^64)·(2^64) = 0 y (−3)·5 = −15
+    std::vector<int128_t> x = {-int128_t(1, 0), int128_t(1, 0), int128_t(-3)};
+    std::vector<int128_t> y = {int128_t(1, 0), int128_t(1, 0), int128_t(5)};
+    const auto sp = inner_product_exact(x.begin(), x.end(), y.begin());
+    assert(sp.is_negative() && sp.fits() && sp.truncated() == int128_t(-15));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: media y varianza exactas
+// =============================================================================
+bool test_stats()
+{
+    std::cout << "\n=== TEST: calculate_stats_exact ===\n";
+
+    std::vector<uint128_t> small = {uint128_t(1), uint128_t(2), uint128_t(3), uint128_t(4)};
+    auto st = calculate_stats_exact(small.begin(), small.end());
+    assert(st.mean() == 2.5);
+    assert(st.variance() == 1.25);
+    assert(st.sample_variance() == 5.0 / 3.0);
+
+    // Desplazado a 2^120: con doubles la varianza se pierde por cancelación
+    std::vector<uint128_t> shifted;
+    for (const auto& v : small) {
+        shifted.push_back(v + uint128_t(uint64_t{1} << 56, 0));
+    }
+    st = calculate_stats_exact(shifted.begin(), shifted.end());
+    assert(st.variance() == 1.25);
+    assert(st.min_value == shifted[0] && st.max_value == shifted[3]);
+
+    // Suma que desborda uint128_t: media exacta de dos valores cercanos a max()
+    std::vector<uint128_t> near_max = {uint128_t::max(), uint128_t::max() - uint128_t(2)};
+    st = calculate_stats_exact(near_max.begin(), near_max.end());
+    assert(!st.sum.fits());
+    assert(st.exact_mean().quotient().truncated() == uint128_t::max() - uint128_t(1));
+    assert(st.exact_mean().remainder() == 0);
+
+    // Con signo
+    std::vector<int128_t> s = {int128_t(-7), int128_t(3), int128_t(-2), int128_t(6)};
+    auto ss = calculate_stats_exact(s.begin(), s.end());
+    assert(ss.mean() == 0.0);
+    assert(ss.variance() == 24.5);
+    assert(ss.min_value == int128_t(-7) && ss.max_value == int128_t(6));
+
+    std::vector<int128_t> empty;
+    assert(calculate_stats_exact(empty.begin(), empty.end()).variance() == 0.0);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: reducciones multihilo
+// =============================================================================
+bool test_parallel()
+{
+    std::cout << "\n=== TEST: parallel_* ===\n";
+
+    const std::size_t n = (std::size_t{1} << 18) + 3;
+    std::vector<uint128_t> u(n);
+    std::vector<int128_t> s(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        u[i] = uint128_t(rng(), rng());
+        s[i] = int128_t(rng(), rng());
+    }
+    const std::span<const uint128_t> us(u);
+    const std::span<const int128_t> ss(s);
+
+    // Pool propio: hilos reales aunque la máquina tenga un solo núcleo
+    fork_join_pool pool(4);
+    for (unsigned threads : {1u, 3u, 4u}) {
+        const auto policy = execution::par(threads).on(pool);
+        assert(parallel_accumulate_exact(us, policy) == accumulate_exact(us));
+        assert(parallel_accumulate_exact(ss, policy) == accumulate_exact(ss));
+        assert(parallel_inner_product_exact(ss, ss, policy) ==
+               inner_product_exact(s.begin(), s.end(), s.begin()));
+
+        const auto par = parallel_calculate_stats_exact(us, policy);
+        const auto seq = calculate_stats_exact(u.begin(), u.end());
+        assert(par.count == seq.count && par.sum == seq.sum);
+        assert(par.sum_squares == seq.sum_squares);
+        assert(par.min_value == seq.min_value && par.max_value == seq.max_value);
+    }
+
+    bool thrown = false;
+    try {
+        (void)parallel_inner_product_exact(us, us.first(n - 1));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_accumulator.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_carry);
+    RUN_TEST(test_span_sum);
+    RUN_TEST(test_rounding);
+    RUN_TEST(test_inner_product);
+    RUN_TEST(test_stats);
+    RUN_TEST(test_parallel);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
@@ -4,10 +4,12 @@
  */
 
 #include "../include/uint128/uint128_algorithm.hpp"
+#include "../include/uint128/uint128_parallel.hpp"
 #include "../include/uint128/uint128_t.hpp"
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 
 using namespace nstd;
@@ -74,6 +76,27 @@ void test_find_if_uint128()
     std::cout << " [PASS]\n";
 }
 
+void test_count_if_uint128()
+{
+    std::cout << "Test: count_if_uint128...";
+
+    std::vector<uint128_t> vec = {uint128_t(5), uint128_t(10), uint128_t(15), uint128_t(20),
+                                  uint128_t(1, 0)};
+
+    // Contar pares (incluye 2^64)
+    auto evens = count_if_uint128(vec.begin(), vec.end(), [](const uint128_t& x) {
+        return (x % uint128_t(2)) == uint128_t(0);
+    });
+    assert(evens == 3);
+
+    // Ninguno mayor que 2^65
+    auto none = count_if_uint128(vec.begin(), vec.end(),
+                                 [](const uint128_t& x) { return x > uint128_t(2, 0); });
+    assert(none == 0);
+
+    std::cout << " [PASS]\n";
+}
+
 // ===============================================================================
 // TESTS DE TRANSFORMACIÓN
 // ===============================================================================
@@ -385,6 +408,85 @@ void test_calculate_stats()
     auto stats_empty = calculate_stats(empty.begin(), empty.end());
     assert(stats_empty.count == 0);
 
+    // Media con suma por encima de 2^64 (antes se truncaba a los 64 bits bajos)
+    std::vector<uint128_t> big = {uint128_t(1, 0), uint128_t(3, 0)};
+    auto stats_big = calculate_stats(big.begin(), big.end());
+    assert(stats_big.mean() == 36893488147419103232.0); // 2^65
+
+    std::cout << " [PASS]\n";
+}
+
+// ===============================================================================
+// TESTS DE ALGORITMOS PARALELOS
+// ===============================================================================
+
+void test_parallel_algorithms()
+{
+    std::cout << "Test: algoritmos paralelos...";
+
+    // Pool propio y grano pequeno: varios hilos aunque la maquina tenga un nucleo
+    fork_join_pool pool(4);
+    const auto par = execution::par.on(pool).with_grain(64);
+
+    std::vector<uint128_t> vec(10007);
+    uint64_t x = 0x9E3779B97F4A7C15ull;
+    for (auto& v : vec) {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        v = uint128_t(x >> 40, x) * uint128_t(6); // Todos multiplos de 6
+    }
+
+    for (unsigned threads : {1u, 2u, 3u, 4u}) {
+        const auto p = par(threads);
+        assert(sum_uint128(p, vec.begin(), vec.end()) == sum_uint128(vec.begin(), vec.end()));
+        assert(product_uint128(p, vec.begin(), vec.end()) ==
+               product_uint128(vec.begin(), vec.end()));
+        assert(gcd_range(p, vec.begin(), vec.end()) == gcd_range(vec.begin(), vec.end()));
+
+        auto is_even_high = [](const uint128_t& v) { return (v.high() & 1) == 0; };
+        assert(count_if_uint128(p, vec.begin(), vec.end(), is_even_high) ==
+               count_if_uint128(vec.begin(), vec.end(), is_even_high));
+
+        auto ps = calculate_stats(p, vec.begin(), vec.end());
+        auto ss = calculate_stats(vec.begin(), vec.end());
+        assert(ps.min_value == ss.min_value && ps.max_value == ss.max_value);
+        assert(ps.sum == ss.sum && ps.count == ss.count);
+    }
+
+    // Parada temprana: un 1 en el ultimo bloque fija el GCD
+    std::vector<uint128_t> with_one = vec;
+    with_one.back() = uint128_t(1);
+    assert(gcd_range(par, with_one.begin(), with_one.end()) == uint128_t(1));
+
+    // LCM sin desbordamiento: divisores de 720720 repartidos por todo el rango
+    std::vector<uint128_t> divisors(5000);
+    const uint64_t small[] = {8, 9, 5, 7, 11, 13, 16, 12};
+    for (std::size_t i = 0; i < divisors.size(); ++i)
+        divisors[i] = uint128_t(small[i % 8]);
+    assert(lcm_range(par, divisors.begin(), divisors.end()) == uint128_t(720720));
+    divisors[4321] = uint128_t(0);
+    assert(lcm_range(par, divisors.begin(), divisors.end()) == uint128_t(0));
+    assert(product_uint128(par, divisors.begin(), divisors.end()) == uint128_t(0));
+
+    // Rangos vacios: mismos valores que la version secuencial
+    std::vector<uint128_t> empty;
+    assert(gcd_range(par, empty.begin(), empty.end()) == uint128_t(0));
+    assert(lcm_range(par, empty.begin(), empty.end()) == uint128_t(0));
+    assert(product_uint128(par, empty.begin(), empty.end()) == uint128_t(1));
+    assert(calculate_stats(par, empty.begin(), empty.end()).count == 0);
+
+    // Una excepcion en un hilo se relanza en el llamante
+    bool thrown = false;
+    try {
+        (void)count_if_uint128(par, vec.begin(), vec.end(), [&](const uint128_t& v) {
+            if (&v == &vec[9000])
+                throw std::runtime_error("pred");
+            return false;
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
     std::cout << " [PASS]\n";
 }
 
@@ -401,6 +503,7 @@ int main()
     // Tests de búsqueda
     test_binary_search_uint128();
     test_find_if_uint128();
+    test_count_if_uint128();
 
     // Tests de transformación
     test_transform_uint128();
@@ -422,6 +525,9 @@ int main()
     test_generate_geometric_sequence();
     test_calculate_stats();
 
+    // Tests de algoritmos paralelos
+    test_parallel_algorithms();
+
     std::cout << "\n========================================\n";
     std::cout << "  [OK] Todos los tests pasaron\n";
     std::cout << "========================================\n";
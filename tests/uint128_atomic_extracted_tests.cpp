@@ -0,0 +1,389 @@
+/*
+ * Tests extraídos para uint128_atomic.hpp
+ * atomic128<uint128_t> / atomic128<int128_t>: operaciones básicas, CAS,
+ * ausencia de lecturas partidas con varios hilos, fallback con cerrojos,
+ * familia fetch_* con espera exponencial, wait/notify y atomic_ref128 con
+ * las operaciones en bloque sobre arrays
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/int128/int128_thread_safety.hpp"
+#include "../include/uint128/uint128_atomic.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+static_assert(alignof(atomic_uint128) == 16 && sizeof(atomic_uint128) == 16);
+static_assert(alignof(atomic_int128) == 16 && sizeof(atomic_int128) == 16);
+static_assert(atomic_uint128::required_alignment == 16);
+
+// =============================================================================
+// TEST: operaciones básicas
+// =============================================================================
+bool test_basic()
+{
+    std::cout << "\n=== TEST: load/store/exchange ===\n";
+
+    std::cout << "  is_lock_free: " << atomic_uint128().is_lock_free()
+              << "  is_always_lock_free: " << atomic_uint128::is_always_lock_free << "\n";
+
+    atomic_uint128 a;
+    assert(a.load() == uint128_t(0));
+
+    const uint128_t v(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull);
+    for (auto order : {std::memory_order_relaxed, std::memory_order_release, std::memory_order_seq_cst}) {
+        a.store(v, order);
+        assert(a.load(std::memory_order_acquire) == v);
+        assert(a.load(std::memory_order_relaxed) == v);
+    }
+
+    assert(a.exchange(uint128_t(7)) == v);
+    assert(static_cast<uint128_t>(a) == uint128_t(7));
+    a = uint128_t(~0ull, ~0ull);
+    assert(a.load() == uint128_t(~0ull, ~0ull));
+
+    atomic_int128 s(int128_t(-5));
+    assert(s.load() == int128_t(-5));
+    assert(s.exchange(int128_t(uint64_t{1} << 63, 0)) == int128_t(-5));
+    assert(s.load() == int128_t(uint64_t{1} << 63, 0));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: compare_exchange
+// =============================================================================
+bool test_cas()
+{
+    std::cout << "\n=== TEST: compare_exchange ===\n";
+
+    atomic_uint128 a(uint128_t(1, 2));
+
+    // Falla si sólo coincide una mitad, y devuelve el valor actual
+    uint128_t expected(1, 3);
+    assert(!a.compare_exchange_strong(expected, uint128_t(9, 9)));
+    assert(expected == uint128_t(1, 2));
+    expected = uint128_t(0, 2);
+    assert(!a.compare_exchange_weak(expected, uint128_t(9, 9), std::memory_order_acq_rel,
+                                    std::memory_order_acquire));
+    assert(expected == uint128_t(1, 2));
+
+    assert(a.compare_exchange_strong(expected, uint128_t(9, 9), std::memory_order_relaxed));
+    assert(expected == uint128_t(1, 2) && a.load() == uint128_t(9, 9));
+
+    atomic_int128 s(int128_t(-1));
+    int128_t e(-1);
+    assert(s.compare_exchange_strong(e, int128_t(1)));
+    assert(s.load() == int128_t(1));
+
+    // Fallback con cerrojos: misma semántica
+    alignas(16) uint64_t words[2] = {5, 6};
+    uint64_t lo = 5, hi = 7;
+    assert(!intrinsics::detail::cas128_locked(words, lo, hi, 1, 1));
+    assert(lo == 5 && hi == 6);
+    assert(intrinsics::detail::cas128_locked(words, lo, hi, 1, 1));
+    assert(words[0] == 1 && words[1] == 1);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: concurrencia
+// =============================================================================
+bool test_concurrent()
+{
+    std::cout << "\n=== TEST: contador CAS e integridad con varios hilos ===\n";
+
+    constexpr int threads = 4;
+    constexpr int iterations = 20000;
+
+    // Incrementos que cruzan el límite de 64 bits: el acarreo a la parte alta debe ser atómico
+    const uint128_t start(0, ~uint64_t{0} - iterations);
+    atomic_uint128 counter(start);
+    int128_threadsafe::ThreadSafeInt128Atomic scounter(int128_t(0)); // Envoltorio sobre atomic128<int128_t>
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&] {
+            for (int i = 0; i < iterations; ++i) {
+                uint128_t cur = counter.load(std::memory_order_relaxed);
+                while (!counter.compare_exchange_weak(cur, cur + uint128_t(1))) {
+                }
+                int128_t scur = scounter.load();
+                while (!scounter.compare_exchange_weak(scur, scur - int128_t(1))) {
+                }
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    assert(counter.load() == start + uint128_t(threads * iterations));
+    assert(scounter.load() == int128_t(-threads * iterations));
+
+    // Un escritor alterna dos valores con mitades distintas; los lectores nunca ven una mezcla
+    const uint128_t x(0x1111111111111111ull, 0x2222222222222222ull);
+    const uint128_t y(0xAAAAAAAAAAAAAAAAull, 0xBBBBBBBBBBBBBBBBull);
+    uint128_threadsafe::ThreadSafeUint128Atomic shared(x);
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    pool.clear();
+    for (int r = 0; r < threads - 1; ++r) {
+        pool.emplace_back([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                const uint128_t v = shared.load(std::memory_order_acquire);
+                if (v != x && v != y) {
+                    torn.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 100000; ++i) {
+        shared.store((i & 1) ? x : y, std::memory_order_release);
+        if ((i & 7) == 0) {
+            (void)shared.exchange((i & 2) ? x : y);
+        }
+    }
+    done.store(true);
+    for (auto& th : pool) {
+        th.join();
+    }
+    assert(torn.load() == 0);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: fetch_*
+// =============================================================================
+bool test_fetch_ops()
+{
+    std::cout << "\n=== TEST: fetch_add/sub/and/or/xor/mul/min/max ===\n";
+
+    atomic_uint128 a(uint128_t(0, ~0ull));
+    assert(a.fetch_add(uint128_t(1)) == uint128_t(0, ~0ull));
+    assert(a.load() == uint128_t(1, 0)); // Acarreo a la parte alta
+    assert(a.fetch_sub(uint128_t(2)) == uint128_t(1, 0));
+    assert(a.load() == uint128_t(0, ~0ull - 1));
+    assert(a.fetch_or(uint128_t(0xF0, 1)) == uint128_t(0, ~0ull - 1));
+    assert(a.fetch_and(uint128_t(0x30, 0xFF)) == uint128_t(0xF0, ~0ull));
+    assert(a.fetch_xor(uint128_t(0x10, 0x0F)) == uint128_t(0x30, 0xFF));
+    assert(a.load() == uint128_t(0x20, 0xF0));
+    assert(a.fetch_mul(uint128_t(0, 1ull << 32)) == uint128_t(0x20, 0xF0));
+    assert(a.load() == uint128_t(0x20ull << 32, 0xF0ull << 32));
+
+    a.store(uint128_t(100));
+    assert(a.fetch_min(uint128_t(200)) == uint128_t(100) && a.load() == uint128_t(100));
+    assert(a.fetch_min(uint128_t(7)) == uint128_t(100) && a.load() == uint128_t(7));
+    assert(a.fetch_max(uint128_t(1, 0)) == uint128_t(7) && a.load() == uint128_t(1, 0));
+    assert(a.fetch_max(uint128_t(3)) == uint128_t(1, 0));
+
+    assert(++a == uint128_t(1, 1) && a++ == uint128_t(1, 1) && a.load() == uint128_t(1, 2));
+    assert(--a == uint128_t(1, 1) && (a -= uint128_t(0, 2)) == uint128_t(0, ~0ull));
+    assert((a += uint128_t(1)) == uint128_t(1, 0) && (a |= uint128_t(3)) == uint128_t(1, 3));
+    assert((a &= uint128_t(1)) == uint128_t(1) && (a ^= uint128_t(1)) == uint128_t(0));
+
+    // Con signo: min/max en complemento a dos, mul con signo
+    atomic_int128 s(int128_t(-3));
+    assert(s.fetch_max(int128_t(-10)) == int128_t(-3) && s.load() == int128_t(-3));
+    assert(s.fetch_min(int128_t(-10)) == int128_t(-3) && s.load() == int128_t(-10));
+    assert(s.fetch_mul(int128_t(-7)) == int128_t(-10) && s.load() == int128_t(70));
+    assert(s.fetch_sub(int128_t(100)) == int128_t(70) && s.load() == int128_t(-30));
+
+    // Política sin espera
+    const backoff_policy none{0, 0, false};
+    const int128_t before = s.fetch_add(int128_t(30), std::memory_order_relaxed, none);
+    assert(before == int128_t(-30) && s.load() == int128_t(0));
+
+    // Concurrencia: sumas, máximos y bits disjuntos en ambas mitades
+    constexpr int threads = 4;
+    constexpr int iterations = 20000;
+    atomic_uint128 sum(uint128_t(0, ~0ull - 1000));
+    atomic_int128 smax(int128_t(uint64_t{1} << 63, 0));
+    atomic_uint128 bits;
+    uint128_threadsafe::ThreadSafeUint128Atomic wrapped(uint128_t(0));
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            for (int i = 0; i < iterations; ++i) {
+                sum.fetch_add(uint128_t(1), std::memory_order_relaxed, {.initial_spins = 2});
+                smax.fetch_max(int128_t(-1000000 + t * iterations + i), std::memory_order_relaxed);
+                wrapped.fetch_add(uint128_t(0, 3), std::memory_order_relaxed);
+                if (i < 32) {
+                    bits.fetch_or(uint128_t(0, 1) << unsigned(t * 32 + i));
+                }
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    assert(sum.load() == uint128_t(0, ~0ull - 1000) + uint128_t(threads * iterations));
+    assert(smax.load() == int128_t(-1000000 + threads * iterations - 1));
+    assert(wrapped.load() == uint128_t(3 * threads * iterations));
+    assert(bits.load() == uint128_t(~0ull, ~0ull));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: wait/notify
+// =============================================================================
+bool test_wait_notify()
+{
+    std::cout << "\n=== TEST: wait/notify ===\n";
+
+    // Valor distinto: vuelve inmediatamente
+    atomic_uint128 a(uint128_t(5));
+    a.wait(uint128_t(4));
+
+    // Ping-pong: cada lado espera al valor del otro. Los cambios sólo afectan a
+    // la parte alta, que un futex sobre 32 bits no vería
+    constexpr int rounds = 2000;
+    atomic_uint128 turn(uint128_t(0));
+    std::thread pong([&] {
+        for (int i = 0; i < rounds; ++i) {
+            turn.wait(uint128_t(2 * i, 0));
+            turn.store(uint128_t(2 * i + 2, 0));
+            turn.notify_one();
+        }
+    });
+    for (int i = 0; i < rounds; ++i) {
+        turn.store(uint128_t(2 * i + 1, 0));
+        turn.notify_one();
+        turn.wait(uint128_t(2 * i + 1, 0));
+    }
+    pong.join();
+    assert(turn.load() == uint128_t(2 * rounds, 0));
+
+    // Varios hilos dormidos en átomos distintos que comparten entrada de la tabla
+    atomic_int128 gates[4];
+    std::atomic<int> woken{0};
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; ++t) {
+        pool.emplace_back([&, t] {
+            gates[t].wait(int128_t(0));
+            woken.fetch_add(1);
+        });
+    }
+    for (int t = 0; t < 4; ++t) {
+        gates[t].store(int128_t(-1));
+        gates[t].notify_one();
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    assert(woken.load() == 4);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: atomic_ref128
+// =============================================================================
+bool test_atomic_ref()
+{
+    std::cout << "\n=== TEST: atomic_ref128 y operaciones en bloque ===\n";
+
+    alignas(16) uint128_t table[8] = {};
+    assert(atomic_ref128<uint128_t>::is_suitably_aligned(table[3]));
+    assert(!atomic_ref128<uint128_t>::is_suitably_aligned(
+        *reinterpret_cast<uint128_t*>(reinterpret_cast<char*>(table) + 8)));
+
+    atomic_ref128<uint128_t> r(table[2]);
+    r.store(uint128_t(1, 2));
+    assert(table[2] == uint128_t(1, 2)); // Escribe en el propio objeto
+    assert(r.fetch_add(uint128_t(0, ~0ull)) == uint128_t(1, 2));
+    assert(table[2] == uint128_t(2, 1));
+    uint128_t expected(2, 1);
+    assert(r.compare_exchange_strong(expected, uint128_t(7)) && table[2] == uint128_t(7));
+    atomic_ref128<uint128_t> copy = r; // Las copias refieren al mismo objeto
+    assert(copy.exchange(uint128_t(9)) == uint128_t(7) && r.load() == uint128_t(9));
+    r = uint128_t(0);
+    assert(table[2] == uint128_t(0) && table[1] == uint128_t(0) && table[3] == uint128_t(0));
+
+    alignas(16) int128_t signed_cell = int128_t(-4);
+    atomic_ref128<int128_t> sr(signed_cell);
+    assert(sr.fetch_min(int128_t(-10)) == int128_t(-4) && signed_cell == int128_t(-10));
+    assert(++sr == int128_t(-9));
+
+    // Histograma compartido: cada hilo hace incrementos sueltos y vuelca uno local
+    constexpr int threads = 4;
+    constexpr int iterations = 10000;
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            uint128_t local[8] = {};
+            for (int i = 0; i < iterations; ++i) {
+                atomic_ref128<uint128_t>(table[i % 8]).fetch_add(uint128_t(1),
+                                                                 std::memory_order_relaxed);
+                local[(i + t) % 8] += uint128_t(0, ~0ull); // Fuerza acarreo en el total
+            }
+            atomic_add_each(std::span<uint128_t>(table), std::span<const uint128_t>(local));
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    const uint128_t per_bucket = uint128_t(threads * iterations / 8) * uint128_t(1, 0);
+    alignas(16) uint128_t snapshot[8];
+    atomic_load_all(std::span<uint128_t>(table), std::span<uint128_t>(snapshot));
+    for (const auto& v : snapshot) {
+        assert(v == per_bucket);
+    }
+
+    atomic_add_all(std::span<uint128_t>(table), uint128_t(0) - per_bucket);
+    for (const auto& v : table) {
+        assert(v == uint128_t(0));
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_atomic.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_basic);
+    RUN_TEST(test_cas);
+    RUN_TEST(test_concurrent);
+    RUN_TEST(test_fetch_ops);
+    RUN_TEST(test_wait_notify);
+    RUN_TEST(test_atomic_ref);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
@@ -6,6 +6,7 @@
 #include "uint128/uint128_bits.hpp"
 #include <cassert>
 #include <iostream>
+#include <random>
 #include <vector>
 
 using namespace nstd;
@@ -265,6 +266,33 @@ bool test_rotr()
     return true;
 }
 
+bool test_funnel_shift()
+{
+    std::mt19937_64 gen(45);
+    for (int iter = 0; iter < 200; ++iter) {
+        const uint128_t hi(gen(), gen());
+        const uint128_t lo(gen(), gen());
+        for (int n = -130; n <= 260; ++n) {
+            const int s = n & 127;
+            // Referencia con desplazamientos de 128 bits
+            const uint128_t left = s == 0 ? hi : (hi << s) | (lo >> (128 - s));
+            const uint128_t right = s == 0 ? lo : (lo >> s) | (hi << (128 - s));
+            ASSERT_TEST(funnel_shift_left(hi, lo, n) == left, "funnel_shift_left incorrecto");
+            ASSERT_TEST(funnel_shift_right(hi, lo, n) == right, "funnel_shift_right incorrecto");
+            ASSERT_TEST(rotl(hi, n) == funnel_shift_left(hi, hi, n), "rotl debe ser funnel_shift_left(v, v)");
+            ASSERT_TEST(rotr(hi, n) == funnel_shift_right(hi, hi, n), "rotr debe ser funnel_shift_right(v, v)");
+            ASSERT_TEST(rotl(rotr(hi, n), n) == hi, "rotl debe deshacer rotr");
+        }
+    }
+
+    static_assert(funnel_shift_left(uint128_t(0, 1), uint128_t(1ULL << 63, 0), 1) == uint128_t(0, 3));
+    static_assert(funnel_shift_right(uint128_t(0, 1), uint128_t(0, 0), 64) == uint128_t(1, 0));
+    static_assert(rotl(uint128_t(1ULL << 63, 0), 1) == uint128_t(0, 1));
+
+    TEST_PASS("test_funnel_shift");
+    return true;
+}
+
 bool test_reverse_bits()
 {
     // Test con 0
@@ -394,6 +422,144 @@ bool test_parallel_extract()
     return true;
 }
 
+// Referencia bit a bit (la implementación original)
+uint128_t reference_deposit(const uint128_t& value, const uint128_t& mask)
+{
+    uint128_t result(0);
+    int src = 0;
+    for (int i = 0; i < 128; ++i) {
+        if (get_bit(mask, i)) {
+            if (get_bit(value, src))
+                result = set_bit(result, i);
+            ++src;
+        }
+    }
+    return result;
+}
+
+uint128_t reference_extract(const uint128_t& value, const uint128_t& mask)
+{
+    uint128_t result(0);
+    int dst = 0;
+    for (int i = 0; i < 128; ++i) {
+        if (get_bit(mask, i)) {
+            if (get_bit(value, i))
+                result = set_bit(result, dst);
+            ++dst;
+        }
+    }
+    return result;
+}
+
+bool test_parallel_deposit_extract_paths()
+{
+    // Ruta constexpr
+    static_assert(parallel_deposit(uint128_t(0xF), uint128_t(0xAA)) == uint128_t(0xAA));
+    static_assert(parallel_extract(uint128_t(0xAA), uint128_t(0xAA)) == uint128_t(0xF));
+    static_assert(parallel_deposit(uint128_t(1, UINT64_MAX), uint128_t(0x6, UINT64_MAX)) ==
+                  uint128_t(0x2, UINT64_MAX));
+    static_assert(parallel_extract(~uint128_t(0), uint128_t(1, 0x8000000000000001ULL)) ==
+                  uint128_t(0x7));
+
+    std::mt19937_64 gen(12345);
+    std::vector<uint128_t> masks = {uint128_t(0),
+                                    ~uint128_t(0),
+                                    uint128_t(0, UINT64_MAX),
+                                    uint128_t(UINT64_MAX, 0),
+                                    uint128_t(1, 0x8000000000000000ULL),
+                                    uint128_t(0x8000000000000000ULL, 1)};
+    for (int i = 0; i < 2000; ++i) {
+        uint64_t hi = gen(), lo = gen();
+        switch (i % 4) {
+        case 1: // Máscaras dispersas
+            hi &= gen() & gen();
+            lo &= gen() & gen();
+            break;
+        case 2: // Máscaras densas
+            hi |= gen() | gen();
+            lo |= gen() | gen();
+            break;
+        case 3: // Rangos contiguos
+            lo = i % 64 == 0 ? 0 : (UINT64_MAX >> (i % 64));
+            break;
+        }
+        masks.emplace_back(hi, lo);
+    }
+
+    [[maybe_unused]] const bool bmi2 = intrinsics::cpu().bmi2;
+    for (const auto& mask : masks) {
+        const uint128_t value(gen(), gen());
+        const uint128_t dep = reference_deposit(value, mask);
+        const uint128_t ext = reference_extract(value, mask);
+
+        ASSERT_TEST(parallel_deposit(value, mask) == dep, "parallel_deposit vs referencia");
+        ASSERT_TEST(parallel_extract(value, mask) == ext, "parallel_extract vs referencia");
+        ASSERT_TEST(uint128_bits::detail::pdep128_soft(value, mask) == dep,
+                    "pdep128_soft vs referencia");
+        ASSERT_TEST(uint128_bits::detail::pext128_soft(value, mask) == ext,
+                    "pext128_soft vs referencia");
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+        if (bmi2) {
+            ASSERT_TEST(uint128_bits::detail::pdep128_bmi2(value, mask) == dep,
+                        "pdep128_bmi2 vs referencia");
+            ASSERT_TEST(uint128_bits::detail::pext128_bmi2(value, mask) == ext,
+                        "pext128_bmi2 vs referencia");
+        }
+#endif
+        // Ida y vuelta: recupera los popcount(mask) bits bajos de value
+        const int n = nstd::popcount(mask);
+        const uint128_t low_bits = n == 128 ? ~uint128_t(0) : (uint128_t(1) << n) - uint128_t(1);
+        ASSERT_TEST(parallel_extract(dep, mask) == (value & low_bits),
+                    "parallel_extract(parallel_deposit(v, m), m)");
+    }
+
+    TEST_PASS("test_parallel_deposit_extract_paths");
+    return true;
+}
+
+bool test_rank_select()
+{
+    static_assert(uint128_bits::rank(uint128_t(0xFF), 4) == 4);
+    static_assert(uint128_bits::rank(~uint128_t(0), 100) == 100);
+    static_assert(uint128_bits::rank(uint128_t(0xF0, 0xFF), 128) == 12);
+    static_assert(uint128_bits::rank(~uint128_t(0), 200) == 128);
+    static_assert(uint128_bits::select(uint128_t(1, 0), 0) == 64);
+    static_assert(uint128_bits::select(uint128_t(0xA), 1) == 3);
+    static_assert(uint128_bits::select(uint128_t(0xA), 2) == 128);
+    static_assert(intrinsics::select64_soft(0x8000000000000000ULL, 0) == 63);
+
+    std::mt19937_64 gen(777);
+    for (int iter = 0; iter < 3000; ++iter) {
+        uint64_t hi = gen(), lo = gen();
+        if (iter % 3 == 1) {
+            hi &= gen() & gen();
+            lo &= gen();
+        } else if (iter % 3 == 2) {
+            lo = 0;
+        }
+        const uint128_t value(hi, lo);
+
+        int ones = 0;
+        for (int i = 0; i <= 128; ++i) {
+            ASSERT_TEST(uint128_bits::rank(value, i) == ones, "rank vs recorrido");
+            if (i < 128 && get_bit(value, i)) {
+                ASSERT_TEST(uint128_bits::select(value, ones) == i, "select vs recorrido");
+                const uint64_t half = i < 64 ? value.low() : value.high();
+                const int k = i < 64 ? ones : ones - intrinsics::popcount64(value.low());
+                ASSERT_TEST(intrinsics::select64_soft(half, k) == i % 64, "select64_soft vs recorrido");
+                ++ones;
+            }
+        }
+        ASSERT_TEST(uint128_bits::select(value, ones) == 128, "select fuera de rango");
+        ASSERT_TEST(uint128_bits::select(value, 0) == nstd::countr_zero(value), "select(v, 0)");
+    }
+    ASSERT_TEST(uint128_bits::rank(uint128_t(5), -3) == 0, "rank con posicion negativa");
+    ASSERT_TEST(uint128_bits::select(uint128_t(5), -1) == 128, "select con k negativo");
+
+    TEST_PASS("test_rank_select");
+    return true;
+}
+
 bool test_get_bit()
 {
     uint128_t value(0xFF);
@@ -525,12 +691,15 @@ int main()
 
     all_passed &= test_rotl();
     all_passed &= test_rotr();
+    all_passed &= test_funnel_shift();
     all_passed &= test_reverse_bits();
     all_passed &= test_byteswap();
     all_passed &= test_extract_bits();
     all_passed &= test_insert_bits();
     all_passed &= test_parallel_deposit();
     all_passed &= test_parallel_extract();
+    all_passed &= test_parallel_deposit_extract_paths();
+    all_passed &= test_rank_select();
     all_passed &= test_get_bit();
     all_passed &= test_set_bit();
     all_passed &= test_flip_bit();
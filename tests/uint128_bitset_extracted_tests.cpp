@@ -0,0 +1,267 @@
+/*
+ * Tests extraídos para uint128_bitset.hpp
+ * bitset128_vector frente a std::vector<bool>: acceso por bit, resize y
+ * push_back, operaciones booleanas y and_popcount en todas las rutas SIMD,
+ * recorrido de bits a 1 y conversión palabra a palabra con std::bitset<128>
+ */
+
+#include "../include/uint128/uint128_bitset.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <bitset>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace nstd;
+
+std::mt19937_64 rng(0xb175e7);
+
+// Comprueba bit a bit, count, búsqueda, recorrido y que el relleno es cero
+void check_equal(const bitset128_vector& bs, const std::vector<bool>& ref)
+{
+    assert(bs.size() == ref.size());
+    std::vector<std::size_t> ones;
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        assert(bs[i] == ref[i]);
+        if (ref[i]) {
+            ones.push_back(i);
+        }
+    }
+    assert(bs.count() == ones.size());
+    assert(bs.any() == !ones.empty());
+    assert(bs.all() == (ones.size() == ref.size()));
+
+    std::vector<std::size_t> iterated, visited, found;
+    for (std::size_t i : bs.ones()) {
+        iterated.push_back(i);
+    }
+    bs.for_each_set([&](std::size_t i) { visited.push_back(i); });
+    for (std::size_t i = bs.find_first(); i != bitset128_vector::npos; i = bs.find_next(i)) {
+        found.push_back(i);
+    }
+    assert(iterated == ones);
+    assert(visited == ones);
+    assert(found == ones);
+    assert(bs.find_next(bitset128_vector::npos) == bitset128_vector::npos);
+    assert(bs.to_vector_bool() == ref);
+
+    if (bs.size() % 128 != 0) {
+        const uint128_t& last = bs.word(bs.num_words() - 1);
+        assert((last >> static_cast<int>(bs.size() % 128)) == uint128_t(0));
+    }
+}
+
+std::vector<bool> random_bits(std::size_t n, unsigned density)
+{
+    std::vector<bool> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = rng() % 100 < density;
+    }
+    return v;
+}
+
+// =============================================================================
+// TEST: acceso por bit, resize y push_back
+// =============================================================================
+bool test_bit_access()
+{
+    std::cout << "\n=== TEST: set / reset / flip / resize / push_back ===\n";
+
+    bitset128_vector bs;
+    std::vector<bool> ref;
+    check_equal(bs, ref);
+    assert(bs.find_first() == bitset128_vector::npos);
+
+    for (int step = 0; step < 4000; ++step) {
+        const unsigned op = static_cast<unsigned>(rng() % 8);
+        if (op == 0 || ref.empty()) {
+            const bool v = rng() & 1;
+            bs.push_back(v);
+            ref.push_back(v);
+            continue;
+        }
+        const std::size_t i = rng() % ref.size();
+        switch (op) {
+        case 1:
+            bs.set(i);
+            ref[i] = true;
+            break;
+        case 2:
+            bs.reset(i);
+            ref[i] = false;
+            break;
+        case 3:
+            bs.flip(i);
+            ref[i] = !ref[i];
+            break;
+        case 4:
+            if (rng() % 16 == 0) {
+                const std::size_t n = rng() % 700;
+                const bool v = rng() & 1;
+                bs.resize(n, v);
+                ref.resize(n, v);
+            }
+            break;
+        default:
+            bs.set(i, (rng() & 1) != 0);
+            ref[i] = bs[i];
+            break;
+        }
+        if (step % 97 == 0) {
+            check_equal(bs, ref);
+        }
+    }
+    check_equal(bs, ref);
+
+    // Alineación de 64 bytes y construcción a partir de vector<bool> y palabras
+    assert(reinterpret_cast<std::uintptr_t>(bs.words().data()) % 64 == 0);
+    const auto v = random_bits(333, 30);
+    const bitset128_vector from_bools(v);
+    check_equal(from_bools, v);
+    const bitset128_vector from_words(from_bools.words(), 300);
+    check_equal(from_words, std::vector<bool>(v.begin(), v.begin() + 300));
+    bool threw = false;
+    try {
+        bitset128_vector(from_bools.words(), 3 * 128 + 1);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    bitset128_vector full(200, true);
+    check_equal(full, std::vector<bool>(200, true));
+    full.flip();
+    check_equal(full, std::vector<bool>(200, false));
+    full.set();
+    full.resize(130);
+    full.resize(250);
+    std::vector<bool> expect(250, false);
+    std::fill(expect.begin(), expect.begin() + 130, true);
+    check_equal(full, expect);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: operaciones booleanas y and_popcount en cada ruta
+// =============================================================================
+bool test_boolean_ops()
+{
+    std::cout << "\n=== TEST: &, |, ^, and_not, ~, and_popcount ===\n";
+
+    for (auto level : {intrinsics::simd_level::scalar, intrinsics::simd_level::avx2,
+                       intrinsics::simd_level::avx512}) {
+        if (static_cast<int>(level) > static_cast<int>(intrinsics::best_simd_level())) {
+            continue;
+        }
+        intrinsics::force_simd_level(level);
+        for (std::size_t n : {0u, 1u, 127u, 128u, 129u, 1000u, 4096u + 77u, 20000u}) {
+            const auto ra = random_bits(n, 50);
+            const auto rb = random_bits(n, 20);
+            const bitset128_vector a(ra), b(rb);
+
+            std::vector<bool> r_and(n), r_or(n), r_xor(n), r_andnot(n), r_not(n);
+            std::size_t common = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                r_and[i] = ra[i] && rb[i];
+                r_or[i] = ra[i] || rb[i];
+                r_xor[i] = ra[i] != rb[i];
+                r_andnot[i] = ra[i] && !rb[i];
+                r_not[i] = !ra[i];
+                common += r_and[i] ? 1 : 0;
+            }
+            check_equal(a & b, r_and);
+            check_equal(a | b, r_or);
+            check_equal(a ^ b, r_xor);
+            check_equal(bitset128_vector(a).and_not(b), r_andnot);
+            check_equal(~a, r_not);
+            assert(and_popcount(a, b) == common);
+            assert((a & b) == bitset128_vector(r_and));
+        }
+    }
+    intrinsics::reset_simd_level();
+
+    bitset128_vector a(100), b(101);
+    bool threw = false;
+    try {
+        a &= b;
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: conversión con std::bitset<128>
+// =============================================================================
+bool test_bitset_conversion()
+{
+    std::cout << "\n=== TEST: to_bitset / from_bitset / bitset_word ===\n";
+
+    for (int i = 0; i < 1000; ++i) {
+        const uint128_t x(rng(), rng());
+        const std::bitset<128> b = to_bitset(x);
+        for (int k = 0; k < 128; ++k) {
+            assert(b[static_cast<std::size_t>(k)] == (((x >> k) & uint128_t(1)) == uint128_t(1)));
+        }
+        assert(from_bitset(b) == x);
+    }
+
+    std::bitset<64> small(0x8000000000000001ULL);
+    assert(from_bitset(small) == uint128_t(0, 0x8000000000000001ULL));
+    std::bitset<100> mid;
+    mid.set(0);
+    mid.set(63);
+    mid.set(64);
+    mid.set(99);
+    assert(from_bitset(mid) == uint128_t((uint64_t(1) << 35) | 1, 0x8000000000000001ULL));
+
+    // set_word descarta los bits por encima de size()
+    bitset128_vector bs(200);
+    bs.set_word(1, std::bitset<128>().set());
+    assert(bs.count() == 72);
+    assert(bs.bitset_word(1).count() == 72);
+    assert(bs.bitset_word(0).none());
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_bitset.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_bit_access);
+    RUN_TEST(test_boolean_ops);
+    RUN_TEST(test_bitset_conversion);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
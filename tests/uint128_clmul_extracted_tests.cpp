@@ -0,0 +1,250 @@
+/*
+ * Tests extraídos para uint128_clmul.hpp
+ * clmul/clmul_wide frente a un producto bit a bit, gf2_128 frente al
+ * algoritmo de referencia de la especificación de GCM (y un vector de
+ * prueba de GHASH), propiedades de cuerpo, y crc64 con el valor de control
+ * de CRC-64/XZ y todas las rutas de plegado
+ */
+
+#include "../include/uint128/uint128_clmul.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+using namespace nstd;
+
+// Producto sin acarreo bit a bit
+clmul_product reference_clmul(const uint128_t& a, const uint128_t& b)
+{
+    clmul_product r{uint128_t(0), uint128_t(0)};
+    for (int i = 0; i < 128; ++i) {
+        if (((b >> i) & uint128_t(1)) != uint128_t(0)) {
+            r.low ^= a << i;
+            if (i != 0) {
+                r.high ^= a >> (128 - i);
+            }
+        }
+    }
+    return r;
+}
+
+// Algoritmo 1 de la especificación de GCM sobre bloques big-endian
+uint128_t reference_gcm_mul(const uint128_t& x, const uint128_t& y)
+{
+    const uint128_t r(0xE100000000000000ULL, 0);
+    uint128_t z(0);
+    uint128_t v = y;
+    for (int i = 127; i >= 0; --i) {
+        if (((x >> i) & uint128_t(1)) != uint128_t(0)) {
+            z ^= v;
+        }
+        const bool lsb = (v & uint128_t(1)) != uint128_t(0);
+        v >>= 1;
+        if (lsb) {
+            v ^= r;
+        }
+    }
+    return z;
+}
+
+// CRC-64/XZ bit a bit
+uint64_t reference_crc64(const std::vector<std::byte>& data)
+{
+    uint64_t crc = ~uint64_t(0);
+    for (std::byte b : data) {
+        crc ^= static_cast<uint64_t>(b);
+        for (int k = 0; k < 8; ++k) {
+            crc = (crc >> 1) ^ ((crc & 1) != 0 ? 0xC96C5795D7870F42ULL : 0);
+        }
+    }
+    return ~crc;
+}
+
+// =============================================================================
+// TEST: clmul y clmul_wide
+// =============================================================================
+bool test_clmul()
+{
+    std::cout << "\n=== TEST: clmul / clmul_wide frente a la referencia ===\n";
+
+    static_assert(clmul(3, 3) == uint128_t(5));
+    static_assert(clmul(~uint64_t(0), 2) == uint128_t(1, ~uint64_t(0) << 1));
+    static_assert(clmul_wide(uint128_t(1, 0), uint128_t(1, 0)) ==
+                  clmul_product{uint128_t(1), uint128_t(0)});
+
+    std::mt19937_64 gen(43);
+    for (int i = 0; i < 5000; ++i) {
+        const uint128_t a(gen(), gen());
+        const uint128_t b(gen(), gen());
+        const clmul_product expected = reference_clmul(a, b);
+        assert(clmul_wide(a, b) == expected);
+        assert(detail::clmul128_soft(a, b) == expected);
+        assert(clmul(a.low(), b.low()) == reference_clmul(uint128_t(a.low()), uint128_t(b.low())).low);
+        assert(detail::clmul64_soft(a.high(), b.low()) ==
+               reference_clmul(uint128_t(a.high()), uint128_t(b.low())).low);
+        assert(detail::clsquare128_soft(a) == reference_clmul(a, a));
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: gf2_128
+// =============================================================================
+bool test_gf2_128()
+{
+    std::cout << "\n=== TEST: gf2_128 (GCM) ===\n";
+
+    constexpr gf2_128 x(uint128_t(2));
+    static_assert((x.pow(uint128_t(128))) == gf2_128(uint128_t(0x87)));
+    static_assert(x * x.inverse() == gf2_128::one());
+
+    // GHASH del caso de prueba 2 de GCM: H, un bloque cifrado y las longitudes
+    const uint128_t h(0x66e94bd4ef8a2c3bULL, 0x884cfa59ca342b2eULL);
+    const uint128_t c(0x0388dace60b6a392ULL, 0xf328c2b971b2fe78ULL);
+    const uint128_t lengths(0, 0x80);
+    const gf2_128 key = gf2_128::from_gcm(h);
+    gf2_128 y;
+    y = (y + gf2_128::from_gcm(c)) * key;
+    y = (y + gf2_128::from_gcm(lengths)) * key;
+    assert(y.to_gcm() == uint128_t(0xf38cbb1ad69223dcULL, 0xc3457ae5b6b0f885ULL));
+
+    std::mt19937_64 gen(44);
+    for (int i = 0; i < 2000; ++i) {
+        const uint128_t u(gen(), gen());
+        const uint128_t v(gen(), gen());
+        const gf2_128 a = gf2_128::from_gcm(u);
+        const gf2_128 b = gf2_128::from_gcm(v);
+        assert(gf2_128::from_gcm(u).to_gcm() == u);
+        assert((a * b).to_gcm() == reference_gcm_mul(u, v));
+        assert(a.square() == a * a);
+        assert(a * b == b * a);
+        if (!a.is_zero()) {
+            assert(a * a.inverse() == gf2_128::one());
+            assert((b / a) * a == b);
+        }
+        if (i < 50) {
+            const uint128_t e(gen() % 4, gen());
+            gf2_128 expected = gf2_128::one();
+            for (uint128_t k(0); k < (e & uint128_t(0xFF)); k += uint128_t(1)) {
+                expected *= a;
+            }
+            assert(a.pow(e & uint128_t(0xFF)) == expected);
+            assert(a.pow(uint128_t(0)) == gf2_128::one());
+            // Pequeño teorema de Fermat: a^(2^128) = a
+            assert(a.square_n(128) == a);
+        }
+    }
+
+    bool threw = false;
+    try {
+        (void)gf2_128::zero().inverse();
+    } catch (const std::domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: crc64
+// =============================================================================
+bool test_crc64()
+{
+    std::cout << "\n=== TEST: crc64 (CRC-64/XZ) ===\n";
+
+    constexpr std::string_view check = "123456789";
+    constexpr auto check_array = [check] {
+        std::array<std::byte, 9> a{};
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            a[i] = static_cast<std::byte>(check[i]);
+        }
+        return a;
+    }();
+    static_assert(crc64(std::span<const std::byte>(check_array)) == 0x995DC9BBDF1939FAULL);
+    const auto check_bytes = std::as_bytes(std::span<const char>(check.data(), check.size()));
+    assert(crc64(check_bytes) == 0x995DC9BBDF1939FAULL);
+
+    std::mt19937_64 gen(45);
+    std::vector<std::byte> buffer(5000);
+    for (auto& b : buffer) {
+        b = static_cast<std::byte>(gen());
+    }
+
+    // Longitudes y desplazamientos que cubren las rutas de tablas, PCLMULQDQ y VPCLMULQDQ
+    for (std::size_t offset = 0; offset < 16; offset += 5) {
+        for (std::size_t len = 0; len + offset <= 1200; len += len < 300 ? 1 : 37) {
+            const std::vector<std::byte> slice(buffer.begin() + static_cast<std::ptrdiff_t>(offset),
+                                               buffer.begin() + static_cast<std::ptrdiff_t>(offset + len));
+            const uint64_t expected = reference_crc64(slice);
+            const std::span<const std::byte> s(buffer.data() + offset, len);
+            assert(crc64(s) == expected);
+            assert(~detail::crc64_update_soft(~uint64_t(0), s.data(), s.size()) == expected);
+            // Encadenado en dos tramos
+            const std::size_t cut = len / 3;
+            assert(crc64(s.subspan(cut), crc64(s.first(cut))) == expected);
+        }
+    }
+
+    // Bloques de 128 bits
+    std::vector<uint128_t> blocks(300);
+    for (auto& b : blocks) {
+        b = uint128_t(gen(), gen());
+    }
+    std::vector<std::byte> block_bytes(blocks.size() * 16);
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        for (int k = 0; k < 8; ++k) {
+            block_bytes[16 * i + k] = static_cast<std::byte>(blocks[i].low() >> (8 * k));
+            block_bytes[16 * i + 8 + k] = static_cast<std::byte>(blocks[i].high() >> (8 * k));
+        }
+    }
+    assert(crc64(std::span<const uint128_t>(blocks)) == reference_crc64(block_bytes));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_clmul.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+    std::cout << "pclmul=" << intrinsics::cpu().pclmul << " vpclmulqdq=" << intrinsics::cpu().vpclmulqdq
+              << "\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_clmul);
+    RUN_TEST(test_gf2_128);
+    RUN_TEST(test_crc64);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
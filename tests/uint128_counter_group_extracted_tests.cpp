@@ -0,0 +1,133 @@
+/*
+ * Tests extraídos para uint128_counter_group.hpp
+ * counter_group128: incrementos sueltos y en grupo, desbordamiento módulo
+ * 2^128, instantáneas consistentes con escritores concurrentes y variante
+ * con signo
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/uint128/uint128_counter_group.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// TEST: un solo hilo
+// =============================================================================
+bool test_single_thread()
+{
+    std::cout << "\n=== TEST: add/snapshot en un hilo ===\n";
+
+    uint128_counter_group<4> g(3);
+    assert(g.size() == 4 && g.slot_count() == 4);
+    assert(g.snapshot() == (std::array<uint128_t, 4>{}));
+
+    g.add(0, uint128_t(0, ~0ull));
+    g.increment(0);
+    g.add({{1, uint128_t(5)}, {3, uint128_t(7)}});
+    auto s = g.snapshot();
+    assert(s[0] == uint128_t(1, 0) && s[1] == uint128_t(5) && s[2] == uint128_t(0) &&
+           s[3] == uint128_t(7));
+
+    // Los incrementos posteriores se acumulan sobre la instantánea anterior
+    const std::array<uint128_t, 4> deltas{uint128_t(1), uint128_t(0), uint128_t(2), uint128_t(0)};
+    g.add(std::span<const uint128_t, 4>(deltas));
+    g.sub(3, uint128_t(8));
+    s = g.snapshot();
+    assert(s[0] == uint128_t(1, 1) && s[2] == uint128_t(2) && s[3] == ~uint128_t(0));
+    assert(g.snapshot() == s); // Sin escrituras, dos instantáneas iguales
+
+    g.reset();
+    assert(g.snapshot() == (std::array<uint128_t, 4>{}));
+
+    int128_counter_group<2> signed_group;
+    signed_group.add({{0, int128_t(-10)}, {1, int128_t(10)}});
+    signed_group.increment(0);
+    const auto t = signed_group.snapshot();
+    assert(t[0] == int128_t(-9) && t[1] == int128_t(10));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: instantáneas consistentes con escritores concurrentes
+// =============================================================================
+bool test_consistent_snapshot()
+{
+    std::cout << "\n=== TEST: instantáneas consistentes ===\n";
+
+    // Cada escritor suma lo mismo a "peticiones" y a "respuestas" en un solo
+    // add(), y 1000 veces más a "bytes": toda instantánea debe cuadrar
+    constexpr int writers = 4;
+    constexpr int iterations = 20000;
+    counter_group128<3> g(2); // Menos ranuras que hilos: ranuras compartidas
+    std::atomic<int> done{0};
+    std::vector<std::thread> pool;
+    for (int t = 0; t < writers; ++t) {
+        pool.emplace_back([&] {
+            for (int i = 0; i < iterations; ++i) {
+                g.add({{0, uint128_t(1)}, {1, uint128_t(1)}, {2, uint128_t(1000)}});
+            }
+            done.fetch_add(1);
+        });
+    }
+
+    uint128_t previous(0);
+    int snapshots = 0;
+    while (done.load() < writers) {
+        const auto s = g.snapshot();
+        assert(s[0] == s[1] && s[2] == s[0] * uint128_t(1000));
+        assert(s[0] >= previous);
+        previous = s[0];
+        ++snapshots;
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    const auto s = g.snapshot();
+    assert(s[0] == uint128_t(writers * iterations) && s[1] == s[0]);
+    assert(s[2] == uint128_t(1000ull * writers * iterations));
+    std::cout << "  Instantáneas tomadas: " << snapshots << "\n";
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_counter_group.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_single_thread);
+    RUN_TEST(test_consistent_snapshot);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
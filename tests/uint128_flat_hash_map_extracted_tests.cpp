@@ -0,0 +1,399 @@
+/*
+ * Tests extraídos para uint128_flat_hash_map.hpp
+ * Pruebas del hash de 128 bits y de nstd::flat_hash_map
+ */
+
+// [WARN] CRITICAL: Include traits specializations BEFORE any other header
+// that might include <type_traits>
+#include "../include/uint128/uint128_traits_specializations.hpp"
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/int128/int128_traits.hpp"
+#include "../include/uint128/uint128_flat_hash_map.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_traits.hpp"
+#include <cassert>
+#include <initializer_list>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// TEST: hash128 - distribución en claves estructuradas
+// =============================================================================
+bool test_hash_no_structured_collisions()
+{
+    std::cout << "\n=== TEST: hash128 sin colisiones en claves estructuradas ===\n";
+
+    std::hash<uint128_t> hasher;
+    std::unordered_set<size_t> seen;
+
+    // Patrones que colisionaban con high ^ low: (k, k), (0, k) vs (k, 0), IPv6 /64
+    const uint64_t ipv6_prefix = 0x20010db800000000ULL;
+    for (uint64_t k = 0; k < 4096; ++k) {
+        seen.insert(hasher(uint128_t(k, k)));
+        seen.insert(hasher(uint128_t(0, k + 1)));
+        seen.insert(hasher(uint128_t(k + 1, 0)));
+        seen.insert(hasher(uint128_t(ipv6_prefix, k)));
+        seen.insert(hasher(uint128_t(ipv6_prefix + k + 1, 0)));
+    }
+
+    std::cout << "  " << seen.size() << " hashes distintos de " << 5 * 4096 << " claves\n";
+    assert(seen.size() == 5 * 4096 && "No debe haber colisiones en claves estructuradas");
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: hash128 - efecto avalancha
+// =============================================================================
+bool test_hash_avalanche()
+{
+    std::cout << "\n=== TEST: hash128 avalancha (1 bit de entrada) ===\n";
+
+    std::mt19937_64 rng(12345);
+    uint64_t total_flips = 0;
+    uint64_t samples = 0;
+
+    for (int trial = 0; trial < 64; ++trial) {
+        const uint128_t key(rng(), rng());
+        const uint64_t base = hash128(key.high(), key.low());
+        for (int bit = 0; bit < 128; ++bit) {
+            const uint128_t flipped = key ^ (uint128_t(1) << bit);
+            const uint64_t h = hash128(flipped.high(), flipped.low());
+            total_flips += static_cast<uint64_t>(intrinsics::popcount64(base ^ h));
+            ++samples;
+        }
+    }
+
+    const double avg = static_cast<double>(total_flips) / static_cast<double>(samples);
+    std::cout << "  Bits de salida cambiados por bit de entrada: " << avg << " (ideal 32)\n";
+    assert(avg > 30.0 && avg < 34.0 && "Cada bit de entrada debe cambiar ~la mitad de la salida");
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: hash128 - producto intermedio nulo
+// =============================================================================
+bool test_hash_zero_product()
+{
+    std::cout << "\n=== TEST: hash128 con producto intermedio nulo ===\n";
+
+    // low == secret1 anula el producto de las dos mitades: high debe seguir contando
+    std::unordered_set<uint64_t> seen;
+    const std::initializer_list<uint64_t> highs = {0, 1, 2, ~uint64_t(0), 0x20010db800000000ULL};
+    for (uint64_t high : highs) {
+        seen.insert(hash128(high, hash_detail::secret1));
+    }
+    assert(seen.size() == 5 && "high debe afectar al hash aunque low == secret1");
+
+    // Caso simétrico: high igual a la semilla derivada (seed = 0)
+    const uint64_t s = hash_detail::mix(hash_detail::secret0, hash_detail::secret1);
+    seen.clear();
+    const std::initializer_list<uint64_t> lows = {0, 1, 2, ~uint64_t(0), hash_detail::secret1};
+    for (uint64_t low : lows) {
+        seen.insert(hash128(s, low));
+    }
+    assert(seen.size() == 5 && "low debe afectar al hash aunque high anule el producto");
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: hash128 - constexpr y semilla
+// =============================================================================
+bool test_hash_constexpr_and_seed()
+{
+    std::cout << "\n=== TEST: hash128 constexpr y semilla ===\n";
+
+    constexpr uint64_t h0 = hash128(0, 42);
+    static_assert(h0 == hash128(0, 42));
+    static_assert(hash128(0, 42) != hash128(42, 0));
+    static_assert(hash128(0, 42, 1) != hash128(0, 42, 2));
+
+    assert(nstd::hash<uint128_t>{}(uint128_t(0, 42)) == static_cast<size_t>(h0));
+    assert(std::hash<uint128_t>{}(uint128_t(0, 42)) == static_cast<size_t>(h0));
+    assert(std::hash<int128_t>{}(int128_t(0, 42)) == static_cast<size_t>(h0));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: std::unordered_map sin hash explícito
+// =============================================================================
+bool test_std_unordered_map()
+{
+    std::cout << "\n=== TEST: std::unordered_map<uint128_t, int> ===\n";
+
+    std::unordered_map<uint128_t, int> map;
+    for (int i = 0; i < 1000; ++i) {
+        map[uint128_t(static_cast<uint64_t>(i), static_cast<uint64_t>(i))] = i;
+    }
+    assert(map.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        assert(map.at(uint128_t(static_cast<uint64_t>(i), static_cast<uint64_t>(i))) == i);
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: flat_hash_map - operaciones básicas
+// =============================================================================
+bool test_flat_map_basic()
+{
+    std::cout << "\n=== TEST: flat_hash_map insert/find/at/operator[] ===\n";
+
+    flat_hash_map<uint128_t, int> map;
+    assert(map.empty());
+    assert(map.find(uint128_t(1)) == map.end());
+
+    auto [it, inserted] = map.insert({uint128_t(1, 2), 10});
+    assert(inserted && it->first == uint128_t(1, 2) && it->second == 10);
+
+    auto [it2, inserted2] = map.insert({uint128_t(1, 2), 99});
+    assert(!inserted2 && it2->second == 10 && "insert no sobrescribe");
+
+    map.insert_or_assign(uint128_t(1, 2), 11);
+    assert(map.at(uint128_t(1, 2)) == 11);
+
+    map[uint128_t(2, 1)] += 5;
+    assert(map[uint128_t(2, 1)] == 5);
+    assert(map.size() == 2);
+    assert(map.contains(uint128_t(2, 1)));
+    assert(map.count(uint128_t(3)) == 0);
+
+    bool thrown = false;
+    try {
+        (void)map.at(uint128_t(3));
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown && "at() debe lanzar std::out_of_range");
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: flat_hash_map - crecimiento y rehash
+// =============================================================================
+bool test_flat_map_growth()
+{
+    std::cout << "\n=== TEST: flat_hash_map crecimiento ===\n";
+
+    flat_hash_map<uint128_t, uint64_t> map;
+    const uint64_t n = 100000;
+    for (uint64_t i = 0; i < n; ++i) {
+        map[uint128_t(i >> 3, i * 0x9E3779B97F4A7C15ULL)] = i;
+    }
+    assert(map.size() == n);
+    assert(map.load_factor() <= map.max_load_factor());
+    for (uint64_t i = 0; i < n; ++i) {
+        auto it = map.find(uint128_t(i >> 3, i * 0x9E3779B97F4A7C15ULL));
+        assert(it != map.end() && it->second == i);
+    }
+    assert(!map.contains(uint128_t(n, 0)));
+
+    std::cout << "  " << n << " elementos, capacidad " << map.capacity() << "\n";
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: flat_hash_map - clave que apunta dentro del propio mapa
+// =============================================================================
+// Llena la tabla hasta growth_left_ == 0: la siguiente inserción rehace
+static void fill_to_growth_limit(flat_hash_map<uint128_t, uint128_t>& map)
+{
+    for (uint64_t i = 0; map.size() < map.capacity() - map.capacity() / 8 || map.empty(); ++i) {
+        map[uint128_t(i)] = uint128_t(1, i); // Valores que no son claves
+    }
+}
+
+bool test_flat_map_aliased_key()
+{
+    std::cout << "
+=== TEST: flat_hash_map clave con alias durante el rehash ===
+";
+
+    for (int op = 0; op < 3; ++op) {
+        flat_hash_map<uint128_t, uint128_t> map;
+        fill_to_growth_limit(map);
+        const size_t n = map.size();
+        const size_t cap = map.capacity();
+        const auto& alias = map.find(uint128_t(0))->second; // Vive en slots_
+        const uint128_t key = alias;
+
+        if (op == 0) {
+            map[alias] = uint128_t(7);
+        } else if (op == 1) {
+            assert(map.try_emplace(alias, uint128_t(7)).second);
+        } else {
+            assert(map.insert_or_assign(alias, uint128_t(7)).second);
+        }
+        assert(map.capacity() > cap && "La inserción debe haber rehecho la tabla");
+        assert(map.size() == n + 1);
+        auto it = map.find(key);
+        assert(it != map.end() && it->first == key && it->second == uint128_t(7));
+        assert(map.at(uint128_t(0)) == key);
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: flat_hash_map - erase y tumbas
+// =============================================================================
+bool test_flat_map_erase()
+{
+    std::cout << "\n=== TEST: flat_hash_map erase ===\n";
+
+    flat_hash_map<uint128_t, int> map;
+    for (int i = 0; i < 1000; ++i) {
+        map[uint128_t(static_cast<uint64_t>(i))] = i;
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        assert(map.erase(uint128_t(static_cast<uint64_t>(i))) == 1);
+    }
+    assert(map.erase(uint128_t(0)) == 0);
+    assert(map.size() == 500);
+    for (int i = 0; i < 1000; ++i) {
+        assert(map.contains(uint128_t(static_cast<uint64_t>(i))) == (i % 2 == 1));
+    }
+
+    // Ciclos insertar/borrar: las tumbas no deben hacer crecer la tabla sin límite
+    const size_t cap = map.capacity();
+    for (uint64_t round = 0; round < 20; ++round) {
+        for (uint64_t i = 0; i < 500; ++i) {
+            map[uint128_t(round + 1, i)] = 1;
+        }
+        for (uint64_t i = 0; i < 500; ++i) {
+            map.erase(uint128_t(round + 1, i));
+        }
+    }
+    assert(map.size() == 500);
+    assert(map.capacity() <= 2 * cap && "Los rehash deben limpiar tumbas");
+
+    // erase(iterator) recorriendo la tabla
+    for (auto it = map.begin(); it != map.end();) {
+        if (it->second % 3 == 0) {
+            it = map.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (const auto& [k, v] : map) {
+        assert(v % 3 != 0);
+        (void)k;
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: flat_hash_map - iteración, copia y movimiento
+// =============================================================================
+bool test_flat_map_copy_move()
+{
+    std::cout << "\n=== TEST: flat_hash_map iteración/copia/movimiento ===\n";
+
+    flat_hash_map<uint128_t, std::string> map;
+    for (uint64_t i = 0; i < 200; ++i) {
+        map.try_emplace(uint128_t(i, ~i), std::to_string(i));
+    }
+
+    size_t visited = 0;
+    for (const auto& [key, value] : map) {
+        assert(value == std::to_string(key.high()));
+        ++visited;
+    }
+    assert(visited == map.size());
+
+    flat_hash_map<uint128_t, std::string> copy = map;
+    assert(copy.size() == 200 && copy.at(uint128_t(7, ~uint64_t(7))) == "7");
+
+    flat_hash_map<uint128_t, std::string> moved = std::move(copy);
+    assert(moved.size() == 200 && copy.empty());
+
+    moved.clear();
+    assert(moved.empty() && !moved.contains(uint128_t(7, ~uint64_t(7))));
+    assert(map.size() == 200 && "La copia es independiente");
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: flat_hash_map con int128_t
+// =============================================================================
+bool test_flat_map_int128()
+{
+    std::cout << "\n=== TEST: flat_hash_map<int128_t, int> ===\n";
+
+    flat_hash_map<int128_t, int> map;
+    for (int i = -1000; i < 1000; ++i) {
+        map[int128_t(i)] = i;
+    }
+    assert(map.size() == 2000);
+    for (int i = -1000; i < 1000; ++i) {
+        assert(map.at(int128_t(i)) == i);
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_flat_hash_map.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    // Tests del hash
+    RUN_TEST(test_hash_no_structured_collisions);
+    RUN_TEST(test_hash_avalanche);
+    RUN_TEST(test_hash_zero_product);
+    RUN_TEST(test_hash_constexpr_and_seed);
+    RUN_TEST(test_std_unordered_map);
+
+    // Tests de flat_hash_map
+    RUN_TEST(test_flat_map_basic);
+    RUN_TEST(test_flat_map_growth);
+    RUN_TEST(test_flat_map_aliased_key);
+    RUN_TEST(test_flat_map_erase);
+    RUN_TEST(test_flat_map_copy_move);
+    RUN_TEST(test_flat_map_int128);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
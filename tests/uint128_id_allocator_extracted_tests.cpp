@@ -0,0 +1,199 @@
+/*
+ * Tests extraídos para uint128_id_allocator.hpp
+ * id_allocator128: reserva por bloques, reparto nodo/secuencia, detección de
+ * agotamiento sin vuelta a 0, validación de opciones y unicidad con varios
+ * hilos (incluidos más hilos que ranuras de bloque)
+ */
+
+#include "../include/uint128/uint128_id_allocator.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// TEST: un solo hilo
+// =============================================================================
+bool test_single_thread()
+{
+    std::cout << "\n=== TEST: bloques y monotonía en un hilo ===\n";
+
+    id_allocator128 ids({.block_size = 4});
+    assert(ids.block_size() == 4 && ids.sequence_bits() == 128);
+    for (uint64_t i = 0; i < 10; ++i) {
+        assert(ids.next() == uint128_t(i));
+    }
+    assert(ids.high_water() == uint128_t(12)); // Tres bloques de 4
+
+    // reserve() no toca el bloque del hilo
+    const id_block b = ids.reserve(5);
+    assert(b.count == 5 && b.first == uint128_t(12) && b[4] == uint128_t(16));
+    assert(ids.next() == uint128_t(10));
+    assert(ids.next() == uint128_t(11));
+    assert(ids.next() == uint128_t(17));
+
+    id_allocator128 resumed({.block_size = 4, .first_sequence = ids.high_water()});
+    assert(resumed.next() == uint128_t(21));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: nodo en bits altos, secuencia en bits bajos
+// =============================================================================
+bool test_node_split()
+{
+    std::cout << "\n=== TEST: reparto nodo / secuencia ===\n";
+
+    id_allocator128 ids({.block_size = 16, .sequence_bits = 64, .node_id = 0xABCD});
+    const uint128_t id = ids.next();
+    assert(id == uint128_t(0xABCD, 0));
+    assert(ids.node_of(id) == uint128_t(0xABCD) && ids.sequence_of(id) == uint128_t(0));
+    assert(ids.node_of(ids.next()) == uint128_t(0xABCD));
+
+    id_allocator128 wide({.sequence_bits = 100, .node_id = uint128_t((1u << 28) - 1)});
+    assert(wide.node_of(wide.next()) == uint128_t((1u << 28) - 1));
+
+    bool thrown = false;
+    try {
+        id_allocator128 bad({.sequence_bits = 100, .node_id = uint128_t(1u << 28)});
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        id_allocator128 bad({.sequence_bits = 128, .node_id = uint128_t(1)});
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        id_allocator128 bad({.block_size = 0});
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: agotamiento del espacio de secuencias
+// =============================================================================
+bool test_exhaustion()
+{
+    std::cout << "\n=== TEST: detección de agotamiento ===\n";
+
+    // 4 bits de secuencia: se entregan 0..14, el 15 marca el final
+    id_allocator128 ids({.block_size = 4, .sequence_bits = 4, .node_id = 3});
+    std::vector<uint128_t> seen;
+    while (auto id = ids.try_next()) {
+        seen.push_back(*id);
+    }
+    assert(seen.size() == 15 && ids.exhausted() && ids.remaining() == uint128_t(0));
+    for (uint64_t i = 0; i < 15; ++i) {
+        assert(seen[i] == uint128_t((3u << 4) | i));
+    }
+    assert(ids.reserve(1).empty());
+    bool thrown = false;
+    try {
+        ids.next();
+    } catch (const std::overflow_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // Bloque parcial al final, también con 128 bits de secuencia
+    id_allocator128 full({.first_sequence = ~uint128_t(0) - uint128_t(3)});
+    const id_block tail = full.reserve(10);
+    assert(tail.count == 3 && tail.first == ~uint128_t(0) - uint128_t(3));
+    assert(full.exhausted() && !full.try_next());
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: unicidad con varios hilos
+// =============================================================================
+bool test_concurrent()
+{
+    std::cout << "\n=== TEST: unicidad concurrente ===\n";
+
+    constexpr int threads = 8;
+    constexpr int per_thread = 5000;
+    // Sólo 3 ranuras: el resto de hilos reserva de uno en uno
+    id_allocator128 ids({.block_size = 64, .sequence_bits = 80, .node_id = 5,
+                         .cached_threads = 3});
+    std::vector<std::vector<uint128_t>> produced(threads);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            produced[t].reserve(per_thread);
+            for (int i = 0; i < per_thread; ++i) {
+                produced[t].push_back(ids.next());
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+
+    std::set<uint128_t> all;
+    for (const auto& v : produced) {
+        assert(std::is_sorted(v.begin(), v.end()));
+        assert(std::adjacent_find(v.begin(), v.end()) == v.end());
+        for (const auto& id : v) {
+            assert(ids.node_of(id) == uint128_t(5));
+            all.insert(id);
+        }
+    }
+    assert(all.size() == static_cast<std::size_t>(threads * per_thread));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_id_allocator.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_single_thread);
+    RUN_TEST(test_node_split);
+    RUN_TEST(test_exhaustion);
+    RUN_TEST(test_concurrent);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,322 @@
+/*
+ * Tests extraídos para uint128_mersenne.hpp
+ * mersenne_mod<P> frente a aritmética modular de referencia con __int128
+ * para exponentes pequeños, medianos, 61, 64, 89 y 127; reducción de
+ * valores arbitrarios, rotaciones, potencias e inversos; lucas_lehmer(p)
+ * frente a la lista de primos de Mersenne; polynomial_hash frente a Horner
+ * directo y rolling_hash frente a polynomial_hash de cada ventana
+ */
+
+#include "../include/uint128/uint128_mersenne.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nstd;
+
+// Evaluables en compilación
+static_assert(lucas_lehmer(61) && lucas_lehmer(127) && !lucas_lehmer(67));
+static_assert(mersenne127::is_prime && mersenne61::is_prime && !mersenne_mod<11>::is_prime);
+static_assert((mersenne_mod<7>(uint128_t(100)) * mersenne_mod<7>(uint128_t(3))).value() ==
+              uint128_t(300 % 127));
+static_assert(mersenne127(~uint128_t(0)).value() == uint128_t(1));
+
+#ifdef __SIZEOF_INT128__
+
+__extension__ typedef unsigned __int128 u128;
+
+u128 to_u128(const uint128_t& v)
+{
+    return (static_cast<u128>(v.high()) << 64) | v.low();
+}
+
+uint128_t from_u128(u128 v)
+{
+    return uint128_t(static_cast<uint64_t>(v >> 64), static_cast<uint64_t>(v));
+}
+
+// a * b mod m por duplicaciones y sumas: m < 2^127, así que 2r no desborda
+u128 mulmod_reference(u128 a, u128 b, u128 m)
+{
+    u128 r = 0;
+    for (int bit = 127; bit >= 0; --bit) {
+        r = (r << 1) % m;
+        if ((b >> bit) & 1) {
+            r = (r + a) % m;
+        }
+    }
+    return r;
+}
+
+// =============================================================================
+// TEST: aritmética frente a la referencia
+// =============================================================================
+
+template <unsigned P> void check_arithmetic(std::mt19937_64& rng)
+{
+    using field = mersenne_mod<P>;
+    const u128 m = to_u128(field::modulus());
+    assert(m == (static_cast<u128>(1) << P) - 1);
+
+    auto random_below_m = [&] {
+        const u128 x = (static_cast<u128>(rng()) << 64) | rng();
+        return x % m;
+    };
+    std::vector<u128> values = {0, 1, 2, m - 1, m - 2, m / 2, m / 2 + 1};
+    for (int i = 0; i < 200; ++i) {
+        values.push_back(random_below_m());
+    }
+
+    for (u128 a : values) {
+        const field fa(from_u128(a));
+        assert(to_u128(fa.value()) == a);
+        assert(to_u128((-fa).value()) == (m - a) % m);
+        assert(to_u128(fa.square().value()) == mulmod_reference(a, a, m));
+        for (unsigned k : {0u, 1u, P / 2, P - 1, P, P + 3}) {
+            const u128 pow2 = (static_cast<u128>(1) << (k % P)) % m;
+            assert(to_u128(fa.mul_pow2(k).value()) == mulmod_reference(a, pow2, m));
+        }
+        for (int j = 0; j < 8; ++j) {
+            const u128 b = values[(static_cast<std::size_t>(a % 97) + static_cast<std::size_t>(j) * 31) %
+                                  values.size()];
+            const field fb(from_u128(b));
+            assert(to_u128((fa + fb).value()) == (a + b) % m);
+            assert(to_u128((fa - fb).value()) == (a + m - b) % m);
+            assert(to_u128((fa * fb).value()) == mulmod_reference(a, b, m));
+        }
+    }
+
+    // Reducción de valores de 128 bits arbitrarios
+    for (u128 x : {static_cast<u128>(0), m, m + 1, 2 * m, ~static_cast<u128>(0),
+                   (static_cast<u128>(rng()) << 64) | rng()}) {
+        assert(to_u128(field(from_u128(x)).value()) == x % m);
+    }
+
+    // Potencias: 2^P = 1 y pow frente a productos sucesivos
+    assert(field(uint128_t(2)).pow(uint128_t(P)) == field::one());
+    const field g(from_u128(random_below_m()));
+    field acc = field::one();
+    for (unsigned e = 0; e < 40; ++e) {
+        assert(g.pow(uint128_t(e)) == acc);
+        acc *= g;
+    }
+}
+
+bool test_arithmetic()
+{
+    std::cout << "\n=== TEST: aritmética módulo 2^P - 1 ===\n";
+
+    std::mt19937_64 rng(2024);
+    check_arithmetic<2>(rng);
+    check_arithmetic<5>(rng);
+    check_arithmetic<11>(rng); // M_11 = 23 * 89, compuesto
+    check_arithmetic<31>(rng);
+    check_arithmetic<61>(rng);
+    check_arithmetic<63>(rng); // Último exponente de la ruta de 64 bits
+    check_arithmetic<64>(rng);
+    check_arithmetic<89>(rng);
+    check_arithmetic<100>(rng);
+    check_arithmetic<127>(rng);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+#endif
+
+// =============================================================================
+// TEST: inversos
+// =============================================================================
+
+template <typename Field> void check_inverse()
+{
+    std::mt19937_64 rng(Field::exponent);
+    for (int i = 0; i < 50; ++i) {
+        const Field a(uint128_t(rng(), rng()));
+        if (a.is_zero()) {
+            continue;
+        }
+        assert(a * a.inverse() == Field::one());
+        const Field b(uint128_t(rng(), rng()));
+        assert((b / a) * a == b);
+    }
+    bool thrown = false;
+    try {
+        (void)Field::zero().inverse();
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+bool test_inverse()
+{
+    std::cout << "\n=== TEST: inverso y división ===\n";
+
+    check_inverse<mersenne_mod<13>>();
+    check_inverse<mersenne61>();
+    check_inverse<mersenne_mod<89>>();
+    check_inverse<mersenne127>();
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: lucas_lehmer
+// =============================================================================
+bool test_lucas_lehmer()
+{
+    std::cout << "\n=== TEST: lucas_lehmer ===\n";
+
+    const std::vector<unsigned> known = {2, 3, 5, 7, 13, 17, 19, 31, 61, 89, 107, 127};
+    std::vector<unsigned> found;
+    for (unsigned p = 0; p <= 127; ++p) {
+        if (lucas_lehmer(p)) {
+            found.push_back(p);
+        }
+    }
+    assert(found == known);
+    std::cout << "  Primos de Mersenne con p <= 127: " << found.size() << "\n";
+
+    bool thrown = false;
+    try {
+        (void)lucas_lehmer(128);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: hash polinómico y ventana deslizante
+// =============================================================================
+
+template <unsigned P> void check_hash()
+{
+    using field = mersenne_mod<P>;
+    std::mt19937_64 rng(P);
+    const field base(uint128_t(rng(), rng()));
+
+    std::vector<uint8_t> data(100);
+    for (auto& c : data) {
+        c = static_cast<uint8_t>(rng());
+    }
+
+    // Horner directo, todas las longitudes (colas de 0 a 3 tras los bloques de 4)
+    for (std::size_t n = 0; n <= data.size(); ++n) {
+        field expected;
+        for (std::size_t i = 0; i < n; ++i) {
+            expected = expected * base + field(uint128_t(data[i]));
+        }
+        const std::span<const uint8_t> prefix(data.data(), n);
+        assert(polynomial_hash(prefix, base) == expected);
+
+        // Con semilla: el hash de la concatenación
+        const std::span<const uint8_t> rest(data.data() + n, data.size() - n);
+        assert(polynomial_hash(rest, base, polynomial_hash(prefix, base)) ==
+               polynomial_hash(std::span<const uint8_t>(data), base));
+    }
+
+    // Cadenas y símbolos con signo
+    const std::string text = "abracadabra, abracadabra";
+    const std::vector<char> chars(text.begin(), text.end());
+    assert(polynomial_hash(std::string_view(text), base) ==
+           polynomial_hash(std::span<const char>(chars), base));
+
+    // Ventana deslizante: cada posición frente al hash de la ventana
+    constexpr std::size_t window = 7;
+    rolling_hash<P> roller(base, window);
+    assert(roller.window() == window && roller.base() == base);
+    for (std::size_t i = 0; i < window; ++i) {
+        roller.push(data[i]);
+    }
+    for (std::size_t start = 0;; ++start) {
+        assert(roller.value() ==
+               polynomial_hash(std::span<const uint8_t>(data.data() + start, window), base));
+        if (start + window == data.size()) {
+            break;
+        }
+        roller.roll(data[start], data[start + window]);
+    }
+    roller.reset();
+    assert(roller.value().is_zero());
+}
+
+bool test_hash()
+{
+    std::cout << "\n=== TEST: polynomial_hash / rolling_hash ===\n";
+
+    check_hash<61>();
+    check_hash<127>();
+    check_hash<31>();
+
+    // Búsqueda de un patrón (Karp-Rabin) con base fija
+    const std::string haystack = "el perro de san roque no tiene rabo porque ramon ramirez se lo ha cortado";
+    const std::string_view needle = "rabo";
+    const mersenne127 base(uint128_t(0x9E3779B97F4A7C15ULL, 0xBF58476D1CE4E5B9ULL));
+    const mersenne127 target = polynomial_hash(needle, base);
+    rolling_hash<127> roller(base, needle.size());
+    for (std::size_t i = 0; i < needle.size(); ++i) {
+        roller.push(haystack[i]);
+    }
+    std::size_t found = std::string::npos;
+    for (std::size_t i = 0; i + needle.size() <= haystack.size(); ++i) {
+        if (i > 0) {
+            roller.roll(haystack[i - 1], haystack[i + needle.size() - 1]);
+        }
+        if (roller.value() == target) {
+            found = i;
+            break;
+        }
+    }
+    assert(found == haystack.find(needle));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_mersenne.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+#ifdef __SIZEOF_INT128__
+    RUN_TEST(test_arithmetic);
+#endif
+    RUN_TEST(test_inverse);
+    RUN_TEST(test_lucas_lehmer);
+    RUN_TEST(test_hash);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
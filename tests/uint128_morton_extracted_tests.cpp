@@ -0,0 +1,249 @@
+/*
+ * Tests extraídos para uint128_morton.hpp
+ * Morton 2D/3D/4D frente al intercalado bit a bit por las dos rutas
+ * (PDEP y máscaras mágicas), Hilbert frente al algoritmo clásico xy2d,
+ * adyacencia de índices consecutivos, ida y vuelta y versiones por lotes
+ */
+
+#include "../include/uint128/uint128_morton.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace nstd;
+
+// Intercalado de referencia: el bit i de la coordenada c va a dims * i + c
+template <std::size_t Dims>
+uint128_t interleave_reference(const std::array<uint64_t, Dims>& c, int bits)
+{
+    uint128_t key(0);
+    for (int i = 0; i < bits; ++i) {
+        for (std::size_t d = 0; d < Dims; ++d) {
+            if ((c[d] >> i) & 1) {
+                key |= uint128_t(1) << static_cast<int>(Dims * i + d);
+            }
+        }
+    }
+    return key;
+}
+
+// xy2d clásico con n = 2^64: x = n - 1 - x es ~x
+uint128_t hilbert_reference(uint64_t x, uint64_t y)
+{
+    uint128_t d(0);
+    for (int b = 63; b >= 0; --b) {
+        const uint64_t rx = (x >> b) & 1;
+        const uint64_t ry = (y >> b) & 1;
+        d |= uint128_t((3 * rx) ^ ry) << (2 * b);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = ~x;
+                y = ~y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+// =============================================================================
+// TEST: Morton frente al intercalado bit a bit
+// =============================================================================
+bool test_morton_reference()
+{
+    std::cout << "\n=== TEST: morton2/3/4 frente al intercalado de referencia ===\n";
+
+    std::mt19937_64 gen(44);
+    const uint64_t mask42 = (uint64_t(1) << 42) - 1;
+    for (int iter = 0; iter < 4000; ++iter) {
+        const uint64_t a = gen(), b = gen(), c = gen(), e = gen();
+
+        const uint128_t k2 = interleave_reference<2>({a, b}, 64);
+        assert(morton2_encode(a, b) == k2);
+        assert(detail::morton2_soft(a, b) == k2);
+        assert((morton2_decode(k2) == std::array<uint64_t, 2>{a, b}));
+        assert((detail::morton2_decode_soft(k2) == std::array<uint64_t, 2>{a, b}));
+
+        const uint128_t k3 = interleave_reference<3>({a & mask42, b & mask42, c & mask42}, 42);
+        assert(morton3_encode(a, b, c) == k3);
+        assert(detail::morton3_soft(a, b, c) == k3);
+        const std::array<uint64_t, 3> p3{a & mask42, b & mask42, c & mask42};
+        assert(morton3_decode(k3) == p3);
+        assert(detail::morton3_decode_soft(k3) == p3);
+
+        const std::array<uint32_t, 4> p4{uint32_t(a), uint32_t(b), uint32_t(c), uint32_t(e)};
+        const uint128_t k4 = interleave_reference<4>({p4[0], p4[1], p4[2], p4[3]}, 32);
+        assert(morton4_encode(p4[0], p4[1], p4[2], p4[3]) == k4);
+        assert(detail::morton4_soft(p4[0], p4[1], p4[2], p4[3]) == k4);
+        assert(morton4_decode(k4) == p4);
+        assert(detail::morton4_decode_soft(k4) == p4);
+
+        // Cualquier clave de 128 bits (126 en 3D) es decodificable y vuelve igual
+        const uint128_t any(gen(), gen());
+        auto [x, y] = morton2_decode(any);
+        assert(morton2_encode(x, y) == any);
+        const auto q4 = morton4_decode(any);
+        assert(morton4_encode(q4[0], q4[1], q4[2], q4[3]) == any);
+        const auto q3 = morton3_decode(any);
+        assert(morton3_encode(q3[0], q3[1], q3[2]) == (any & ((uint128_t(1) << 126) - uint128_t(1))));
+    }
+
+#if INTRINSICS_HAS_X86_SIMD && INTRINSICS_ARCH_X86_64
+    if (intrinsics::cpu().bmi2) {
+        for (int iter = 0; iter < 1000; ++iter) {
+            const uint64_t a = gen(), b = gen(), c = gen();
+            assert(detail::morton_bmi2::encode2(a, b) == detail::morton2_soft(a, b));
+            assert(detail::morton_bmi2::encode3(a, b, c) == detail::morton3_soft(a, b, c));
+            assert(detail::morton_bmi2::encode4(uint32_t(a), uint32_t(b), uint32_t(c), uint32_t(a >> 32)) ==
+                   detail::morton4_soft(uint32_t(a), uint32_t(b), uint32_t(c), uint32_t(a >> 32)));
+            const uint128_t k(a, b);
+            assert(detail::morton_bmi2::decode2(k) == detail::morton2_decode_soft(k));
+            assert(detail::morton_bmi2::decode3(k) == detail::morton3_decode_soft(k));
+            assert(detail::morton_bmi2::decode4(k) == detail::morton4_decode_soft(k));
+        }
+        std::cout << "  ruta PDEP comprobada (fast_pdep=" << intrinsics::cpu().fast_pdep << ")\n";
+    }
+#endif
+
+    static_assert(morton2_encode(~uint64_t(0), 0) == uint128_t(0x5555555555555555ULL, 0x5555555555555555ULL));
+    static_assert(morton2_encode(0, 1) == uint128_t(2));
+    static_assert(morton3_encode(0, 0, uint64_t(1) << 41) == uint128_t(1) << 125);
+    static_assert(morton4_encode(0, 0, 0, 0x80000000u) == uint128_t(1) << 127);
+    static_assert(morton2_decode(uint128_t(0, 6))[1] == 1);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: Hilbert
+// =============================================================================
+bool test_hilbert()
+{
+    std::cout << "\n=== TEST: hilbert2 frente a xy2d, adyacencia e ida y vuelta ===\n";
+
+    std::mt19937_64 gen(2024);
+    for (int iter = 0; iter < 4000; ++iter) {
+        const uint64_t x = gen(), y = gen();
+        const uint128_t d = hilbert2_encode(x, y);
+        assert(d == hilbert_reference(x, y));
+        assert((hilbert2_decode(d) == std::array<uint64_t, 2>{x, y}));
+
+        // Índices consecutivos: celdas vecinas (distancia de Manhattan 1)
+        const uint128_t start(gen(), gen());
+        auto prev = hilbert2_decode(start);
+        for (int step = 1; step < 64; ++step) {
+            const auto cur = hilbert2_decode(start + uint128_t(step));
+            const uint64_t dx = cur[0] > prev[0] ? cur[0] - prev[0] : prev[0] - cur[0];
+            const uint64_t dy = cur[1] > prev[1] ? cur[1] - prev[1] : prev[1] - cur[1];
+            assert(dx + dy == 1);
+            prev = cur;
+        }
+    }
+
+    // Extremos de la curva
+    static_assert(hilbert2_encode(0, 0) == uint128_t(0));
+    static_assert(hilbert2_decode(~uint128_t(0))[0] == ~uint64_t(0));
+    static_assert(hilbert2_decode(~uint128_t(0))[1] == 0);
+    assert(hilbert2_encode(~uint64_t(0), 0) == ~uint128_t(0));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: versiones por lotes
+// =============================================================================
+bool test_batch()
+{
+    std::cout << "\n=== TEST: codificación y decodificación por lotes ===\n";
+
+    constexpr std::size_t n = 1000;
+    std::mt19937_64 gen(7);
+    std::vector<uint64_t> x(n), y(n), z(n), x2(n), y2(n), z2(n);
+    std::vector<std::array<uint32_t, 4>> p4(n), q4(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = gen();
+        y[i] = gen();
+        z[i] = gen() >> 22;
+        p4[i] = {uint32_t(x[i]), uint32_t(y[i]), uint32_t(z[i]), uint32_t(x[i] >> 32)};
+    }
+    std::vector<uint128_t> keys(n);
+
+    morton2_encode(std::span<const uint64_t>(x), std::span<const uint64_t>(y), std::span(keys));
+    morton2_decode(std::span<const uint128_t>(keys), std::span(x2), std::span(y2));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(keys[i] == morton2_encode(x[i], y[i]));
+    }
+    assert(x2 == x && y2 == y);
+
+    morton3_encode(std::span<const uint64_t>(x), std::span<const uint64_t>(y),
+                   std::span<const uint64_t>(z), std::span(keys));
+    morton3_decode(std::span<const uint128_t>(keys), std::span(x2), std::span(y2), std::span(z2));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(keys[i] == morton3_encode(x[i], y[i], z[i]));
+        assert(z2[i] == z[i] && x2[i] == (x[i] & ((uint64_t(1) << 42) - 1)));
+    }
+
+    morton4_encode(std::span<const std::array<uint32_t, 4>>(p4), std::span(keys));
+    morton4_decode(std::span<const uint128_t>(keys), std::span(q4));
+    assert(q4 == p4);
+
+    hilbert2_encode(std::span<const uint64_t>(x), std::span<const uint64_t>(y), std::span(keys));
+    hilbert2_decode(std::span<const uint128_t>(keys), std::span(x2), std::span(y2));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(keys[i] == hilbert2_encode(x[i], y[i]));
+    }
+    assert(x2 == x && y2 == y);
+
+    bool threw = false;
+    try {
+        morton2_encode(std::span<const uint64_t>(x), std::span<const uint64_t>(y).first(10),
+                       std::span(keys));
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_morton.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_morton_reference);
+    RUN_TEST(test_hilbert);
+    RUN_TEST(test_batch);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
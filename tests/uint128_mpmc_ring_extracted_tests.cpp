@@ -0,0 +1,232 @@
+/*
+ * Tests extraídos para uint128_mpmc_ring.hpp
+ * mpmc_ring128 y spsc_ring128: capacidad, orden FIFO, cola llena/vacía,
+ * varias vueltas al anillo, lotes parciales y entrega exacta con varios
+ * productores y consumidores
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/uint128/uint128_mpmc_ring.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+// Comprobaciones comunes de un solo hilo para ambas colas
+template <typename Ring> void check_single_thread(Ring& q)
+{
+    assert(q.capacity() == 8 && q.empty());
+    uint128_t v;
+    assert(!q.try_pop(v));
+
+    for (uint64_t i = 0; i < 8; ++i) {
+        assert(q.try_push(uint128_t(i, ~i)));
+    }
+    assert(!q.try_push(uint128_t(99)) && q.size_approx() == 8);
+    for (uint64_t i = 0; i < 8; ++i) {
+        assert(q.try_pop(v) && v == uint128_t(i, ~i));
+    }
+    assert(q.empty());
+
+    // Lotes parciales a lo largo de varias vueltas
+    uint64_t next_in = 0;
+    uint64_t next_out = 0;
+    for (int round = 0; round < 50; ++round) {
+        std::array<uint128_t, 5> in;
+        for (auto& x : in) {
+            x = uint128_t(next_in++);
+        }
+        const std::size_t pushed = q.try_push(std::span<const uint128_t>(in));
+        next_in -= in.size() - pushed;
+        std::array<uint128_t, 3> out;
+        const std::size_t popped = q.try_pop(std::span<uint128_t>(out));
+        for (std::size_t i = 0; i < popped; ++i) {
+            assert(out[i] == uint128_t(next_out++));
+        }
+        assert(q.size_approx() == next_in - next_out && q.size_approx() <= 8);
+    }
+    while (q.try_pop(v)) {
+        assert(v == uint128_t(next_out++));
+    }
+    assert(next_out == next_in);
+}
+
+// =============================================================================
+// TEST: un solo hilo
+// =============================================================================
+bool test_single_thread()
+{
+    std::cout << "\n=== TEST: FIFO, llena/vacía y lotes en un hilo ===\n";
+
+    mpmc_ring128<> mpmc(5); // Redondeo a 8
+    check_single_thread(mpmc);
+    spsc_ring128<> spsc(8);
+    check_single_thread(spsc);
+
+    mpmc_ring_int128 signed_ring(2);
+    signed_ring.push(int128_t(-1));
+    signed_ring.push(int128_t(-2));
+    assert(!signed_ring.try_push(int128_t(-3)));
+    assert(signed_ring.pop() == int128_t(-1) && signed_ring.pop() == int128_t(-2));
+
+    bool thrown = false;
+    try {
+        spsc_ring128<> bad(0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: varios productores y consumidores
+// =============================================================================
+bool test_mpmc_concurrent()
+{
+    std::cout << "\n=== TEST: MPMC con 4 productores y 4 consumidores ===\n";
+
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr uint64_t per_producer = 50000;
+    mpmc_ring128<> q(64);
+    std::vector<std::vector<uint128_t>> received(consumers);
+    std::atomic<uint64_t> remaining{producers * per_producer};
+
+    std::vector<std::thread> pool;
+    for (int p = 0; p < producers; ++p) {
+        pool.emplace_back([&, p] {
+            uint64_t i = 0;
+            while (i < per_producer) {
+                if (i % 3 == 0) { // Alterna sueltos y lotes
+                    std::array<uint128_t, 7> batch;
+                    const uint64_t n = std::min<uint64_t>(batch.size(), per_producer - i);
+                    for (uint64_t k = 0; k < n; ++k) {
+                        batch[k] = uint128_t(static_cast<uint64_t>(p), i + k);
+                    }
+                    i += q.try_push(std::span<const uint128_t>(batch.data(), n));
+                } else {
+                    q.push(uint128_t(static_cast<uint64_t>(p), i));
+                    ++i;
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        pool.emplace_back([&, c] {
+            std::array<uint128_t, 5> batch;
+            while (remaining.load() > 0) {
+                std::size_t n = 0;
+                if (c % 2 == 0) {
+                    n = q.try_pop(std::span<uint128_t>(batch));
+                } else {
+                    n = q.try_pop(batch[0]) ? 1 : 0;
+                }
+                received[c].insert(received[c].end(), batch.begin(), batch.begin() + n);
+                remaining.fetch_sub(n);
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+
+    // Cada valor exactamente una vez; por consumidor, cada productor en orden
+    std::vector<std::vector<bool>> seen(producers, std::vector<bool>(per_producer, false));
+    for (const auto& r : received) {
+        std::vector<int64_t> last(producers, -1);
+        for (const auto& v : r) {
+            const auto p = static_cast<std::size_t>(v.high());
+            const auto i = v.low();
+            assert(!seen[p][i]);
+            seen[p][i] = true;
+            assert(static_cast<int64_t>(i) > last[p]);
+            last[p] = static_cast<int64_t>(i);
+        }
+    }
+    for (const auto& s : seen) {
+        assert(std::all_of(s.begin(), s.end(), [](bool b) { return b; }));
+    }
+    assert(q.empty());
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: un productor y un consumidor
+// =============================================================================
+bool test_spsc_concurrent()
+{
+    std::cout << "\n=== TEST: SPSC concurrente ===\n";
+
+    constexpr uint64_t total = 200000;
+    spsc_ring128<> q(128);
+    std::thread producer([&] {
+        uint64_t i = 0;
+        while (i < total) {
+            std::array<uint128_t, 13> batch;
+            const uint64_t n = std::min<uint64_t>(batch.size(), total - i);
+            for (uint64_t k = 0; k < n; ++k) {
+                batch[k] = uint128_t(i + k, ~(i + k));
+            }
+            i += q.try_push(std::span<const uint128_t>(batch.data(), n));
+        }
+    });
+    uint64_t expected = 0;
+    while (expected < total) {
+        std::array<uint128_t, 9> batch;
+        const std::size_t n = q.try_pop(std::span<uint128_t>(batch));
+        for (std::size_t k = 0; k < n; ++k, ++expected) {
+            assert(batch[k] == uint128_t(expected, ~expected));
+        }
+    }
+    producer.join();
+    assert(q.empty());
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_mpmc_ring.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_single_thread);
+    RUN_TEST(test_mpmc_concurrent);
+    RUN_TEST(test_spsc_concurrent);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+/*
+ * Tests extraídos para uint128_parallel.hpp
+ * Pool fork-join, política execution::par, reducción en árbol ordenada,
+ * parada temprana y propagación de excepciones
+ */
+
+#include "../include/uint128/uint128_parallel.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+// =============================================================================
+// TEST: fork_join_pool
+// =============================================================================
+bool test_pool()
+{
+    std::cout << "\n=== TEST: fork_join_pool ===\n";
+
+    fork_join_pool pool(4);
+    assert(pool.size() == 4);
+
+    // Cada índice se ejecuta exactamente una vez
+    for (unsigned p : {1u, 2u, 4u, 9u}) {
+        std::vector<std::atomic<int>> hits(4);
+        pool.run(p, [&](unsigned i) { hits[i].fetch_add(1); });
+        const unsigned used = p < 4 ? p : 4;
+        for (unsigned i = 0; i < 4; ++i) {
+            assert(hits[i].load() == (i < used ? 1 : 0));
+        }
+    }
+
+    // Todas las tareas corren a la vez: una barrera entre las 4 no se bloquea
+    std::atomic<unsigned> arrived{0};
+    pool.run(4, [&](unsigned) {
+        arrived.fetch_add(1);
+        while (arrived.load() < 4) {
+            std::this_thread::yield();
+        }
+    });
+    assert(arrived.load() == 4);
+
+    // run() anidado se ejecuta en el propio hilo
+    std::atomic<unsigned> nested{0};
+    pool.run(4, [&](unsigned) { pool.run(3, [&](unsigned) { nested.fetch_add(1); }); });
+    assert(nested.load() == 12);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: parallel_reduce
+// =============================================================================
+bool test_reduce()
+{
+    std::cout << "\n=== TEST: parallel_reduce ===\n";
+
+    fork_join_pool pool(4);
+
+    // Merge no conmutativo: la concatenación debe respetar el orden de los bloques
+    const std::size_t n = 1000;
+    for (unsigned threads : {1u, 2u, 3u, 4u}) {
+        const auto policy = execution::par(threads).on(pool).with_grain(1);
+        std::string joined = parallel_reduce<std::string>(
+            n, policy,
+            [](std::size_t b, std::size_t e, std::atomic<bool>&) {
+                std::string s;
+                for (std::size_t i = b; i < e; ++i) {
+                    s += static_cast<char>('a' + i % 26);
+                }
+                return s;
+            },
+            [](const std::string& l, const std::string& r) { return l + r; });
+        assert(joined.size() == n);
+        for (std::size_t i = 0; i < n; ++i) {
+            assert(joined[i] == static_cast<char>('a' + i % 26));
+        }
+    }
+
+    // Tamaño por debajo del grano: un solo bloque
+    unsigned calls = 0;
+    const auto r = parallel_reduce<std::size_t>(
+        10, execution::par.on(pool),
+        [&](std::size_t b, std::size_t e, std::atomic<bool>&) {
+            ++calls;
+            return e - b;
+        },
+        std::plus<std::size_t>());
+    assert(r == 10 && calls == 1);
+
+    // Excepción en un bloque: se relanza en el llamante
+    bool thrown = false;
+    try {
+        (void)parallel_reduce<int>(
+            n, execution::par(4).on(pool).with_grain(1),
+            [](std::size_t b, std::size_t, std::atomic<bool>&) -> int {
+                if (b != 0) {
+                    throw std::runtime_error("chunk");
+                }
+                return 0;
+            },
+            std::plus<int>());
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: parallel_fold con valor absorbente
+// =============================================================================
+bool test_fold()
+{
+    std::cout << "\n=== TEST: parallel_fold ===\n";
+
+    fork_join_pool pool(4);
+    const auto policy = execution::par.on(pool).with_grain(256);
+
+    std::vector<uint128_t> v(1 << 16);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = uint128_t(i * 3 + 1, i);
+    }
+    const uint128_t expected = std::accumulate(v.begin(), v.end(), uint128_t(0));
+    auto never = [](const uint128_t&) { return false; };
+    assert(parallel_fold(v.begin(), v.end(), uint128_t(0), std::plus<uint128_t>(), never, policy) ==
+           expected);
+
+    // Un cero al principio: el producto es 0 y los demás hilos paran antes del final
+    std::atomic<std::size_t> visited{0};
+    v[5] = uint128_t(0);
+    auto counting_mul = [&](const uint128_t& a, const uint128_t& b) {
+        visited.fetch_add(1, std::memory_order_relaxed);
+        return a * b;
+    };
+    auto is_zero = [](const uint128_t& x) { return x == uint128_t(0); };
+    assert(parallel_fold(v.begin(), v.end(), uint128_t(1), counting_mul, is_zero, policy) ==
+           uint128_t(0));
+    assert(parallel_fold(v.begin(), v.end(), uint128_t(1), counting_mul, is_zero,
+                         execution::par(1)) == uint128_t(0));
+    assert(visited.load() < v.size()); // Ambas pasadas juntas recorren menos que el rango
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_parallel.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_pool);
+    RUN_TEST(test_reduce);
+    RUN_TEST(test_fold);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,405 @@
+/*
+ * Tests extraídos para uint128_random.hpp
+ * pcg64, lehmer128 y xoshiro256++ frente a implementaciones de referencia
+ * directas, advance(n) frente a n llamadas y frente a los periodos
+ * conocidos, jump/long_jump de xoshiro frente a x^(2^k) módulo el polinomio
+ * característico, fill frente a llamadas sueltas y uso con <random>;
+ * uniform_uint128_distribution y generate(span, bound) con varios generadores
+ */
+
+#include "../include/uint128/uint128_random.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace nstd;
+
+static_assert(std::uniform_random_bit_generator<pcg64>);
+static_assert(std::uniform_random_bit_generator<lehmer128>);
+static_assert(std::uniform_random_bit_generator<xoshiro256pp>);
+
+// =============================================================================
+// REFERENCIAS
+// =============================================================================
+
+// Código de referencia de xoshiro256++ (Blackman y Vigna, dominio público)
+struct xoshiro_reference {
+    uint64_t s[4];
+
+    static uint64_t rotl(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64_t next()
+    {
+        const uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+};
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 u128;
+
+u128 to_native(const uint128_t& x)
+{
+    return (u128(x.high()) << 64) | x.low();
+}
+
+// pcg_cm_random_r de NumPy (PCG64DXSM) sobre __int128
+struct pcg_reference {
+    u128 state, inc;
+
+    uint64_t next()
+    {
+        uint64_t hi = static_cast<uint64_t>(state >> 64);
+        const uint64_t lo = static_cast<uint64_t>(state) | 1;
+        hi ^= hi >> 32;
+        hi *= 0xDA942042E4DD58B5ULL;
+        hi ^= hi >> 48;
+        hi *= lo;
+        state = state * 0xDA942042E4DD58B5ULL + inc;
+        return hi;
+    }
+};
+#endif
+
+// =============================================================================
+// TEST: secuencias frente a las referencias
+// =============================================================================
+bool test_reference_sequences()
+{
+    std::cout << "\n=== TEST: secuencias de referencia ===\n";
+
+    xoshiro256pp x({1, 2, 3, 4});
+    xoshiro_reference xr{{1, 2, 3, 4}};
+    assert(x() == 41943041); // rotl(1 + 4, 23) + 1
+    xr.next();
+    for (int i = 0; i < 10000; ++i) {
+        assert(x() == xr.next());
+    }
+
+#ifdef __SIZEOF_INT128__
+    const uint128_t initstate(0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL);
+    const uint128_t stream(0x1111111111111111ULL, 0x2222222222222222ULL);
+    pcg64 p(initstate, stream);
+    // Siembra de pcg_cm_srandom_r
+    pcg_reference pr{0, (to_native(stream) << 1) | 1};
+    pr.next();
+    pr.state += to_native(initstate);
+    pr.next();
+    assert(to_native(p.state()) == pr.state);
+    for (int i = 0; i < 10000; ++i) {
+        assert(p() == pr.next());
+    }
+
+    lehmer128 l(uint128_t(0x1234, 0x5678));
+    u128 ls = to_native(uint128_t(0x1234, 0x5679));
+    for (int i = 0; i < 10000; ++i) {
+        ls *= 0xDA942042E4DD58B5ULL;
+        assert(l() == static_cast<uint64_t>(ls >> 64));
+    }
+#endif
+
+    // Semillas distintas, secuencias distintas; misma semilla, misma secuencia
+    assert(pcg64(1)() != pcg64(2)());
+    assert(pcg64(7) == pcg64(7));
+    assert(lehmer128(1)() != lehmer128(2)());
+    assert(xoshiro256pp(1)() != xoshiro256pp(2)());
+    assert((lehmer128(3).state().low() & 1) == 1);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: advance / discard
+// =============================================================================
+template <typename Engine> void check_advance(Engine base)
+{
+    for (uint64_t k : {0ULL, 1ULL, 2ULL, 63ULL, 64ULL, 1000ULL, 12345ULL}) {
+        Engine stepped = base, jumped = base, discarded = base;
+        for (uint64_t i = 0; i < k; ++i) {
+            stepped();
+        }
+        jumped.advance(uint128_t(k));
+        discarded.discard(k);
+        assert(jumped == stepped);
+        assert(discarded == stepped);
+        assert(jumped() == stepped());
+    }
+
+    // advance(a) + advance(b) == advance(a + b)
+    const uint128_t a(0x10, 3), b(0, ~uint64_t(0));
+    Engine split = base, whole = base;
+    split.advance(a);
+    split.advance(b);
+    whole.advance(a + b);
+    assert(split == whole);
+}
+
+bool test_advance()
+{
+    std::cout << "\n=== TEST: advance / discard ===\n";
+
+    check_advance(pcg64(11));
+    check_advance(lehmer128(12));
+    check_advance(xoshiro256pp(13));
+
+    // Periodos: 2^128 para pcg64 y 2^126 para lehmer128
+    const uint128_t half(uint64_t(1) << 63, 0);
+    pcg64 p(21);
+    const pcg64 p0 = p;
+    p.advance(half);
+    assert(!(p == p0));
+    p.advance(half);
+    assert(p == p0);
+
+    lehmer128 l(22);
+    const lehmer128 l0 = l;
+    l.advance(uint128_t(uint64_t(1) << 62, 0));
+    assert(l == l0);
+    l.advance(uint128_t(uint64_t(1) << 61, 0));
+    assert(!(l == l0));
+
+    // jump() = 2^128 pasos = dos advance(2^127)
+    xoshiro256pp x(23), y(23);
+    x.jump();
+    y.advance(half);
+    y.advance(half);
+    assert(x == y);
+
+    // Las constantes de jump/long_jump son x^(2^128) y x^(2^192) módulo el
+    // polinomio característico obtenido con Berlekamp-Massey
+    detail::gf2_poly256 q = {2, 0, 0, 0};
+    for (int i = 0; i < 192; ++i) {
+        q = detail::xoshiro_mulmod(q, q);
+        if (i == 127) {
+            assert(q == detail::xoshiro_jump);
+        }
+    }
+    assert(q == detail::xoshiro_long_jump);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: fill y <random>
+// =============================================================================
+template <typename Engine> void check_fill(Engine e)
+{
+    Engine ref = e;
+    for (std::size_t n : {0u, 1u, 7u, 1000u}) {
+        std::vector<uint64_t> out(n);
+        e.fill(out);
+        for (std::size_t i = 0; i < n; ++i) {
+            assert(out[i] == ref());
+        }
+        assert(e == ref);
+    }
+}
+
+bool test_fill()
+{
+    std::cout << "\n=== TEST: fill ===\n";
+
+    check_fill(pcg64(31));
+    check_fill(lehmer128(32));
+    check_fill(xoshiro256pp(33));
+
+    xoshiro256pp x(34), ref(34);
+    std::vector<uint128_t> wide(100);
+    x.fill(std::span<uint128_t>(wide));
+    for (const auto& v : wide) {
+        const uint64_t hi = ref();
+        assert(v == uint128_t(hi, ref()));
+    }
+    assert(x.next128() == ref.next128());
+
+    // Distribuciones estándar: la media de 10^5 dados de 6 caras ronda 3.5
+    pcg64 rng(35);
+    std::uniform_int_distribution<int> die(1, 6);
+    long sum = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const int d = die(rng);
+        assert(d >= 1 && d <= 6);
+        sum += d;
+    }
+    assert(sum > 345000 && sum < 355000);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    lehmer128 lrng(36);
+    double mean = 0;
+    for (int i = 0; i < 100000; ++i) {
+        mean += unit(lrng) / 100000;
+    }
+    assert(mean > 0.49 && mean < 0.51);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: uniform_uint128_distribution y generate(span, bound)
+// =============================================================================
+
+// Chi-cuadrado de `counts` frente a la uniforme, con margen amplio (~10 sigmas)
+bool looks_uniform(const std::vector<std::size_t>& counts, std::size_t samples)
+{
+    const double expected = static_cast<double>(samples) / static_cast<double>(counts.size());
+    double chi2 = 0;
+    for (std::size_t c : counts) {
+        const double d = static_cast<double>(c) - expected;
+        chi2 += d * d / expected;
+    }
+    const double dof = static_cast<double>(counts.size() - 1);
+    return chi2 <= dof + 10 * std::sqrt(2 * dof);
+}
+
+template <typename Engine> void check_distribution(Engine rng)
+{
+    constexpr std::size_t samples = 60000;
+
+    // Cotas pequeñas: frecuencias uniformes
+    for (uint64_t bound : {1ULL, 6ULL, 10ULL, 1000ULL}) {
+        uniform_uint128_distribution d(uint128_t(0), uint128_t(bound - 1));
+        std::vector<std::size_t> counts(bound, 0);
+        for (std::size_t i = 0; i < samples; ++i) {
+            const uint128_t v = d(rng);
+            assert(v < uint128_t(bound));
+            ++counts[static_cast<std::size_t>(v.low())];
+        }
+        assert(looks_uniform(counts, samples));
+    }
+
+    // Extremos alcanzables en [max - 2, max] y [a, a]
+    const uint128_t top = ~uint128_t(0);
+    uniform_uint128_distribution high(top - uint128_t(2), top);
+    bool seen[3] = {false, false, false};
+    for (int i = 0; i < 200; ++i) {
+        const uint128_t v = high(rng);
+        assert(v >= top - uint128_t(2));
+        seen[static_cast<std::size_t>((v - (top - uint128_t(2))).low())] = true;
+    }
+    assert(seen[0] && seen[1] && seen[2]);
+    const uint128_t fixed(0x1234, 0x5678);
+    assert(uniform_uint128_distribution(fixed, fixed)(rng) == fixed);
+
+    // Peor caso del rechazo (n = 2^127 + 1, casi la mitad de los x se
+    // descartan): el bit 126 sigue a 1 en la mitad de los valores
+    const uint128_t worst = (uint128_t(1) << 127) + uint128_t(1);
+    uniform_uint128_distribution wide(uint128_t(0), worst - uint128_t(1));
+    std::size_t upper = 0;
+    for (std::size_t i = 0; i < samples; ++i) {
+        const uint128_t v = wide(rng);
+        assert(v < worst);
+        upper += ((v >> 126) & uint128_t(1)) == uint128_t(1) ? 1 : 0;
+    }
+    assert(upper > samples / 2 - 1500 && upper < samples / 2 + 1500);
+
+    // Bloques: mismas garantías por la ruta con fill y por la genérica
+    std::vector<uint128_t> block(5000);
+    generate(block, uint128_t(10), rng);
+    std::vector<std::size_t> counts(10, 0);
+    for (const auto& v : block) {
+        assert(v < uint128_t(10));
+        ++counts[static_cast<std::size_t>(v.low())];
+    }
+    assert(looks_uniform(counts, block.size()));
+    generate(block, worst, rng);
+    for (const auto& v : block) {
+        assert(v < worst);
+    }
+    uniform_uint128_distribution range(uint128_t(100), uint128_t(199));
+    range.generate(block, rng);
+    for (const auto& v : block) {
+        assert(v >= uint128_t(100) && v <= uint128_t(199));
+    }
+}
+
+bool test_uniform_distribution()
+{
+    std::cout << "\n=== TEST: uniform_uint128_distribution / generate ===\n";
+
+    check_distribution(pcg64(41));
+    check_distribution(xoshiro256pp(42));
+    check_distribution(std::mt19937_64(43));
+    check_distribution(std::mt19937(44));     // 32 bits por llamada
+    check_distribution(std::minstd_rand(45)); // Rango [1, 2^31 - 2]
+
+    // Rango completo: dos salidas del generador tal cual
+    pcg64 a(46), b(46);
+    uniform_uint128_distribution full;
+    const uint64_t hi = b();
+    assert(full(a) == uint128_t(hi, b()));
+
+    // Parámetros
+    uniform_uint128_distribution d(uint128_t(5), uint128_t(9));
+    assert(d.a() == uint128_t(5) && d.b() == uint128_t(9));
+    assert(d.min() == uint128_t(5) && d.max() == uint128_t(9));
+    d.param(uniform_uint128_distribution::param_type(uint128_t(1)));
+    assert(d.b() == ~uint128_t(0));
+    assert(!(d == uniform_uint128_distribution(uint128_t(5), uint128_t(9))));
+
+    auto throws = [](auto f) {
+        try {
+            f();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    };
+    assert(throws([] { uniform_uint128_distribution(uint128_t(2), uint128_t(1)); }));
+    std::vector<uint128_t> out(4);
+    assert(throws([&] { generate(out, uint128_t(0), a); }));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_random.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_reference_sequences);
+    RUN_TEST(test_advance);
+    RUN_TEST(test_fill);
+    RUN_TEST(test_uniform_distribution);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
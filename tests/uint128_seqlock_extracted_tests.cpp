@@ -0,0 +1,138 @@
+/*
+ * Tests extraídos para uint128_seqlock.hpp
+ * seqlock128: lectura/escritura, update, lecturas nunca partidas con un
+ * escritor y varios lectores, y escritores concurrentes serializados
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/uint128/uint128_seqlock.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+static_assert(alignof(seqlock_uint128) == 64);
+
+// =============================================================================
+// TEST: operaciones básicas
+// =============================================================================
+bool test_basic()
+{
+    std::cout << "\n=== TEST: load/store/update ===\n";
+
+    seqlock_uint128 a;
+    assert(a.load() == uint128_t(0) && a.version() == 0);
+
+    a.store(uint128_t(1, 2));
+    assert(a.load() == uint128_t(1, 2) && a.version() == 1);
+    uint128_t out;
+    assert(a.try_load(out) && out == uint128_t(1, 2));
+
+    a = uint128_t(0, ~0ull);
+    assert(static_cast<uint128_t>(a) == uint128_t(0, ~0ull));
+    assert(a.fetch_add(uint128_t(1)) == uint128_t(0, ~0ull));
+    assert(a.load() == uint128_t(1, 0));
+    assert(a.update([](uint128_t v) { return v << 1; }) == uint128_t(2, 0));
+    assert(a.version() == 4);
+
+    seqlock_int128 s(int128_t(-5));
+    assert(s.fetch_sub(int128_t(10)) == int128_t(-5));
+    assert(s.load() == int128_t(-15));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: concurrencia
+// =============================================================================
+bool test_concurrent()
+{
+    std::cout << "\n=== TEST: 1 escritor + N lectores, escritores concurrentes ===\n";
+
+    // El escritor mantiene high == ~low: un lector nunca debe ver una mezcla
+    seqlock_uint128 cell(uint128_t(~0ull, 0));
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::atomic<uint64_t> reads{0};
+    std::vector<std::thread> pool;
+    for (int r = 0; r < 3; ++r) {
+        pool.emplace_back([&] {
+            uint64_t last = 0;
+            uint64_t local = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                const uint128_t v = cell.load();
+                if (v.high() != ~v.low() || v.low() < last) { // Además, nunca retrocede
+                    torn.fetch_add(1);
+                }
+                last = v.low();
+                ++local;
+            }
+            reads.fetch_add(local);
+        });
+    }
+    for (uint64_t i = 1; i <= 200000; ++i) {
+        cell.store(uint128_t(~i, i));
+    }
+    done.store(true);
+    for (auto& th : pool) {
+        th.join();
+    }
+    assert(torn.load() == 0);
+    assert(cell.version() == 200000);
+
+    // Varios escritores: update se serializa, no se pierde ningún incremento
+    seqlock_int128 counter(int128_t(0));
+    pool.clear();
+    for (int t = 0; t < 4; ++t) {
+        pool.emplace_back([&] {
+            for (int i = 0; i < 20000; ++i) {
+                counter.fetch_sub(int128_t(1, 0)); // Sólo la parte alta
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    assert(counter.load() == int128_t(0) - int128_t(80000, 0));
+
+    std::cout << "  lecturas: " << reads.load() << "\n";
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_seqlock.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_basic);
+    RUN_TEST(test_concurrent);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
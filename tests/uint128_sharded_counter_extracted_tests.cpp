@@ -0,0 +1,171 @@
+/*
+ * Tests extraídos para uint128_sharded_counter.hpp
+ * sharded_counter128: fragmentos por hilo y por CPU, desbordamiento módulo
+ * 2^128, hilos de más que fragmentos, reutilización de índices y traslados
+ * periódicos al total común
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/uint128/uint128_sharded_counter.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+// Lanza `threads` hilos que ejecutan f(t) y espera a que terminen
+template <typename F> void run_threads(int threads, F f)
+{
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back(f, t);
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+}
+
+// =============================================================================
+// TEST: un solo hilo
+// =============================================================================
+bool test_single_thread()
+{
+    std::cout << "\n=== TEST: add/sub/read en un hilo ===\n";
+
+    sharded_uint128_counter c(shard_selection::thread, 3);
+    assert(c.shard_count() == 4); // Redondeo a potencia de 2
+    assert(c.read() == uint128_t(0));
+
+    c.add(uint128_t(0, ~0ull));
+    c.increment();
+    assert(c.read() == uint128_t(1, 0));
+    c.sub(uint128_t(2, 0));
+    assert(c.read() == uint128_t(~0ull, 0)); // Módulo 2^128
+    c.reset();
+    assert(c.read() == uint128_t(0));
+
+    sharded_int128_counter s(shard_selection::cpu);
+    assert(s.selection() == shard_selection::cpu && s.shard_count() >= 1);
+    s.sub(int128_t(10));
+    s.add(int128_t(3));
+    assert(s.read() == int128_t(-7));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: índices de hilo
+// =============================================================================
+bool test_thread_index()
+{
+    std::cout << "\n=== TEST: índices de hilo únicos y reutilizados ===\n";
+
+    std::vector<unsigned> ids(8);
+    std::atomic<int> arrived{0};
+    run_threads(8, [&](int t) {
+        ids[t] = detail::this_thread_index();
+        arrived.fetch_add(1);
+        while (arrived.load() < 8) { // Todos vivos a la vez
+            std::this_thread::yield();
+        }
+    });
+    assert(std::set<unsigned>(ids.begin(), ids.end()).size() == 8);
+
+    // Los índices liberados se reutilizan: siguen siendo densos
+    unsigned reused = 0;
+    std::thread([&] { reused = detail::this_thread_index(); }).join();
+    assert(reused <= 8);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: concurrencia
+// =============================================================================
+bool test_concurrent()
+{
+    std::cout << "\n=== TEST: sumas concurrentes (exclusivos, desbordamiento, CPU, traslados) ===\n";
+
+    constexpr int iterations = 20000;
+    const uint128_t step(1, 3); // Toca ambas mitades
+
+    for (auto selection : {shard_selection::thread, shard_selection::cpu}) {
+        for (uint32_t fold : {0u, 1u, 97u}) {
+            // 2 fragmentos y 6 hilos: en modo thread al menos 4 usan desbordamiento
+            sharded_uint128_counter c(selection, 2, fold);
+            std::atomic<bool> done{false};
+            uint128_t last_seen(0);
+            bool monotonic = true;
+            std::thread reader([&] {
+                while (!done.load()) {
+                    const uint128_t v = c.read();
+                    monotonic = monotonic && v >= last_seen;
+                    last_seen = v;
+                }
+            });
+            run_threads(6, [&](int) {
+                for (int i = 0; i < iterations; ++i) {
+                    c.add(step);
+                }
+            });
+            done.store(true);
+            reader.join();
+            assert(monotonic);
+            assert(c.read() == step * uint128_t(6 * iterations));
+            if (fold == 1) {
+                assert(c.approximate() == c.read()); // Todo trasladado
+            }
+        }
+    }
+
+    // Con signo: la suma de positivos y negativos cruza el cero
+    sharded_int128_counter s(shard_selection::thread, 0, 64);
+    run_threads(4, [&](int t) {
+        for (int i = 0; i < iterations; ++i) {
+            s.add(int128_t(t % 2 ? -3 : 2));
+        }
+    });
+    assert(s.read() == int128_t(-2 * iterations));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_sharded_counter.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_single_thread);
+    RUN_TEST(test_thread_index);
+    RUN_TEST(test_concurrent);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
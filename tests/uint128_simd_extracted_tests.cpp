@@ -0,0 +1,383 @@
+/*
+ * Tests extraídos para uint128_simd.hpp
+ * Kernels sobre std::span<uint128_t> (AoS) comparados contra los operadores
+ * de uint128_t en todas las rutas disponibles (escalar, AVX2, AVX-512)
+ */
+
+#include "../include/uint128/uint128_simd.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <vector>
+
+using namespace nstd;
+
+// Tamaño no múltiplo de 8 para ejercitar las colas escalares
+static constexpr std::size_t N = 1000 + 5;
+
+std::mt19937_64 rng(0xa05);
+
+// Mezcla de valores aleatorios y casos límite de acarreo
+std::vector<uint128_t> make_values(std::size_t n)
+{
+    std::vector<uint128_t> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        switch (i % 5) {
+        case 0:
+            v.emplace_back(rng(), ~uint64_t{0}); // lo saturado: acarreo
+            break;
+        case 1:
+            v.emplace_back(rng(), 0); // lo a cero: préstamo
+            break;
+        case 2:
+            v.emplace_back(rng() & 0xF, rng() & 0xF); // valores pequeños (igualdades)
+            break;
+        default:
+            v.emplace_back(rng(), rng());
+            break;
+        }
+    }
+    return v;
+}
+
+const intrinsics::simd_level levels[] = {intrinsics::simd_level::scalar,
+                                         intrinsics::simd_level::avx2,
+                                         intrinsics::simd_level::avx512};
+
+const char* level_name(intrinsics::simd_level level)
+{
+    switch (level) {
+    case intrinsics::simd_level::avx512:
+        return "avx512";
+    case intrinsics::simd_level::avx2:
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+// Ejecuta f para cada ruta soportada por la CPU
+template <typename F> void for_each_level(F f)
+{
+    for (auto level : levels) {
+        if (static_cast<int>(level) > static_cast<int>(intrinsics::best_simd_level())) {
+            std::cout << "  [SKIP] " << level_name(level) << " no disponible\n";
+            continue;
+        }
+        intrinsics::force_simd_level(level);
+        f(level);
+        std::cout << "  " << level_name(level) << " OK\n";
+    }
+    intrinsics::reset_simd_level();
+}
+
+// =============================================================================
+// TEST: add / sub, con salida sobre una de las entradas
+// =============================================================================
+bool test_add_sub()
+{
+    std::cout << "\n=== TEST: add / sub ===\n";
+
+    const auto a = make_values(N);
+    const auto b = make_values(N);
+
+    for_each_level([&](intrinsics::simd_level) {
+        std::vector<uint128_t> sum(N), diff(N);
+        simd::add(a, b, sum);
+        simd::sub(a, b, diff);
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(sum[i] == a[i] + b[i]);
+            assert(diff[i] == a[i] - b[i]);
+        }
+
+        // Salida que coincide con una entrada
+        auto acc = a;
+        simd::add(acc, b, acc);
+        assert(acc == sum);
+
+        // Subspans de cualquier longitud (cola escalar de 0..7 elementos)
+        for (std::size_t len = 0; len < 20; ++len) {
+            std::vector<uint128_t> out(len);
+            simd::sub(std::span(a).subspan(3, len), std::span(b).subspan(3, len), out);
+            for (std::size_t i = 0; i < len; ++i) {
+                assert(out[i] == a[3 + i] - b[3 + i]);
+            }
+        }
+    });
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: mul_lo y mul por escalar de 64 bits
+// =============================================================================
+bool test_mul()
+{
+    std::cout << "\n=== TEST: mul_lo / mul escalar ===\n";
+
+    const auto a = make_values(N);
+    const auto b = make_values(N);
+
+    for_each_level([&](intrinsics::simd_level) {
+        std::vector<uint128_t> prod(N);
+        simd::mul_lo(a, b, prod);
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(prod[i] == a[i] * b[i]);
+        }
+
+        for (uint64_t s : {uint64_t{0}, uint64_t{1}, uint64_t{10}, uint64_t{0xFFFFFFFF},
+                           uint64_t{0x100000000}, ~uint64_t{0}, uint64_t{0x9E3779B97F4A7C15}}) {
+            std::vector<uint128_t> out(N);
+            simd::mul(a, s, out);
+            for (std::size_t i = 0; i < N; ++i) {
+                assert(out[i] == a[i] * uint128_t(s));
+            }
+        }
+    });
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: operaciones bit a bit y desplazamientos
+// =============================================================================
+bool test_bitwise_shifts()
+{
+    std::cout << "\n=== TEST: and / or / xor / andnot / shifts ===\n";
+
+    const auto a = make_values(N);
+    const auto b = make_values(N);
+
+    for_each_level([&](intrinsics::simd_level) {
+        std::vector<uint128_t> r_and(N), r_or(N), r_xor(N), r_andnot(N);
+        simd::bit_and(a, b, r_and);
+        simd::bit_or(a, b, r_or);
+        simd::bit_xor(a, b, r_xor);
+        simd::bit_andnot(a, b, r_andnot);
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(r_and[i] == (a[i] & b[i]));
+            assert(r_or[i] == (a[i] | b[i]));
+            assert(r_xor[i] == (a[i] ^ b[i]));
+            assert(r_andnot[i] == (a[i] & ~b[i]));
+        }
+
+        for (unsigned s : {0u, 1u, 13u, 63u, 64u, 65u, 100u, 127u, 128u, 200u}) {
+            std::vector<uint128_t> l(N), r(N);
+            simd::shift_left(a, s, l);
+            simd::shift_right(a, s, r);
+            for (std::size_t i = 0; i < N; ++i) {
+                assert(l[i] == a[i].shift_left(static_cast<int>(s)));
+                assert(r[i] == a[i].shift_right(static_cast<int>(s)));
+            }
+        }
+    });
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: compare -> máscara
+// =============================================================================
+bool test_compare()
+{
+    std::cout << "\n=== TEST: compare ===\n";
+
+    const auto a = make_values(N);
+    auto b = make_values(N);
+    for (std::size_t i = 0; i < N; i += 7) {
+        b[i] = a[i]; // Forzar igualdades
+    }
+    const uint128_t threshold(0x8000000000000000ULL, 0);
+
+    for_each_level([&](intrinsics::simd_level) {
+        const auto eq = simd::compare(a, b, simd::cmp_op::eq);
+        const auto ne = simd::compare(a, b, simd::cmp_op::ne);
+        const auto lt = simd::compare(a, b, simd::cmp_op::lt);
+        const auto le = simd::compare(a, b, simd::cmp_op::le);
+        const auto gt = simd::compare(a, b, simd::cmp_op::gt);
+        const auto ge = simd::compare(a, b, simd::cmp_op::ge);
+        const auto over = simd::compare(a, threshold, simd::cmp_op::ge);
+        const auto same = simd::compare(a, a[2], simd::cmp_op::eq);
+        assert(eq.size() == (N + 63) / 64);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(simd::test(eq, i) == (a[i] == b[i]));
+            assert(simd::test(ne, i) == (a[i] != b[i]));
+            assert(simd::test(lt, i) == (a[i] < b[i]));
+            assert(simd::test(le, i) == (a[i] <= b[i]));
+            assert(simd::test(gt, i) == (a[i] > b[i]));
+            assert(simd::test(ge, i) == (a[i] >= b[i]));
+            assert(simd::test(over, i) == (a[i] >= threshold));
+            assert(simd::test(same, i) == (a[i] == a[2]));
+        }
+        // Los bits tras el último elemento quedan a cero
+        assert((ne.back() >> (N % 64)) == 0);
+        assert(simd::compare(std::span<const uint128_t>{}, threshold, simd::cmp_op::lt).empty());
+    });
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: popcount / countl_zero / histograma de bit_width
+// =============================================================================
+int ref_popcount(const uint128_t& x)
+{
+    return std::popcount(x.high()) + std::popcount(x.low());
+}
+
+int ref_clz(const uint128_t& x)
+{
+    return x.high() != 0 ? std::countl_zero(x.high()) : 64 + std::countl_zero(x.low());
+}
+
+bool test_bit_statistics()
+{
+    std::cout << "\n=== TEST: popcount_sum / and_popcount / popcount_each / countl_zero_each ===\n";
+
+    auto a = make_values(N);
+    a[0] = uint128_t(0);
+    a[1] = ~uint128_t(0);
+    a[2] = uint128_t(1);
+    a[3] = uint128_t(1, 0);
+    for (std::size_t i = 5; i < N; i += 11) {
+        a[i] = uint128_t(0, rng() >> (rng() % 64)); // Parte alta a cero
+    }
+
+    for_each_level([&](intrinsics::simd_level) {
+        // Todas las longitudes hasta pasar de un bloque Harley-Seal (32)
+        // con desplazamientos distintos para cubrir las colas
+        for (std::size_t len : {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{31},
+                                std::size_t{33}, std::size_t{70}, N - 3, N}) {
+            const std::size_t off = (N - len) / 2;
+            const std::span<const uint128_t> s(a.data() + off, len);
+
+            uint64_t expected = 0;
+            for (const auto& x : s) {
+                expected += static_cast<uint64_t>(ref_popcount(x));
+            }
+            assert(simd::popcount_sum(s) == expected);
+
+            const std::span<const uint128_t> t(a.data() + (N - len), len);
+            uint64_t expected_and = 0;
+            for (std::size_t i = 0; i < len; ++i) {
+                expected_and += static_cast<uint64_t>(ref_popcount(s[i] & t[i]));
+            }
+            assert(simd::and_popcount(s, t) == expected_and);
+
+            std::vector<uint8_t> pc(len + 1, 0xAA), lz(len + 1, 0xAA);
+            simd::popcount_each(s, pc);
+            simd::countl_zero_each(s, lz);
+            for (std::size_t i = 0; i < len; ++i) {
+                assert(pc[i] == ref_popcount(s[i]));
+                assert(lz[i] == ref_clz(s[i]));
+            }
+            assert(pc[len] == 0xAA && lz[len] == 0xAA);
+        }
+
+        const auto hist = simd::bit_width_histogram(a);
+        std::array<std::size_t, 129> expected_hist{};
+        for (const auto& x : a) {
+            ++expected_hist[128 - ref_clz(x)];
+        }
+        assert(hist == expected_hist);
+        assert(hist[0] >= 1 && hist[128] >= 1 && hist[1] >= 1 && hist[65] >= 1);
+    });
+
+    // Más de un bloque del histograma con todos los valores en la misma cubeta
+    const std::vector<uint128_t> same(5000, uint128_t(1, 0));
+    const auto hist = simd::bit_width_histogram(same);
+    assert(hist[65] == same.size());
+    assert(simd::popcount_sum(same) == same.size());
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: validación de tamaños
+// =============================================================================
+bool test_size_checks()
+{
+    std::cout << "\n=== TEST: tamaños incompatibles ===\n";
+
+    const auto a = make_values(16);
+    const auto shorter = make_values(15);
+    std::vector<uint128_t> out(16), small(15);
+
+    auto throws = [](auto f) {
+        try {
+            f();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    };
+    assert(throws([&] { simd::add(a, shorter, out); }));
+    assert(throws([&] { simd::bit_xor(a, shorter, out); }));
+    assert(throws([&] { simd::add(a, a, small); }));
+    assert(throws([&] { simd::mul(a, 3, small); }));
+    assert(throws([&] { simd::shift_left(a, 3, small); }));
+    assert(throws([&] { (void)simd::compare(a, shorter, simd::cmp_op::lt); }));
+    std::vector<uint8_t> counts(15);
+    assert(throws([&] { simd::popcount_each(a, counts); }));
+    assert(throws([&] { simd::countl_zero_each(a, counts); }));
+    assert(throws([&] { (void)simd::and_popcount(a, shorter); }));
+
+    // Una salida más larga es válida: sólo se escriben los primeros a.size()
+    std::vector<uint128_t> longer(20, uint128_t(7));
+    simd::add(a, a, longer);
+    assert(longer[15] == a[15] + a[15]);
+    assert(longer[16] == uint128_t(7));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_simd.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    const auto& cpu = intrinsics::cpu();
+    std::cout << "CPU: avx2=" << cpu.avx2 << " avx512f=" << cpu.avx512f << "\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_add_sub);
+    RUN_TEST(test_mul);
+    RUN_TEST(test_bitwise_shifts);
+    RUN_TEST(test_compare);
+    RUN_TEST(test_bit_statistics);
+    RUN_TEST(test_size_checks);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
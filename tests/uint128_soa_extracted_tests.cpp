@@ -0,0 +1,313 @@
+/*
+ * Tests extraídos para uint128_soa.hpp
+ * Cada kernel se compara contra los operadores de uint128_t en todas las
+ * rutas disponibles (escalar, AVX2, AVX-512)
+ */
+
+#include "../include/uint128/uint128_soa.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace nstd;
+
+// Tamaño no múltiplo de 8 para ejercitar las colas escalares
+static constexpr std::size_t N = 1000 + 5;
+
+std::mt19937_64 rng(0x5eed);
+
+// Mezcla de valores aleatorios y casos límite de acarreo
+std::vector<uint128_t> make_values(std::size_t n)
+{
+    std::vector<uint128_t> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        switch (i % 5) {
+        case 0:
+            v.emplace_back(rng(), ~uint64_t{0}); // lo saturado: acarreo
+            break;
+        case 1:
+            v.emplace_back(rng(), 0); // lo a cero: préstamo
+            break;
+        case 2:
+            v.emplace_back(rng() & 0xF, rng() & 0xF); // valores pequeños (igualdades)
+            break;
+        default:
+            v.emplace_back(rng(), rng());
+            break;
+        }
+    }
+    return v;
+}
+
+const intrinsics::simd_level levels[] = {intrinsics::simd_level::scalar,
+                                         intrinsics::simd_level::avx2,
+                                         intrinsics::simd_level::avx512};
+
+const char* level_name(intrinsics::simd_level level)
+{
+    switch (level) {
+    case intrinsics::simd_level::avx512:
+        return "avx512";
+    case intrinsics::simd_level::avx2:
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+// Ejecuta f para cada ruta soportada por la CPU
+template <typename F> void for_each_level(F f)
+{
+    for (auto level : levels) {
+        if (static_cast<int>(level) > static_cast<int>(intrinsics::best_simd_level())) {
+            std::cout << "  [SKIP] " << level_name(level) << " no disponible\n";
+            continue;
+        }
+        intrinsics::force_simd_level(level);
+        f(level);
+        std::cout << "  " << level_name(level) << " OK\n";
+    }
+    intrinsics::reset_simd_level();
+}
+
+// =============================================================================
+// TEST: construcción, alineación y conversión AoS <-> SoA
+// =============================================================================
+bool test_conversion()
+{
+    std::cout << "\n=== TEST: conversión vector<uint128_t> <-> soa ===\n";
+
+    const auto values = make_values(N);
+    for_each_level([&](intrinsics::simd_level) {
+        uint128_soa_vector v(values);
+        assert(v.size() == N);
+        assert(reinterpret_cast<std::uintptr_t>(v.hi_data()) % 64 == 0);
+        assert(reinterpret_cast<std::uintptr_t>(v.lo_data()) % 64 == 0);
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(v[i] == values[i]);
+        }
+        assert(v.to_vector() == values);
+    });
+
+    uint128_soa_vector v;
+    for (const auto& x : values) {
+        v.push_back(x);
+    }
+    assert(v == uint128_soa_vector(values));
+    v.resize(N + 3);
+    assert(v[N + 2] == uint128_t(0));
+
+    bool thrown = false;
+    try {
+        (void)v.at(N + 3);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: add / sub con acarreo
+// =============================================================================
+bool test_add_sub()
+{
+    std::cout << "\n=== TEST: add / sub ===\n";
+
+    const auto av = make_values(N);
+    const auto bv = make_values(N);
+    const uint128_soa_vector a(av), b(bv);
+
+    for_each_level([&](intrinsics::simd_level) {
+        uint128_soa_vector sum, diff;
+        soa::add(a, b, sum);
+        soa::sub(a, b, diff);
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(sum[i] == av[i] + bv[i]);
+            assert(diff[i] == av[i] - bv[i]);
+        }
+
+        // Salida que coincide con una entrada
+        uint128_soa_vector acc(a);
+        soa::add(acc, b, acc);
+        assert(acc == sum);
+    });
+
+    uint128_soa_vector shorter(N - 1);
+    uint128_soa_vector out;
+    bool thrown = false;
+    try {
+        soa::add(a, shorter, out);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown && "Tamaños distintos deben lanzar std::invalid_argument");
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: operaciones bit a bit y desplazamientos
+// =============================================================================
+bool test_bitwise_shifts()
+{
+    std::cout << "\n=== TEST: and / or / xor / shifts ===\n";
+
+    const auto av = make_values(N);
+    const auto bv = make_values(N);
+    const uint128_soa_vector a(av), b(bv);
+
+    for_each_level([&](intrinsics::simd_level) {
+        uint128_soa_vector r_and, r_or, r_xor;
+        soa::bit_and(a, b, r_and);
+        soa::bit_or(a, b, r_or);
+        soa::bit_xor(a, b, r_xor);
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(r_and[i] == (av[i] & bv[i]));
+            assert(r_or[i] == (av[i] | bv[i]));
+            assert(r_xor[i] == (av[i] ^ bv[i]));
+        }
+
+        for (unsigned s : {0u, 1u, 13u, 63u, 64u, 65u, 100u, 127u, 128u, 200u}) {
+            uint128_soa_vector l, r;
+            soa::shift_left(a, s, l);
+            soa::shift_right(a, s, r);
+            for (std::size_t i = 0; i < N; ++i) {
+                assert(l[i] == av[i].shift_left(static_cast<int>(s)));
+                assert(r[i] == av[i].shift_right(static_cast<int>(s)));
+            }
+        }
+    });
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: compare -> máscara, min / max
+// =============================================================================
+bool test_compare_minmax()
+{
+    std::cout << "\n=== TEST: compare / min / max ===\n";
+
+    const auto av = make_values(N);
+    auto bv = make_values(N);
+    for (std::size_t i = 0; i < N; i += 7) {
+        bv[i] = av[i]; // Forzar igualdades
+    }
+    const uint128_soa_vector a(av), b(bv);
+    const uint128_t threshold(0x8000000000000000ULL, 0);
+
+    for_each_level([&](intrinsics::simd_level) {
+        const auto eq = soa::compare(a, b, soa::cmp_op::eq);
+        const auto ne = soa::compare(a, b, soa::cmp_op::ne);
+        const auto lt = soa::compare(a, b, soa::cmp_op::lt);
+        const auto le = soa::compare(a, b, soa::cmp_op::le);
+        const auto gt = soa::compare(a, b, soa::cmp_op::gt);
+        const auto ge = soa::compare(a, b, soa::cmp_op::ge);
+        const auto over = soa::compare(a, threshold, soa::cmp_op::ge);
+        assert(eq.size() == (N + 63) / 64);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(soa::test(eq, i) == (av[i] == bv[i]));
+            assert(soa::test(ne, i) == (av[i] != bv[i]));
+            assert(soa::test(lt, i) == (av[i] < bv[i]));
+            assert(soa::test(le, i) == (av[i] <= bv[i]));
+            assert(soa::test(gt, i) == (av[i] > bv[i]));
+            assert(soa::test(ge, i) == (av[i] >= bv[i]));
+            assert(soa::test(over, i) == (av[i] >= threshold));
+        }
+        // Los bits tras el último elemento quedan a cero
+        assert((ne.back() >> (N % 64)) == 0);
+
+        uint128_soa_vector mn, mx;
+        soa::min(a, b, mn);
+        soa::max(a, b, mx);
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(mn[i] == (av[i] < bv[i] ? av[i] : bv[i]));
+            assert(mx[i] == (av[i] < bv[i] ? bv[i] : av[i]));
+        }
+    });
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: popcount
+// =============================================================================
+bool test_popcount()
+{
+    std::cout << "\n=== TEST: popcount / popcount_sum ===\n";
+
+    const auto av = make_values(N);
+    const uint128_soa_vector a(av);
+
+    uint64_t expected_sum = 0;
+    for (const auto& x : av) {
+        expected_sum += static_cast<uint64_t>(intrinsics::popcount64(x.high()) +
+                                              intrinsics::popcount64(x.low()));
+    }
+
+    for_each_level([&](intrinsics::simd_level) {
+        std::vector<uint8_t> counts;
+        soa::popcount(a, counts);
+        assert(counts.size() == N);
+        for (std::size_t i = 0; i < N; ++i) {
+            assert(counts[i] == intrinsics::popcount64(av[i].high()) +
+                                    intrinsics::popcount64(av[i].low()));
+        }
+        assert(soa::popcount_sum(a) == expected_sum);
+    });
+
+    uint128_soa_vector ones(17, ~uint128_t(0));
+    assert(soa::popcount_sum(ones) == 17 * 128);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_soa.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    const auto& cpu = intrinsics::cpu();
+    std::cout << "CPU: avx2=" << cpu.avx2 << " avx512f=" << cpu.avx512f
+              << " avx512_vpopcntdq=" << cpu.avx512_vpopcntdq << "\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_conversion);
+    RUN_TEST(test_add_sub);
+    RUN_TEST(test_bitwise_shifts);
+    RUN_TEST(test_compare_minmax);
+    RUN_TEST(test_popcount);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
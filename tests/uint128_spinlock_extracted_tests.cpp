@@ -0,0 +1,203 @@
+/*
+ * Tests extraídos para uint128_spinlock.hpp
+ * ttas_spinlock / ticket_spinlock: exclusión mutua, try_lock, orden FIFO de
+ * los tickets, y los envoltorios ThreadSafe*SpinLock / TicketLock / Padded
+ */
+
+#include "../include/int128/int128_t.hpp"
+#include "../include/int128/int128_thread_safety.hpp"
+#include "../include/uint128/uint128_spinlock.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include "../include/uint128/uint128_thread_safety.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace nstd;
+
+static_assert(alignof(uint128_threadsafe::ThreadSafeUint128SpinLockPadded) == 64);
+static_assert(sizeof(uint128_threadsafe::ThreadSafeUint128SpinLockPadded) == 64);
+static_assert(alignof(int128_threadsafe::ThreadSafeInt128SpinLockPadded) == 64);
+static_assert(sizeof(uint128_threadsafe::ThreadSafeUint128SpinLock) <= 32);
+
+// Exclusión mutua: un contador no atómico protegido por el cerrojo
+template <typename Lock> bool check_mutual_exclusion()
+{
+    Lock lock;
+    uint128_t counter(0, ~0ull - 1000);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; ++t) {
+        pool.emplace_back([&] {
+            for (int i = 0; i < 10000; ++i) {
+                std::lock_guard<Lock> guard(lock);
+                counter += uint128_t(1);
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    return counter == uint128_t(0, ~0ull - 1000) + uint128_t(40000);
+}
+
+// Traspaso try_lock/unlock: el contador no atómico sólo se toca tras un
+// try_lock() con éxito, que debe sincronizar con el unlock() anterior
+template <typename Lock> bool check_try_lock_handoff()
+{
+    Lock lock;
+    uint64_t counter = 0;
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; ++t) {
+        pool.emplace_back([&] {
+            for (int i = 0; i < 10000;) {
+                if (lock.try_lock()) {
+                    ++counter;
+                    lock.unlock();
+                    ++i;
+                }
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    return counter == 40000;
+}
+
+// =============================================================================
+// TEST: cerrojos
+// =============================================================================
+bool test_locks()
+{
+    std::cout << "\n=== TEST: ttas_spinlock / ticket_spinlock ===\n";
+
+    ttas_spinlock ttas;
+    assert(ttas.try_lock() && !ttas.try_lock());
+    ttas.unlock();
+    assert(ttas.try_lock());
+    ttas.unlock();
+
+    ticket_spinlock ticket;
+    assert(ticket.try_lock() && !ticket.try_lock());
+    ticket.unlock();
+    ticket.lock();
+    assert(!ticket.try_lock());
+    ticket.unlock();
+
+    assert(check_mutual_exclusion<ttas_spinlock>());
+    assert(check_mutual_exclusion<ticket_spinlock>());
+    assert((check_mutual_exclusion<basic_ttas_spinlock<backoff_policy{0, 0, false}>>()));
+    assert((check_mutual_exclusion<basic_ticket_spinlock<backoff_policy{4, 64, false}>>()));
+    assert(check_try_lock_handoff<ttas_spinlock>());
+    assert(check_try_lock_handoff<ticket_spinlock>());
+
+    // Tickets: los hilos entran en el orden en que pidieron turno
+    ticket_spinlock fifo;
+    fifo.lock();
+    std::atomic<int> queued{0};
+    std::vector<int> order;
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 3; ++t) {
+        while (queued.load() != t) { // Uno a uno, para fijar el orden de los tickets
+            std::this_thread::yield();
+        }
+        pool.emplace_back([&, t] {
+            queued.fetch_add(1);
+            fifo.lock();
+            order.push_back(t);
+            fifo.unlock();
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20)); // Ticket ya tomado
+    }
+    fifo.unlock();
+    for (auto& th : pool) {
+        th.join();
+    }
+    assert((order == std::vector<int>{0, 1, 2}));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: envoltorios
+// =============================================================================
+template <typename Wrapper, typename T> bool check_wrapper(T start, T step)
+{
+    Wrapper w(start);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; ++t) {
+        pool.emplace_back([&] {
+            for (int i = 0; i < 10000; ++i) {
+                w.add(step);
+                (void)w.fetch_sub(step);
+                w.add(step);
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    return w.get() == start + step * T(40000);
+}
+
+bool test_wrappers()
+{
+    std::cout << "\n=== TEST: ThreadSafe*SpinLock / TicketLock / Padded ===\n";
+
+    using namespace uint128_threadsafe;
+    assert((check_wrapper<ThreadSafeUint128SpinLock>(uint128_t(0, ~0ull), uint128_t(1, 1))));
+    assert((check_wrapper<ThreadSafeUint128TicketLock>(uint128_t(0), uint128_t(3))));
+    assert((check_wrapper<ThreadSafeUint128SpinLockPadded>(uint128_t(7), uint128_t(0, 1ull << 63))));
+
+    using namespace int128_threadsafe;
+    assert((check_wrapper<ThreadSafeInt128SpinLock>(int128_t(-5), int128_t(-2))));
+    assert((check_wrapper<ThreadSafeInt128TicketLock>(int128_t(100), int128_t(-1))));
+    assert((check_wrapper<BasicThreadSafeInt128SpinLock<ticket_spinlock, 128>>(int128_t(0), int128_t(1))));
+
+    // Arrays de contadores con relleno: cada uno en su línea
+    ThreadSafeUint128SpinLockPadded counters[4];
+    assert(reinterpret_cast<std::uintptr_t>(&counters[1]) - reinterpret_cast<std::uintptr_t>(&counters[0]) == 64);
+    ThreadSafeInt128SpinLock s(int128_t(-9));
+    assert(s.is_negative() && s.get_abs() == int128_t(9));
+    int128_t expected(-9);
+    assert(s.compare_exchange(expected, int128_t(4)) && s.get() == int128_t(4));
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_spinlock.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_locks);
+    RUN_TEST(test_wrappers);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,204 @@
+/*
+ * Tests extraídos para uint128_succinct.hpp
+ * succinct_bitvector: rank y select frente a un recorrido bit a bit en
+ * tamaños que cruzan palabra, subbloque, superbloque y grupo, vectores
+ * dispersos con unos muy separados, espacio adicional y copias
+ */
+
+#include "../include/uint128/uint128_succinct.hpp"
+#include "../include/uint128/uint128_t.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace nstd;
+
+// Palabras aleatorias con probabilidad `density` de bit a 1
+std::vector<uint128_t> random_words(std::size_t bits, double density, uint64_t seed)
+{
+    std::mt19937_64 gen(seed);
+    std::bernoulli_distribution bit(density);
+    std::vector<uint128_t> words((bits + 127) / 128 + 1, uint128_t(0));
+    for (std::size_t i = 0; i < words.size() * 128; ++i) {
+        if (bit(gen)) {
+            words[i / 128] |= uint128_t(1) << static_cast<int>(i % 128);
+        }
+    }
+    return words;
+}
+
+// rank y select de todo el vector frente al recorrido bit a bit
+void check_against_scan(const succinct_bitvector& bv, const std::vector<uint128_t>& words)
+{
+    std::size_t ones = 0;
+    for (std::size_t i = 0; i < bv.size(); ++i) {
+        assert(bv.rank(i) == ones);
+        assert(bv.rank0(i) == i - ones);
+        const bool bit = ((words[i / 128] >> static_cast<int>(i % 128)) & uint128_t(1)) != uint128_t(0);
+        assert(bv[i] == bit);
+        if (bit) {
+            assert(bv.select(ones) == i);
+            ++ones;
+        }
+    }
+    assert(bv.count() == ones);
+    assert(bv.rank(bv.size()) == ones && bv.rank(bv.size() + 1000) == ones);
+    assert(bv.select(ones) == bv.size() && bv.select(ones + 1000) == bv.size());
+}
+
+// =============================================================================
+// TEST: tamaños en los bordes de la estructura
+// =============================================================================
+bool test_boundaries()
+{
+    std::cout << "\n=== TEST: rank/select en bordes de palabra, subbloque y grupo ===\n";
+
+    const std::size_t sizes[] = {0,    1,    127,  128,  129,   511,   512,  4095,
+                                 4096, 4097, 8191, 16384, 16385, 20000, 70000};
+    const double densities[] = {0.0, 0.01, 0.5, 0.99, 1.0};
+    uint64_t seed = 1;
+    for (std::size_t bits : sizes) {
+        for (double density : densities) {
+            const auto words = random_words(bits, density, seed++);
+            succinct_bitvector bv(words, bits);
+            assert(bv.size() == bits && bv.empty() == (bits == 0));
+            check_against_scan(bv, words);
+        }
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: unos muy separados (búsqueda entre muestras de select)
+// =============================================================================
+bool test_sparse()
+{
+    std::cout << "\n=== TEST: vectores dispersos y agrupados ===\n";
+
+    const std::size_t bits = std::size_t(1) << 23;
+    std::vector<uint128_t> words(bits / 128, uint128_t(0));
+    std::vector<std::size_t> positions;
+    std::mt19937_64 gen(42);
+    // Un uno cada ~100000 bits y un tramo denso de 3 superbloques en medio
+    for (std::size_t p = 7; p < bits; p += 90000 + gen() % 20000) {
+        positions.push_back(p);
+    }
+    for (std::size_t p = 4000000; p < 4000000 + 3 * 4096; ++p) {
+        positions.push_back(p);
+    }
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+    for (std::size_t p : positions) {
+        words[p / 128] |= uint128_t(1) << static_cast<int>(p % 128);
+    }
+
+    succinct_bitvector bv(words);
+    assert(bv.count() == positions.size());
+    for (std::size_t k = 0; k < positions.size(); ++k) {
+        assert(bv.select(k) == positions[k]);
+        assert(bv.rank(positions[k]) == k && bv.rank(positions[k] + 1) == k + 1);
+    }
+    for (int i = 0; i < 100000; ++i) {
+        const std::size_t p = gen() % bits;
+        const std::size_t expected = static_cast<std::size_t>(
+            std::lower_bound(positions.begin(), positions.end(), p) - positions.begin());
+        assert(bv.rank(p) == expected);
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: espacio adicional por debajo del 5 %
+// =============================================================================
+bool test_overhead()
+{
+    std::cout << "\n=== TEST: espacio adicional < 5% ===\n";
+
+    const std::size_t bits = std::size_t(1) << 22;
+    for (double density : {0.0, 0.5, 1.0}) {
+        const auto words = random_words(bits, density, 7);
+        succinct_bitvector bv(words, bits);
+        const double overhead = static_cast<double>(bv.index_bytes()) / static_cast<double>(bits / 8);
+        std::cout << "  densidad " << density << ": " << overhead * 100 << "%\n";
+        assert(overhead < 0.05);
+        assert(bv.memory_bytes() >= bits / 8 + bv.index_bytes());
+    }
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// TEST: copias, movimientos y errores
+// =============================================================================
+bool test_copy_and_errors()
+{
+    std::cout << "\n=== TEST: copia, movimiento y argumentos inválidos ===\n";
+
+    const auto words = random_words(10000, 0.3, 99);
+    succinct_bitvector bv(words, 10000);
+    succinct_bitvector copy(bv);
+    check_against_scan(copy, words);
+    succinct_bitvector assigned;
+    assigned = copy;
+    succinct_bitvector moved(std::move(copy));
+    assert(moved.count() == bv.count() && assigned.count() == bv.count());
+    check_against_scan(assigned, words);
+    check_against_scan(moved, words);
+
+    bool threw = false;
+    try {
+        succinct_bitvector bad(std::span<const uint128_t>(words.data(), 2), 257);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    succinct_bitvector none;
+    assert(none.rank(5) == 0 && none.select(0) == 0 && none.count() == 0);
+
+    std::cout << "  [OK] PASS\n";
+    return true;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  uint128_succinct.hpp - Tests Extraídos\n";
+    std::cout << "====================================================\n";
+
+    int passed = 0;
+    int total = 0;
+
+#define RUN_TEST(func)                                                                             \
+    total++;                                                                                       \
+    try {                                                                                          \
+        if (func())                                                                                \
+            passed++;                                                                              \
+    } catch (const std::exception& e) {                                                            \
+        std::cout << "  [FAIL] EXCEPTION: " << e.what() << "\n";                                   \
+    }
+
+    RUN_TEST(test_boundaries);
+    RUN_TEST(test_sparse);
+    RUN_TEST(test_overhead);
+    RUN_TEST(test_copy_and_errors);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  RESUMEN: " << passed << "/" << total << " tests pasados\n";
+    std::cout << "====================================================\n";
+
+    return (passed == total) ? 0 : 1;
+}
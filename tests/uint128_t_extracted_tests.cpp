@@ -895,6 +895,16 @@ void test_shift_left()
     assert((val << 128) == uint128_t(0, 0));
     assert((val << 200) == uint128_t(0, 0));
 
+    // Negative shift leaves the value unchanged
+    assert((val << -5) == val);
+
+    // Every amount: a single bit lands in the right word (branch-free path)
+    for (int n = 0; n < 128; ++n) {
+        const uint128_t bit = val << n;
+        assert(bit.high() == (n >= 64 ? 1ULL << (n - 64) : 0));
+        assert(bit.low() == (n < 64 ? 1ULL << n : 0));
+    }
+
     // Test assignment operator
     [[maybe_unused]] uint128_t val_assign(0, 1);
     val_assign <<= 10;
@@ -923,6 +933,16 @@ void test_shift_right()
     assert((val >> 128) == uint128_t(0, 0));
     assert((val >> 200) == uint128_t(0, 0));
 
+    // Negative shift leaves the value unchanged
+    assert((val >> -5) == val);
+
+    // Every amount: a single bit lands in the right word (branch-free path)
+    for (int n = 0; n < 128; ++n) {
+        const uint128_t bit = val >> n;
+        assert(bit.high() == (n < 64 ? (1ULL << 63) >> n : 0));
+        assert(bit.low() == (n >= 64 ? (1ULL << 63) >> (n - 64) : 0));
+    }
+
     // Test assignment operator
     [[maybe_unused]] uint128_t val_assign(1ULL << 63, 0);
     val_assign >>= 10;